@@ -290,7 +290,7 @@ struct JsonWriter
 		f << stringf("{\n");
 		f << stringf("  \"creator\": %s,\n", get_string(yosys_version_str).c_str());
 		f << stringf("  \"modules\": {\n");
-		vector<Module*> modules = use_selection ? design->selected_modules() : design->modules();
+		vector<Module*> modules = use_selection ? design->selected_modules_readonly() : design->modules_readonly();
 		bool first_module = true;
 		for (auto mod : modules) {
 			if (!first_module)
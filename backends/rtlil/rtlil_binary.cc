@@ -0,0 +1,280 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  Writer for the binary RTLIL format (see frontends/rtlil/rtlil_binary.h).
+ *
+ */
+
+#include "frontends/rtlil/rtlil_binary.h"
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+struct BinaryWriter
+{
+	dict<std::string, int> string_index;
+	std::vector<std::string> strings;
+
+	std::string *buf;
+	dict<const RTLIL::Wire*, int> wire_index;
+
+	void put_byte(unsigned char c)
+	{
+		buf->push_back(c);
+	}
+
+	void put_uint(uint64_t v)
+	{
+		while (v >= 0x80) {
+			put_byte((v & 0x7f) | 0x80);
+			v >>= 7;
+		}
+		put_byte(v);
+	}
+
+	void put_int(int64_t v)
+	{
+		put_uint((uint64_t(v) << 1) ^ uint64_t(v >> 63));
+	}
+
+	void put_str(const std::string &str)
+	{
+		auto it = string_index.find(str);
+		if (it == string_index.end()) {
+			it = string_index.emplace(str, GetSize(strings)).first;
+			strings.push_back(str);
+		}
+		put_uint(it->second);
+	}
+
+	void put_id(RTLIL::IdString id)
+	{
+		put_str(id.str());
+	}
+
+	void put_const(const RTLIL::Const &c)
+	{
+		put_uint(c.flags);
+		put_uint(c.size());
+
+		if ((c.flags & RTLIL::CONST_FLAG_STRING) && c.size() % 8 == 0 && c.is_fully_def()) {
+			std::string str = c.decode_string();
+			if (GetSize(str) * 8 == c.size()) {
+				put_uint(RTLIL_BINARY::CONST_KIND_STRING);
+				put_str(str);
+				return;
+			}
+		}
+
+		std::vector<uint64_t> words;
+		if (c.as_words(words)) {
+			put_uint(RTLIL_BINARY::CONST_KIND_BITS);
+			for (int i = 0; i < c.size(); i += 8)
+				put_byte(words[i / 64] >> (i % 64));
+			return;
+		}
+
+		put_uint(RTLIL_BINARY::CONST_KIND_STATES);
+		for (int i = 0; i < c.size(); i += 2)
+			put_byte(c[i] | (i+1 < c.size() ? c[i+1] << 4 : 0));
+	}
+
+	void put_sigspec(const RTLIL::SigSpec &sig)
+	{
+		put_uint(GetSize(sig.chunks()));
+		for (auto &chunk : sig.chunks()) {
+			if (chunk.wire == nullptr) {
+				put_uint(0);
+				put_const(chunk.data);
+			} else {
+				put_uint(wire_index.at(chunk.wire) + 1);
+				put_uint(chunk.offset);
+				put_uint(chunk.width);
+			}
+		}
+	}
+
+	void put_attrs(const dict<RTLIL::IdString, RTLIL::Const> &attrs)
+	{
+		put_uint(GetSize(attrs));
+		for (auto &it : attrs) {
+			put_id(it.first);
+			put_const(it.second);
+		}
+	}
+
+	void put_case(const RTLIL::CaseRule *cs)
+	{
+		put_attrs(cs->attributes);
+		put_uint(GetSize(cs->compare));
+		for (auto &sig : cs->compare)
+			put_sigspec(sig);
+		put_uint(GetSize(cs->actions));
+		for (auto &action : cs->actions) {
+			put_sigspec(action.first);
+			put_sigspec(action.second);
+		}
+		put_uint(GetSize(cs->switches));
+		for (auto sw : cs->switches) {
+			put_attrs(sw->attributes);
+			put_sigspec(sw->signal);
+			put_uint(GetSize(sw->cases));
+			for (auto sub_cs : sw->cases)
+				put_case(sub_cs);
+		}
+	}
+
+	void put_sync(const RTLIL::SyncRule *sy)
+	{
+		put_uint(sy->type);
+		put_sigspec(sy->signal);
+		put_uint(GetSize(sy->actions));
+		for (auto &action : sy->actions) {
+			put_sigspec(action.first);
+			put_sigspec(action.second);
+		}
+		put_uint(GetSize(sy->mem_write_actions));
+		for (auto &act : sy->mem_write_actions) {
+			put_id(act.memid);
+			put_sigspec(act.address);
+			put_sigspec(act.data);
+			put_sigspec(act.enable);
+			put_const(act.priority_mask);
+			put_attrs(act.attributes);
+		}
+	}
+
+	void put_module(RTLIL::Module *module)
+	{
+		put_attrs(module->attributes);
+
+		put_uint(GetSize(module->avail_parameters));
+		for (auto &param : module->avail_parameters) {
+			put_id(param);
+			auto it = module->parameter_default_values.find(param);
+			put_byte(it != module->parameter_default_values.end());
+			if (it != module->parameter_default_values.end())
+				put_const(it->second);
+		}
+
+		wire_index.clear();
+		put_uint(GetSize(module->wires()));
+		for (auto wire : module->wires()) {
+			int index = GetSize(wire_index);
+			wire_index[wire] = index;
+			put_id(wire->name);
+			put_uint(wire->width);
+			put_int(wire->start_offset);
+			put_uint(wire->port_id);
+			put_uint((wire->port_input ? RTLIL_BINARY::WIRE_INPUT : 0) | (wire->port_output ? RTLIL_BINARY::WIRE_OUTPUT : 0) |
+					(wire->upto ? RTLIL_BINARY::WIRE_UPTO : 0) | (wire->is_signed ? RTLIL_BINARY::WIRE_SIGNED : 0));
+			put_attrs(wire->attributes);
+		}
+
+		put_uint(GetSize(module->memories));
+		for (auto &it : module->memories) {
+			put_id(it.second->name);
+			put_uint(it.second->width);
+			put_int(it.second->start_offset);
+			put_uint(it.second->size);
+			put_attrs(it.second->attributes);
+		}
+
+		put_uint(GetSize(module->cells()));
+		for (auto cell : module->cells()) {
+			put_id(cell->name);
+			put_id(cell->type);
+			put_attrs(cell->attributes);
+			put_uint(GetSize(cell->parameters));
+			for (auto &it : cell->parameters) {
+				put_id(it.first);
+				put_const(it.second);
+			}
+			put_uint(GetSize(cell->connections()));
+			for (auto &it : cell->connections()) {
+				put_id(it.first);
+				put_sigspec(it.second);
+			}
+		}
+
+		put_uint(GetSize(module->connections()));
+		for (auto &it : module->connections()) {
+			put_sigspec(it.first);
+			put_sigspec(it.second);
+		}
+
+		put_uint(GetSize(module->processes));
+		for (auto &it : module->processes) {
+			put_id(it.second->name);
+			put_attrs(it.second->attributes);
+			put_case(&it.second->root_case);
+			put_uint(GetSize(it.second->syncs));
+			for (auto sy : it.second->syncs)
+				put_sync(sy);
+		}
+	}
+};
+
+PRIVATE_NAMESPACE_END
+YOSYS_NAMESPACE_BEGIN
+
+void RTLIL_BINARY::write_design(std::ostream &f, const std::vector<RTLIL::Module*> &modules)
+{
+	BinaryWriter writer;
+
+	// The string table has to precede the module bodies, so encode those
+	// first and assemble the file afterwards.
+	std::vector<std::string> bodies(GetSize(modules));
+	for (int i = 0; i < GetSize(modules); i++) {
+		writer.buf = &bodies[i];
+		writer.put_module(modules[i]);
+	}
+
+	std::string header;
+	writer.buf = &header;
+	writer.put_uint(version);
+	writer.put_uint(autoidx.load());
+
+	// Module names are needed for the index, add them before the string
+	// table is written out.
+	std::string index;
+	writer.buf = &index;
+	writer.put_uint(GetSize(modules));
+	uint64_t offset = 0;
+	for (int i = 0; i < GetSize(modules); i++) {
+		writer.put_id(modules[i]->name);
+		writer.put_uint(offset);
+		writer.put_uint(bodies[i].size());
+		offset += bodies[i].size();
+	}
+
+	writer.buf = &header;
+	writer.put_uint(GetSize(writer.strings));
+	for (auto &str : writer.strings) {
+		writer.put_uint(str.size());
+		header += str;
+	}
+
+	f.write(magic, sizeof(magic));
+	f << header << index;
+	for (auto &body : bodies)
+		f << body;
+}
+
+YOSYS_NAMESPACE_END
@@ -27,6 +27,7 @@
 #include "kernel/sigtools.h"
 #include "kernel/ff.h"
 #include "kernel/mem.h"
+#include "kernel/threading.h"
 #include <string>
 #include <sstream>
 #include <set>
@@ -36,15 +37,19 @@ USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
 bool verbose, norename, noattr, attr2comment, noexpr, nodec, nohex, nostr, extmem, defparam, decimal, siminit, systemverilog, simple_lhs;
-int auto_name_counter, auto_name_offset, auto_name_digits, extmem_counter;
-std::map<RTLIL::IdString, int> auto_name_map;
-std::set<RTLIL::IdString> reg_wires;
+int extmem_counter;
 std::string auto_prefix, extmem_prefix;
 
-RTLIL::Module *active_module;
-dict<RTLIL::SigBit, RTLIL::State> active_initdata;
-SigMap active_sigmap;
-IdString initial_id;
+// State of the module that is being dumped. Modules may be dumped by several
+// threads at once (see dump_modules_parallel()), so this is per thread.
+thread_local int auto_name_counter, auto_name_offset, auto_name_digits;
+thread_local dict<RTLIL::IdString, int> auto_name_map;
+thread_local pool<RTLIL::IdString> reg_wires;
+
+thread_local RTLIL::Module *active_module;
+thread_local dict<RTLIL::SigBit, RTLIL::State> active_initdata;
+thread_local SigMap active_sigmap;
+thread_local IdString initial_id;
 
 void reset_auto_counter_id(RTLIL::IdString id, bool may_rename)
 {
@@ -91,9 +96,11 @@ void reset_auto_counter(RTLIL::Module *module)
 	for (size_t i = 10; i < auto_name_offset + auto_name_map.size(); i = i*10)
 		auto_name_digits++;
 
-	if (verbose)
+	if (verbose) {
+		auto_name_map.sort();
 		for (auto it = auto_name_map.begin(); it != auto_name_map.end(); ++it)
 			log("  renaming `%s' to `%s_%0*d_'.\n", it->first.c_str(), auto_prefix.c_str(), auto_name_digits, auto_name_offset + it->second);
+	}
 }
 
 std::string next_auto_id()
@@ -101,35 +108,30 @@ std::string next_auto_id()
 	return stringf("%s_%0*d_", auto_prefix.c_str(), auto_name_digits, auto_name_offset + auto_name_counter++);
 }
 
-std::string id(RTLIL::IdString internal_id, bool may_rename = true)
+bool id_needs_escape(const char *str)
 {
-	const char *str = internal_id.c_str();
-	bool do_escape = false;
-
-	if (may_rename && auto_name_map.count(internal_id) != 0)
-		return stringf("%s_%0*d_", auto_prefix.c_str(), auto_name_digits, auto_name_offset + auto_name_map[internal_id]);
-
-	if (*str == '\\')
-		str++;
-
 	if ('0' <= *str && *str <= '9')
-		do_escape = true;
+		return true;
 
-	for (int i = 0; str[i]; i++)
+	int len = 0;
+	for (; str[len]; len++)
 	{
-		if ('0' <= str[i] && str[i] <= '9')
+		if ('0' <= str[len] && str[len] <= '9')
 			continue;
-		if ('a' <= str[i] && str[i] <= 'z')
+		if ('a' <= str[len] && str[len] <= 'z')
 			continue;
-		if ('A' <= str[i] && str[i] <= 'Z')
+		if ('A' <= str[len] && str[len] <= 'Z')
 			continue;
-		if (str[i] == '_')
+		if (str[len] == '_')
 			continue;
-		do_escape = true;
-		break;
+		return true;
 	}
 
-	const pool<string> keywords = {
+	// no keyword is longer than this, skip building a string for the lookup
+	if (len > 20)
+		return false;
+
+	static const pool<string> keywords = {
 		// IEEE 1800-2017 Annex B
 		"accept_on", "alias", "always", "always_comb", "always_ff", "always_latch", "and", "assert", "assign", "assume", "automatic", "before",
 		"begin", "bind", "bins", "binsof", "bit", "break", "buf", "bufif0", "bufif1", "byte", "case", "casex", "casez", "cell", "chandle",
@@ -153,14 +155,49 @@ std::string id(RTLIL::IdString internal_id, bool may_rename = true)
 		"untyped", "use", "uwire", "var", "vectored", "virtual", "void", "wait", "wait_order", "wand", "weak", "weak0", "weak1", "while",
 		"wildcard", "wire", "with", "within", "wor", "xnor", "xor",
 	};
-	if (keywords.count(str))
-		do_escape = true;
+	return keywords.count(str) != 0;
+}
+
+std::string id(RTLIL::IdString internal_id, bool may_rename = true)
+{
+	if (may_rename) {
+		auto it = auto_name_map.find(internal_id);
+		if (it != auto_name_map.end())
+			return stringf("%s_%0*d_", auto_prefix.c_str(), auto_name_digits, auto_name_offset + it->second);
+	}
+
+	const char *str = internal_id.c_str();
+	if (*str == '\\')
+		str++;
 
-	if (do_escape)
+	if (id_needs_escape(str))
 		return "\\" + std::string(str) + " ";
 	return std::string(str);
 }
 
+// Same as "f << id(internal_id)", without the temporary string.
+void dump_id(std::ostream &f, RTLIL::IdString internal_id, bool may_rename = true)
+{
+	if (may_rename) {
+		auto it = auto_name_map.find(internal_id);
+		if (it != auto_name_map.end()) {
+			char buffer[32];
+			snprintf(buffer, sizeof(buffer), "_%0*d_", auto_name_digits, auto_name_offset + it->second);
+			f << auto_prefix << buffer;
+			return;
+		}
+	}
+
+	const char *str = internal_id.c_str();
+	if (*str == '\\')
+		str++;
+
+	if (id_needs_escape(str))
+		f << '\\' << str << ' ';
+	else
+		f << str;
+}
+
 bool is_reg_wire(RTLIL::SigSpec sig, std::string &reg_name)
 {
 	if (!sig.is_chunk() || sig.as_chunk().wire == NULL)
@@ -190,7 +227,7 @@ void dump_const(std::ostream &f, const RTLIL::Const &data, int width = -1, int o
 {
 	bool set_signed = (data.flags & RTLIL::CONST_FLAG_SIGNED) != 0;
 	if (width < 0)
-		width = data.bits.size() - offset;
+		width = data.size() - offset;
 	if (width == 0) {
 		// See IEEE 1364-2005 Clause 5.1.14.
 		f << "{0{1'b0}}";
@@ -198,14 +235,14 @@ void dump_const(std::ostream &f, const RTLIL::Const &data, int width = -1, int o
 	}
 	if (nostr)
 		goto dump_hex;
-	if ((data.flags & RTLIL::CONST_FLAG_STRING) == 0 || width != (int)data.bits.size()) {
+	if ((data.flags & RTLIL::CONST_FLAG_STRING) == 0 || width != (int)data.size()) {
 		if (width == 32 && !no_decimal && !nodec) {
 			int32_t val = 0;
 			for (int i = offset+width-1; i >= offset; i--) {
-				log_assert(i < (int)data.bits.size());
-				if (data.bits[i] != State::S0 && data.bits[i] != State::S1)
+				log_assert(i < (int)data.size());
+				if (data[i] != State::S0 && data[i] != State::S1)
 					goto dump_hex;
-				if (data.bits[i] == State::S1)
+				if (data[i] == State::S1)
 					val |= 1 << (i - offset);
 			}
 			if (decimal)
@@ -220,8 +257,8 @@ void dump_const(std::ostream &f, const RTLIL::Const &data, int width = -1, int o
 				goto dump_bin;
 			vector<char> bin_digits, hex_digits;
 			for (int i = offset; i < offset+width; i++) {
-				log_assert(i < (int)data.bits.size());
-				switch (data.bits[i]) {
+				log_assert(i < (int)data.size());
+				switch (data[i]) {
 				case State::S0: bin_digits.push_back('0'); break;
 				case State::S1: bin_digits.push_back('1'); break;
 				case RTLIL::Sx: bin_digits.push_back('x'); break;
@@ -272,41 +309,41 @@ void dump_const(std::ostream &f, const RTLIL::Const &data, int width = -1, int o
 	dump_bin:
 			f << stringf("%d'%sb", width, set_signed ? "s" : "");
 			if (width == 0)
-				f << stringf("0");
+				f << "0";
 			for (int i = offset+width-1; i >= offset; i--) {
-				log_assert(i < (int)data.bits.size());
-				switch (data.bits[i]) {
-				case State::S0: f << stringf("0"); break;
-				case State::S1: f << stringf("1"); break;
-				case RTLIL::Sx: f << stringf("x"); break;
-				case RTLIL::Sz: f << stringf("z"); break;
-				case RTLIL::Sa: f << stringf("?"); break;
+				log_assert(i < (int)data.size());
+				switch (data[i]) {
+				case State::S0: f << "0"; break;
+				case State::S1: f << "1"; break;
+				case RTLIL::Sx: f << "x"; break;
+				case RTLIL::Sz: f << "z"; break;
+				case RTLIL::Sa: f << "?"; break;
 				case RTLIL::Sm: log_error("Found marker state in final netlist.");
 				}
 			}
 		}
 	} else {
 		if ((data.flags & RTLIL::CONST_FLAG_REAL) == 0)
-			f << stringf("\"");
+			f << "\"";
 		std::string str = data.decode_string();
 		for (size_t i = 0; i < str.size(); i++) {
 			if (str[i] == '\n')
-				f << stringf("\\n");
+				f << "\\n";
 			else if (str[i] == '\t')
-				f << stringf("\\t");
+				f << "\\t";
 			else if (str[i] < 32)
 				f << stringf("\\%03o", str[i]);
 			else if (str[i] == '"')
-				f << stringf("\\\"");
+				f << "\\\"";
 			else if (str[i] == '\\')
-				f << stringf("\\\\");
+				f << "\\\\";
 			else if (str[i] == '/' && escape_comment && i > 0 && str[i-1] == '*')
-				f << stringf("\\/");
+				f << "\\/";
 			else
 				f << str[i];
 		}
 		if ((data.flags & RTLIL::CONST_FLAG_REAL) == 0)
-			f << stringf("\"");
+			f << "\"";
 	}
 }
 
@@ -317,10 +354,10 @@ void dump_reg_init(std::ostream &f, SigSpec sig)
 
 	for (auto bit : active_sigmap(sig)) {
 		if (active_initdata.count(bit)) {
-			initval.bits.push_back(active_initdata.at(bit));
+			initval.bits().push_back(active_initdata.at(bit));
 			gotinit = true;
 		} else {
-			initval.bits.push_back(State::Sx);
+			initval.bits().push_back(State::Sx);
 		}
 	}
 
@@ -334,24 +371,25 @@ void dump_sigchunk(std::ostream &f, const RTLIL::SigChunk &chunk, bool no_decima
 {
 	if (chunk.wire == NULL) {
 		dump_const(f, chunk.data, chunk.width, chunk.offset, no_decimal);
+		return;
+	}
+
+	dump_id(f, chunk.wire->name);
+	if (chunk.width == chunk.wire->width && chunk.offset == 0)
+		return;
+
+	if (chunk.width == 1) {
+		if (chunk.wire->upto)
+			f << '[' << (chunk.wire->width - chunk.offset - 1) + chunk.wire->start_offset << ']';
+		else
+			f << '[' << chunk.offset + chunk.wire->start_offset << ']';
 	} else {
-		if (chunk.width == chunk.wire->width && chunk.offset == 0) {
-			f << stringf("%s", id(chunk.wire->name).c_str());
-		} else if (chunk.width == 1) {
-			if (chunk.wire->upto)
-				f << stringf("%s[%d]", id(chunk.wire->name).c_str(), (chunk.wire->width - chunk.offset - 1) + chunk.wire->start_offset);
-			else
-				f << stringf("%s[%d]", id(chunk.wire->name).c_str(), chunk.offset + chunk.wire->start_offset);
-		} else {
-			if (chunk.wire->upto)
-				f << stringf("%s[%d:%d]", id(chunk.wire->name).c_str(),
-						(chunk.wire->width - (chunk.offset + chunk.width - 1) - 1) + chunk.wire->start_offset,
-						(chunk.wire->width - chunk.offset - 1) + chunk.wire->start_offset);
-			else
-				f << stringf("%s[%d:%d]", id(chunk.wire->name).c_str(),
-						(chunk.offset + chunk.width - 1) + chunk.wire->start_offset,
-						chunk.offset + chunk.wire->start_offset);
-		}
+		if (chunk.wire->upto)
+			f << '[' << (chunk.wire->width - (chunk.offset + chunk.width - 1) - 1) + chunk.wire->start_offset
+					<< ':' << (chunk.wire->width - chunk.offset - 1) + chunk.wire->start_offset << ']';
+		else
+			f << '[' << (chunk.offset + chunk.width - 1) + chunk.wire->start_offset
+					<< ':' << chunk.offset + chunk.wire->start_offset << ']';
 	}
 }
 
@@ -365,30 +403,31 @@ void dump_sigspec(std::ostream &f, const RTLIL::SigSpec &sig)
 	if (sig.is_chunk()) {
 		dump_sigchunk(f, sig.as_chunk());
 	} else {
-		f << stringf("{ ");
+		f << "{ ";
 		for (auto it = sig.chunks().rbegin(); it != sig.chunks().rend(); ++it) {
 			if (it != sig.chunks().rbegin())
-				f << stringf(", ");
+				f << ", ";
 			dump_sigchunk(f, *it, true);
 		}
-		f << stringf(" }");
+		f << " }";
 	}
 }
 
-void dump_attributes(std::ostream &f, std::string indent, dict<RTLIL::IdString, RTLIL::Const> &attributes, char term = '\n', bool modattr = false, bool regattr = false, bool as_comment = false)
+void dump_attributes(std::ostream &f, const std::string &indent, dict<RTLIL::IdString, RTLIL::Const> &attributes, char term = '\n', bool modattr = false, bool regattr = false, bool as_comment = false)
 {
-	if (noattr)
+	if (noattr || attributes.empty())
 		return;
 	if (attr2comment)
 		as_comment = true;
 	for (auto it = attributes.begin(); it != attributes.end(); ++it) {
 		if (it->first == ID::init && regattr) continue;
-		f << stringf("%s" "%s %s", indent.c_str(), as_comment ? "/*" : "(*", id(it->first).c_str());
-		f << stringf(" = ");
+		f << indent << (as_comment ? "/* " : "(* ");
+		dump_id(f, it->first);
+		f << " = ";
 		if (modattr && (it->second == State::S0 || it->second == Const(0)))
-			f << stringf(" 0 ");
+			f << " 0 ";
 		else if (modattr && (it->second == State::S1 || it->second == Const(1)))
-			f << stringf(" 1 ");
+			f << " 1 ";
 		else
 			dump_const(f, it->second, -1, 0, false, as_comment);
 		f << stringf(" %s%c", as_comment ? "*/" : "*)", term);
@@ -412,28 +451,40 @@ void dump_wire(std::ostream &f, std::string indent, RTLIL::Wire *wire)
 	f << stringf("%s;\n", id(wire->name).c_str());
 #else
 	// do not use Verilog-2k "output reg" syntax in Verilog export
-	std::string range = "";
-	if (wire->width != 1) {
-		if (wire->upto)
-			range = stringf(" [%d:%d]", wire->start_offset, wire->width - 1 + wire->start_offset);
-		else
-			range = stringf(" [%d:%d]", wire->width - 1 + wire->start_offset, wire->start_offset);
+	auto dump_decl = [&](const char *keyword) {
+		f << indent << keyword;
+		if (wire->width != 1) {
+			if (wire->upto)
+				f << " [" << wire->start_offset << ':' << wire->width - 1 + wire->start_offset << ']';
+			else
+				f << " [" << wire->width - 1 + wire->start_offset << ':' << wire->start_offset << ']';
+		}
+		f << ' ';
+		dump_id(f, wire->name);
+	};
+	if (wire->port_input && !wire->port_output) {
+		dump_decl("input");
+		f << ";\n";
+	}
+	if (!wire->port_input && wire->port_output) {
+		dump_decl("output");
+		f << ";\n";
+	}
+	if (wire->port_input && wire->port_output) {
+		dump_decl("inout");
+		f << ";\n";
 	}
-	if (wire->port_input && !wire->port_output)
-		f << stringf("%s" "input%s %s;\n", indent.c_str(), range.c_str(), id(wire->name).c_str());
-	if (!wire->port_input && wire->port_output)
-		f << stringf("%s" "output%s %s;\n", indent.c_str(), range.c_str(), id(wire->name).c_str());
-	if (wire->port_input && wire->port_output)
-		f << stringf("%s" "inout%s %s;\n", indent.c_str(), range.c_str(), id(wire->name).c_str());
 	if (reg_wires.count(wire->name)) {
-		f << stringf("%s" "reg%s %s", indent.c_str(), range.c_str(), id(wire->name).c_str());
+		dump_decl("reg");
 		if (wire->attributes.count(ID::init)) {
-			f << stringf(" = ");
+			f << " = ";
 			dump_const(f, wire->attributes.at(ID::init));
 		}
-		f << stringf(";\n");
-	} else
-		f << stringf("%s" "wire%s %s;\n", indent.c_str(), range.c_str(), id(wire->name).c_str());
+		f << ";\n";
+	} else {
+		dump_decl("wire");
+		f << ";\n";
+	}
 #endif
 }
 
@@ -500,7 +551,7 @@ void dump_memory(std::ostream &f, std::string indent, Mem &mem)
 		}
 		else
 		{
-			f << stringf("%s" "initial begin\n", indent.c_str());
+			f << indent << "initial begin\n";
 			for (auto &init : mem.inits) {
 				int words = GetSize(init.data) / mem.width;
 				int start = init.addr.as_int();
@@ -522,11 +573,11 @@ void dump_memory(std::ostream &f, std::string indent, Mem &mem)
 							f << stringf("%s" "  %s[%d][%d:%d] = ", indent.c_str(), mem_id.c_str(), i + start, j, start_j);
 						}
 						dump_const(f, init.data.extract(i*mem.width+start_j, width));
-						f << stringf(";\n");
+						f << ";\n";
 					}
 				}
 			}
-			f << stringf("%s" "end\n", indent.c_str());
+			f << indent << "end\n";
 		}
 	}
 
@@ -750,7 +801,7 @@ void dump_memory(std::ostream &f, std::string indent, Mem &mem)
 					if (port.wide_log2) {
 						Const addr_lo;
 						for (int i = 0; i < port.wide_log2; i++)
-							addr_lo.bits.push_back(State(sub >> i & 1));
+							addr_lo.bits().push_back(State(sub >> i & 1));
 						os << "{";
 						os << temp_id;
 						os << ", ";
@@ -863,24 +914,24 @@ void dump_memory(std::ostream &f, std::string indent, Mem &mem)
 					f << stringf("%s%s", indent.c_str(), indent.c_str());
 					if (wen_bit != State::S1)
 					{
-						f << stringf("if (");
+						f << "if (";
 						dump_sigspec(f, wen_bit);
-						f << stringf(")\n");
+						f << ")\n";
 						f << stringf("%s%s%s", indent.c_str(), indent.c_str(), indent.c_str());
 					}
 					f << stringf("%s[", mem_id.c_str());
 					dump_sigspec(f, addr);
 					if (width == GetSize(port.en))
-						f << stringf("] <= ");
+						f << "] <= ";
 					else
 						f << stringf("][%d:%d] <= ", i, start_i);
 					dump_sigspec(f, port.data.extract(sub * mem.width + start_i, width));
-					f << stringf(";\n");
+					f << ";\n";
 				}
 			}
 		}
 
-		f << stringf("%s" "end\n", indent.c_str());
+		f << indent << "end\n";
 	}
 	// Output Verilog that looks something like this:
 	// reg [..] _3_;
@@ -926,7 +977,7 @@ void dump_memory(std::ostream &f, std::string indent, Mem &mem)
 				for(auto &line : lof_lines)
 					f << stringf("%s%s" "%s", indent.c_str(), indent.c_str(), line.c_str());
 			}
-			f << stringf("%s" "end\n", indent.c_str());
+			f << indent << "end\n";
 		}
 		else
 		{
@@ -937,14 +988,18 @@ void dump_memory(std::ostream &f, std::string indent, Mem &mem)
 	}
 }
 
-void dump_cell_expr_port(std::ostream &f, RTLIL::Cell *cell, std::string port, bool gen_signed = true)
+void dump_cell_expr_port(std::ostream &f, RTLIL::Cell *cell, RTLIL::IdString port, bool gen_signed = true)
 {
-	if (gen_signed && cell->parameters.count("\\" + port + "_SIGNED") > 0 && cell->parameters["\\" + port + "_SIGNED"].as_bool()) {
-		f << stringf("$signed(");
-		dump_sigspec(f, cell->getPort("\\" + port));
-		f << stringf(")");
-	} else
-		dump_sigspec(f, cell->getPort("\\" + port));
+	if (gen_signed) {
+		auto it = cell->parameters.find(port.str() + "_SIGNED");
+		if (it != cell->parameters.end() && it->second.as_bool()) {
+			f << "$signed(";
+			dump_sigspec(f, cell->getPort(port));
+			f << ")";
+			return;
+		}
+	}
+	dump_sigspec(f, cell->getPort(port));
 }
 
 std::string cellname(RTLIL::Cell *cell)
@@ -985,121 +1040,121 @@ no_special_reg_name:
 
 void dump_cell_expr_uniop(std::ostream &f, std::string indent, RTLIL::Cell *cell, std::string op)
 {
-	f << stringf("%s" "assign ", indent.c_str());
+	f << indent << "assign ";
 	dump_sigspec(f, cell->getPort(ID::Y));
 	f << stringf(" = %s ", op.c_str());
 	dump_attributes(f, "", cell->attributes, ' ');
-	dump_cell_expr_port(f, cell, "A", true);
-	f << stringf(";\n");
+	dump_cell_expr_port(f, cell, ID::A, true);
+	f << ";\n";
 }
 
 void dump_cell_expr_binop(std::ostream &f, std::string indent, RTLIL::Cell *cell, std::string op)
 {
-	f << stringf("%s" "assign ", indent.c_str());
+	f << indent << "assign ";
 	dump_sigspec(f, cell->getPort(ID::Y));
-	f << stringf(" = ");
-	dump_cell_expr_port(f, cell, "A", true);
+	f << " = ";
+	dump_cell_expr_port(f, cell, ID::A, true);
 	f << stringf(" %s ", op.c_str());
 	dump_attributes(f, "", cell->attributes, ' ');
-	dump_cell_expr_port(f, cell, "B", true);
-	f << stringf(";\n");
+	dump_cell_expr_port(f, cell, ID::B, true);
+	f << ";\n";
 }
 
 bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 {
 	if (cell->type == ID($_NOT_)) {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
-		f << stringf("~");
+		f << " = ";
+		f << "~";
 		dump_attributes(f, "", cell->attributes, ' ');
-		dump_cell_expr_port(f, cell, "A", false);
-		f << stringf(";\n");
+		dump_cell_expr_port(f, cell, ID::A, false);
+		f << ";\n";
 		return true;
 	}
 
 	if (cell->type.in(ID($_AND_), ID($_NAND_), ID($_OR_), ID($_NOR_), ID($_XOR_), ID($_XNOR_), ID($_ANDNOT_), ID($_ORNOT_))) {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
+		f << " = ";
 		if (cell->type.in(ID($_NAND_), ID($_NOR_), ID($_XNOR_)))
-			f << stringf("~(");
-		dump_cell_expr_port(f, cell, "A", false);
-		f << stringf(" ");
+			f << "~(";
+		dump_cell_expr_port(f, cell, ID::A, false);
+		f << " ";
 		if (cell->type.in(ID($_AND_), ID($_NAND_), ID($_ANDNOT_)))
-			f << stringf("&");
+			f << "&";
 		if (cell->type.in(ID($_OR_), ID($_NOR_), ID($_ORNOT_)))
-			f << stringf("|");
+			f << "|";
 		if (cell->type.in(ID($_XOR_), ID($_XNOR_)))
-			f << stringf("^");
+			f << "^";
 		dump_attributes(f, "", cell->attributes, ' ');
-		f << stringf(" ");
+		f << " ";
 		if (cell->type.in(ID($_ANDNOT_), ID($_ORNOT_)))
-			f << stringf("~(");
-		dump_cell_expr_port(f, cell, "B", false);
+			f << "~(";
+		dump_cell_expr_port(f, cell, ID::B, false);
 		if (cell->type.in(ID($_NAND_), ID($_NOR_), ID($_XNOR_), ID($_ANDNOT_), ID($_ORNOT_)))
-			f << stringf(")");
-		f << stringf(";\n");
+			f << ")";
+		f << ";\n";
 		return true;
 	}
 
 	if (cell->type == ID($_MUX_)) {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
-		dump_cell_expr_port(f, cell, "S", false);
-		f << stringf(" ? ");
+		f << " = ";
+		dump_cell_expr_port(f, cell, ID::S, false);
+		f << " ? ";
 		dump_attributes(f, "", cell->attributes, ' ');
-		dump_cell_expr_port(f, cell, "B", false);
-		f << stringf(" : ");
-		dump_cell_expr_port(f, cell, "A", false);
-		f << stringf(";\n");
+		dump_cell_expr_port(f, cell, ID::B, false);
+		f << " : ";
+		dump_cell_expr_port(f, cell, ID::A, false);
+		f << ";\n";
 		return true;
 	}
 
 	if (cell->type == ID($_NMUX_)) {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = !(");
-		dump_cell_expr_port(f, cell, "S", false);
-		f << stringf(" ? ");
+		f << " = !(";
+		dump_cell_expr_port(f, cell, ID::S, false);
+		f << " ? ";
 		dump_attributes(f, "", cell->attributes, ' ');
-		dump_cell_expr_port(f, cell, "B", false);
-		f << stringf(" : ");
-		dump_cell_expr_port(f, cell, "A", false);
-		f << stringf(");\n");
+		dump_cell_expr_port(f, cell, ID::B, false);
+		f << " : ";
+		dump_cell_expr_port(f, cell, ID::A, false);
+		f << ");\n";
 		return true;
 	}
 
 	if (cell->type.in(ID($_AOI3_), ID($_OAI3_))) {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ~((");
-		dump_cell_expr_port(f, cell, "A", false);
+		f << " = ~((";
+		dump_cell_expr_port(f, cell, ID::A, false);
 		f << stringf(cell->type == ID($_AOI3_) ? " & " : " | ");
-		dump_cell_expr_port(f, cell, "B", false);
+		dump_cell_expr_port(f, cell, ID::B, false);
 		f << stringf(cell->type == ID($_AOI3_) ? ") |" : ") &");
 		dump_attributes(f, "", cell->attributes, ' ');
-		f << stringf(" ");
-		dump_cell_expr_port(f, cell, "C", false);
-		f << stringf(");\n");
+		f << " ";
+		dump_cell_expr_port(f, cell, ID::C, false);
+		f << ");\n";
 		return true;
 	}
 
 	if (cell->type.in(ID($_AOI4_), ID($_OAI4_))) {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ~((");
-		dump_cell_expr_port(f, cell, "A", false);
+		f << " = ~((";
+		dump_cell_expr_port(f, cell, ID::A, false);
 		f << stringf(cell->type == ID($_AOI4_) ? " & " : " | ");
-		dump_cell_expr_port(f, cell, "B", false);
+		dump_cell_expr_port(f, cell, ID::B, false);
 		f << stringf(cell->type == ID($_AOI4_) ? ") |" : ") &");
 		dump_attributes(f, "", cell->attributes, ' ');
-		f << stringf(" (");
-		dump_cell_expr_port(f, cell, "C", false);
+		f << " (";
+		dump_cell_expr_port(f, cell, ID::C, false);
 		f << stringf(cell->type == ID($_AOI4_) ? " & " : " | ");
-		dump_cell_expr_port(f, cell, "D", false);
-		f << stringf("));\n");
+		dump_cell_expr_port(f, cell, ID::D, false);
+		f << "));\n";
 		return true;
 	}
 
@@ -1174,18 +1229,18 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 			// intentionally one wider than maximum width
 			f << stringf("%s" "wire [%d:0] %s, %s, %s;\n", indent.c_str(), size_max, buf_a.c_str(), buf_b.c_str(), buf_num.c_str());
 			f << stringf("%s" "assign %s = ", indent.c_str(), buf_a.c_str());
-			dump_cell_expr_port(f, cell, "A", true);
-			f << stringf(";\n");
+			dump_cell_expr_port(f, cell, ID::A, true);
+			f << ";\n";
 			f << stringf("%s" "assign %s = ", indent.c_str(), buf_b.c_str());
-			dump_cell_expr_port(f, cell, "B", true);
-			f << stringf(";\n");
+			dump_cell_expr_port(f, cell, ID::B, true);
+			f << ";\n";
 
 			f << stringf("%s" "assign %s = ", indent.c_str(), buf_num.c_str());
-			f << stringf("(");
+			f << "(";
 			dump_sigspec(f, sig_a.extract(sig_a.size()-1));
-			f << stringf(" == ");
+			f << " == ";
 			dump_sigspec(f, sig_b.extract(sig_b.size()-1));
-			f << stringf(") || ");
+			f << ") || ";
 			dump_sigspec(f, sig_a);
 			f << stringf(" == 0 ? %s : ", buf_a.c_str());
 			f << stringf("$signed(%s - (", buf_a.c_str());
@@ -1193,7 +1248,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 			f << stringf(" ? %s + 1 : %s - 1));\n", buf_b.c_str(), buf_b.c_str());
 
 
-			f << stringf("%s" "assign ", indent.c_str());
+			f << indent << "assign ";
 			dump_sigspec(f, cell->getPort(ID::Y));
 			f << stringf(" = $signed(%s) / ", buf_num.c_str());
 			dump_attributes(f, "", cell->attributes, ' ');
@@ -1217,20 +1272,20 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 			std::string temp_id = next_auto_id();
 			f << stringf("%s" "wire [%d:0] %s = ", indent.c_str(), GetSize(cell->getPort(ID::A))-1, temp_id.c_str());
-			dump_cell_expr_port(f, cell, "A", true);
+			dump_cell_expr_port(f, cell, ID::A, true);
 			f << stringf(" %% ");
 			dump_attributes(f, "", cell->attributes, ' ');
-			dump_cell_expr_port(f, cell, "B", true);
-			f << stringf(";\n");
+			dump_cell_expr_port(f, cell, ID::B, true);
+			f << ";\n";
 
-			f << stringf("%s" "assign ", indent.c_str());
+			f << indent << "assign ";
 			dump_sigspec(f, cell->getPort(ID::Y));
-			f << stringf(" = (");
+			f << " = (";
 			dump_sigspec(f, sig_a.extract(sig_a.size()-1));
-			f << stringf(" == ");
+			f << " == ";
 			dump_sigspec(f, sig_b.extract(sig_b.size()-1));
 			f << stringf(") || %s == 0 ? %s : ", temp_id.c_str(), temp_id.c_str());
-			dump_cell_expr_port(f, cell, "B", true);
+			dump_cell_expr_port(f, cell, ID::B, true);
 			f << stringf(" + $signed(%s);\n", temp_id.c_str());
 			return true;
 		} else {
@@ -1242,28 +1297,28 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 	if (cell->type == ID($shift))
 	{
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
+		f << " = ";
 		if (cell->getParam(ID::B_SIGNED).as_bool())
 		{
-			dump_cell_expr_port(f, cell, "B", true);
-			f << stringf(" < 0 ? ");
-			dump_cell_expr_port(f, cell, "A", true);
-			f << stringf(" << - ");
+			dump_cell_expr_port(f, cell, ID::B, true);
+			f << " < 0 ? ";
+			dump_cell_expr_port(f, cell, ID::A, true);
+			f << " << - ";
 			dump_sigspec(f, cell->getPort(ID::B));
-			f << stringf(" : ");
-			dump_cell_expr_port(f, cell, "A", true);
-			f << stringf(" >> ");
+			f << " : ";
+			dump_cell_expr_port(f, cell, ID::A, true);
+			f << " >> ";
 			dump_sigspec(f, cell->getPort(ID::B));
 		}
 		else
 		{
-			dump_cell_expr_port(f, cell, "A", true);
-			f << stringf(" >> ");
+			dump_cell_expr_port(f, cell, ID::A, true);
+			f << " >> ";
 			dump_sigspec(f, cell->getPort(ID::B));
 		}
-		f << stringf(";\n");
+		f << ";\n";
 		return true;
 	}
 
@@ -1272,33 +1327,33 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 		std::string temp_id = next_auto_id();
 		f << stringf("%s" "wire [%d:0] %s = ", indent.c_str(), GetSize(cell->getPort(ID::A))-1, temp_id.c_str());
 		dump_sigspec(f, cell->getPort(ID::A));
-		f << stringf(";\n");
+		f << ";\n";
 
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
 		f << stringf(" = %s[", temp_id.c_str());
 		if (cell->getParam(ID::B_SIGNED).as_bool())
-			f << stringf("$signed(");
+			f << "$signed(";
 		dump_sigspec(f, cell->getPort(ID::B));
 		if (cell->getParam(ID::B_SIGNED).as_bool())
-			f << stringf(")");
+			f << ")";
 		f << stringf(" +: %d", cell->getParam(ID::Y_WIDTH).as_int());
-		f << stringf("];\n");
+		f << "];\n";
 		return true;
 	}
 
 	if (cell->type == ID($mux))
 	{
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
+		f << " = ";
 		dump_sigspec(f, cell->getPort(ID::S));
-		f << stringf(" ? ");
+		f << " ? ";
 		dump_attributes(f, "", cell->attributes, ' ');
 		dump_sigspec(f, cell->getPort(ID::B));
-		f << stringf(" : ");
+		f << " : ";
 		dump_sigspec(f, cell->getPort(ID::A));
-		f << stringf(";\n");
+		f << ";\n";
 		return true;
 	}
 
@@ -1315,8 +1370,8 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 		dump_attributes(f, indent + "  ", cell->attributes);
 		if (!noattr)
-			f << stringf("%s" "  (* parallel_case *)\n", indent.c_str());
-		f << stringf("%s" "  casez (s)", indent.c_str());
+			f << indent << "  (* parallel_case *)\n";
+		f << indent << "  casez (s)";
 		f << stringf(noattr ? " // synopsys parallel_case\n" : "\n");
 
 		for (int i = 0; i < s_width; i++)
@@ -1326,35 +1381,35 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 			for (int j = s_width-1; j >= 0; j--)
 				f << stringf("%c", j == i ? '1' : '?');
 
-			f << stringf(":\n");
+			f << ":\n";
 			f << stringf("%s" "      %s = b[%d:%d];\n", indent.c_str(), func_name.c_str(), (i+1)*width-1, i*width);
 		}
 
-		f << stringf("%s" "    default:\n", indent.c_str());
+		f << indent << "    default:\n";
 		f << stringf("%s" "      %s = a;\n", indent.c_str(), func_name.c_str());
 
-		f << stringf("%s" "  endcase\n", indent.c_str());
-		f << stringf("%s" "endfunction\n", indent.c_str());
+		f << indent << "  endcase\n";
+		f << indent << "endfunction\n";
 
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
 		f << stringf(" = %s(", func_name.c_str());
 		dump_sigspec(f, cell->getPort(ID::A));
-		f << stringf(", ");
+		f << ", ";
 		dump_sigspec(f, cell->getPort(ID::B));
-		f << stringf(", ");
+		f << ", ";
 		dump_sigspec(f, cell->getPort(ID::S));
-		f << stringf(");\n");
+		f << ");\n";
 		return true;
 	}
 
 	if (cell->type == ID($tribuf))
 	{
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
+		f << " = ";
 		dump_sigspec(f, cell->getPort(ID::EN));
-		f << stringf(" ? ");
+		f << " ? ";
 		dump_sigspec(f, cell->getPort(ID::A));
 		f << stringf(" : %d'bz;\n", cell->parameters.at(ID::WIDTH).as_int());
 		return true;
@@ -1362,9 +1417,9 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 	if (cell->type == ID($slice))
 	{
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
+		f << " = ";
 		dump_sigspec(f, cell->getPort(ID::A));
 		f << stringf(" >> %d;\n", cell->parameters.at(ID::OFFSET).as_int());
 		return true;
@@ -1372,26 +1427,26 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 	if (cell->type == ID($concat))
 	{
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = { ");
+		f << " = { ";
 		dump_sigspec(f, cell->getPort(ID::B));
-		f << stringf(" , ");
+		f << " , ";
 		dump_sigspec(f, cell->getPort(ID::A));
-		f << stringf(" };\n");
+		f << " };\n";
 		return true;
 	}
 
 	if (cell->type == ID($lut))
 	{
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, cell->getPort(ID::Y));
-		f << stringf(" = ");
+		f << " = ";
 		dump_const(f, cell->parameters.at(ID::LUT));
-		f << stringf(" >> ");
+		f << " >> ";
 		dump_attributes(f, "", cell->attributes, ' ');
 		dump_sigspec(f, cell->getPort(ID::A));
-		f << stringf(";\n");
+		f << ";\n";
 		return true;
 	}
 
@@ -1448,14 +1503,14 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 						sig_set_name = next_auto_id();
 						f << stringf("%s" "wire %s = ", indent.c_str(), sig_set_name.c_str());
 						dump_const(f, ff.sig_set[i].data);
-						f << stringf(";\n");
+						f << ";\n";
 					}
 					if (ff.sig_clr[i].wire == NULL)
 					{
 						sig_clr_name = next_auto_id();
 						f << stringf("%s" "wire %s = ", indent.c_str(), sig_clr_name.c_str());
 						dump_const(f, ff.sig_clr[i].data);
-						f << stringf(";\n");
+						f << ";\n";
 					}
 				} else if (ff.has_arst) {
 					if (ff.sig_arst[0].wire == NULL)
@@ -1463,7 +1518,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 						sig_arst_name = next_auto_id();
 						f << stringf("%s" "wire %s = ", indent.c_str(), sig_arst_name.c_str());
 						dump_const(f, ff.sig_arst[0].data);
-						f << stringf(";\n");
+						f << ";\n";
 					}
 				} else if (ff.has_aload) {
 					if (ff.sig_aload[0].wire == NULL)
@@ -1471,7 +1526,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 						sig_aload_name = next_auto_id();
 						f << stringf("%s" "wire %s = ", indent.c_str(), sig_aload_name.c_str());
 						dump_const(f, ff.sig_aload[0].data);
-						f << stringf(";\n");
+						f << ";\n";
 					}
 				}
 			}
@@ -1507,9 +1562,9 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 					else
 						dump_sigspec(f, ff.sig_aload);
 				}
-				f << stringf(")\n");
+				f << ")\n";
 
-				f << stringf("%s" "  ", indent.c_str());
+				f << indent << "  ";
 				if (ff.has_sr) {
 					f << stringf("if (%s", ff.pol_clr ? "" : "!");
 					if (ff.sig_clr[i].wire == NULL)
@@ -1523,7 +1578,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 					else
 						dump_sigspec(f, ff.sig_set[i]);
 					f << stringf(") %s <= 1'b1;\n", reg_bit_name.c_str());
-					f << stringf("%s" "  else ", indent.c_str());
+					f << indent << "  else ";
 				} else if (ff.has_arst) {
 					f << stringf("if (%s", ff.pol_arst ? "" : "!");
 					if (ff.sig_arst[0].wire == NULL)
@@ -1532,8 +1587,8 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 						dump_sigspec(f, ff.sig_arst);
 					f << stringf(") %s <= ", reg_bit_name.c_str());
 					dump_sigspec(f, val_arst);
-					f << stringf(";\n");
-					f << stringf("%s" "  else ", indent.c_str());
+					f << ";\n";
+					f << indent << "  else ";
 				} else if (ff.has_aload) {
 					f << stringf("if (%s", ff.pol_aload ? "" : "!");
 					if (ff.sig_aload[0].wire == NULL)
@@ -1542,46 +1597,46 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 						dump_sigspec(f, ff.sig_aload);
 					f << stringf(") %s <= ", reg_bit_name.c_str());
 					dump_sigspec(f, sig_ad);
-					f << stringf(";\n");
-					f << stringf("%s" "  else ", indent.c_str());
+					f << ";\n";
+					f << indent << "  else ";
 				}
 
 				if (ff.has_srst && ff.has_ce && ff.ce_over_srst) {
 					f << stringf("if (%s", ff.pol_ce ? "" : "!");
 					dump_sigspec(f, ff.sig_ce);
-					f << stringf(")\n");
+					f << ")\n";
 					f << stringf("%s" "    if (%s", indent.c_str(), ff.pol_srst ? "" : "!");
 					dump_sigspec(f, ff.sig_srst);
 					f << stringf(") %s <= ", reg_bit_name.c_str());
 					dump_sigspec(f, val_srst);
-					f << stringf(";\n");
-					f << stringf("%s" "    else ", indent.c_str());
+					f << ";\n";
+					f << indent << "    else ";
 				} else {
 					if (ff.has_srst) {
 						f << stringf("if (%s", ff.pol_srst ? "" : "!");
 						dump_sigspec(f, ff.sig_srst);
 						f << stringf(") %s <= ", reg_bit_name.c_str());
 						dump_sigspec(f, val_srst);
-						f << stringf(";\n");
-						f << stringf("%s" "  else ", indent.c_str());
+						f << ";\n";
+						f << indent << "  else ";
 					}
 					if (ff.has_ce) {
 						f << stringf("if (%s", ff.pol_ce ? "" : "!");
 						dump_sigspec(f, ff.sig_ce);
-						f << stringf(") ");
+						f << ") ";
 					}
 				}
 
 				f << stringf("%s <= ", reg_bit_name.c_str());
 				dump_sigspec(f, sig_d);
-				f << stringf(";\n");
+				f << ";\n";
 			}
 			else
 			{
 				// Latches.
 				f << stringf("%s" "always%s\n", indent.c_str(), systemverilog ? "_latch" : " @*");
 
-				f << stringf("%s" "  ", indent.c_str());
+				f << indent << "  ";
 				if (ff.has_sr) {
 					f << stringf("if (%s", ff.pol_clr ? "" : "!");
 					dump_sigspec(f, ff.sig_clr[i]);
@@ -1590,28 +1645,28 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 					dump_sigspec(f, ff.sig_set[i]);
 					f << stringf(") %s = 1'b1;\n", reg_bit_name.c_str());
 					if (ff.has_aload)
-						f << stringf("%s" "  else ", indent.c_str());
+						f << indent << "  else ";
 				} else if (ff.has_arst) {
 					f << stringf("if (%s", ff.pol_arst ? "" : "!");
 					dump_sigspec(f, ff.sig_arst);
 					f << stringf(") %s = ", reg_bit_name.c_str());
 					dump_sigspec(f, val_arst);
-					f << stringf(";\n");
+					f << ";\n";
 					if (ff.has_aload)
-						f << stringf("%s" "  else ", indent.c_str());
+						f << indent << "  else ";
 				}
 				if (ff.has_aload) {
 					f << stringf("if (%s", ff.pol_aload ? "" : "!");
 					dump_sigspec(f, ff.sig_aload);
 					f << stringf(") %s = ", reg_bit_name.c_str());
 					dump_sigspec(f, sig_ad);
-					f << stringf(";\n");
+					f << ";\n";
 				}
 			}
 		}
 
 		if (!out_is_reg_wire) {
-			f << stringf("%s" "assign ", indent.c_str());
+			f << indent << "assign ";
 			dump_sigspec(f, ff.sig_q);
 			f << stringf(" = %s;\n", reg_name.c_str());
 		}
@@ -1625,7 +1680,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 		dump_sigspec(f, cell->getPort(ID::EN));
 		f << stringf(") %s(", cell->type.c_str()+1);
 		dump_sigspec(f, cell->getPort(ID::A));
-		f << stringf(");\n");
+		f << ");\n";
 		return true;
 	}
 
@@ -1635,9 +1690,9 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 		SigSpec en = cell->getPort(ID::EN);
 		if (en != State::S1) {
-			f << stringf("if (");
+			f << "if (";
 			dump_sigspec(f, cell->getPort(ID::EN));
-			f << stringf(") ");
+			f << ") ";
 		}
 
 		f << "(";
@@ -1683,7 +1738,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 
 		decimal = bak_decimal;
 
-		f << stringf("%s" "endspecify\n", indent.c_str());
+		f << indent << "endspecify\n";
 		return true;
 	}
 
@@ -1735,7 +1790,7 @@ bool dump_cell_expr(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 		f << ");\n";
 		decimal = bak_decimal;
 
-		f << stringf("%s" "endspecify\n", indent.c_str());
+		f << indent << "endspecify\n";
 		return true;
 	}
 
@@ -1756,25 +1811,28 @@ void dump_cell(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 	}
 
 	dump_attributes(f, indent, cell->attributes);
-	f << stringf("%s" "%s", indent.c_str(), id(cell->type, false).c_str());
+	f << indent;
+	dump_id(f, cell->type, false);
 
 	if (!defparam && cell->parameters.size() > 0) {
-		f << stringf(" #(");
+		f << " #(";
 		for (auto it = cell->parameters.begin(); it != cell->parameters.end(); ++it) {
 			if (it != cell->parameters.begin())
-				f << stringf(",");
-			f << stringf("\n%s  .%s(", indent.c_str(), id(it->first).c_str());
+				f << ",";
+			f << '\n' << indent << "  .";
+			dump_id(f, it->first);
+			f << '(';
 			dump_const(f, it->second);
-			f << stringf(")");
+			f << ")";
 		}
-		f << stringf("\n%s" ")", indent.c_str());
+		f << '\n' << indent << ')';
 	}
 
-	std::string cell_name = cellname(cell);
-	if (cell_name != id(cell->name))
-		f << stringf(" %s /* %s */ (", cell_name.c_str(), id(cell->name).c_str());
+	std::string cell_name = cellname(cell), cell_id = id(cell->name);
+	if (cell_name != cell_id)
+		f << ' ' << cell_name << " /* " << cell_id << " */ (";
 	else
-		f << stringf(" %s (", cell_name.c_str());
+		f << ' ' << cell_name << " (";
 
 	bool first_arg = true;
 	std::set<RTLIL::IdString> numbered_ports;
@@ -1785,9 +1843,9 @@ void dump_cell(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 			if (it->first != str)
 				continue;
 			if (!first_arg)
-				f << stringf(",");
+				f << ",";
 			first_arg = false;
-			f << stringf("\n%s  ", indent.c_str());
+			f << '\n' << indent << "  ";
 			dump_sigspec(f, it->second);
 			numbered_ports.insert(it->first);
 			goto found_numbered_port;
@@ -1799,20 +1857,22 @@ void dump_cell(std::ostream &f, std::string indent, RTLIL::Cell *cell)
 		if (numbered_ports.count(it->first))
 			continue;
 		if (!first_arg)
-			f << stringf(",");
+			f << ",";
 		first_arg = false;
-		f << stringf("\n%s  .%s(", indent.c_str(), id(it->first).c_str());
+		f << '\n' << indent << "  .";
+		dump_id(f, it->first);
+		f << '(';
 		if (it->second.size() > 0)
 			dump_sigspec(f, it->second);
-		f << stringf(")");
+		f << ")";
 	}
-	f << stringf("\n%s" ");\n", indent.c_str());
+	f << '\n' << indent << ");\n";
 
 	if (defparam && cell->parameters.size() > 0) {
 		for (auto it = cell->parameters.begin(); it != cell->parameters.end(); ++it) {
 			f << stringf("%sdefparam %s.%s = ", indent.c_str(), cell_name.c_str(), id(it->first).c_str());
 			dump_const(f, it->second);
-			f << stringf(";\n");
+			f << ";\n";
 		}
 	}
 
@@ -1832,19 +1892,19 @@ void dump_conn(std::ostream &f, std::string indent, const RTLIL::SigSpec &left,
 	if (simple_lhs) {
 		int offset = 0;
 		for (auto &chunk : left.chunks()) {
-			f << stringf("%s" "assign ", indent.c_str());
+			f << indent << "assign ";
 			dump_sigspec(f, chunk);
-			f << stringf(" = ");
+			f << " = ";
 			dump_sigspec(f, right.extract(offset, GetSize(chunk)));
-			f << stringf(";\n");
+			f << ";\n";
 			offset += GetSize(chunk);
 		}
 	} else {
-		f << stringf("%s" "assign ", indent.c_str());
+		f << indent << "assign ";
 		dump_sigspec(f, left);
-		f << stringf(" = ");
+		f << " = ";
 		dump_sigspec(f, right);
-		f << stringf(";\n");
+		f << ";\n";
 	}
 }
 
@@ -1855,16 +1915,16 @@ void dump_case_body(std::ostream &f, std::string indent, RTLIL::CaseRule *cs, bo
 	int number_of_stmts = cs->switches.size() + cs->actions.size();
 
 	if (!omit_trailing_begin && number_of_stmts >= 2)
-		f << stringf("%s" "begin\n", indent.c_str());
+		f << indent << "begin\n";
 
 	for (auto it = cs->actions.begin(); it != cs->actions.end(); ++it) {
 		if (it->first.size() == 0)
 			continue;
 		f << stringf("%s  ", indent.c_str());
 		dump_sigspec(f, it->first);
-		f << stringf(" = ");
+		f << " = ";
 		dump_sigspec(f, it->second);
-		f << stringf(";\n");
+		f << ";\n";
 	}
 
 	for (auto it = cs->switches.begin(); it != cs->switches.end(); ++it)
@@ -1874,25 +1934,25 @@ void dump_case_body(std::ostream &f, std::string indent, RTLIL::CaseRule *cs, bo
 		f << stringf("%s  /* empty */;\n", indent.c_str());
 
 	if (omit_trailing_begin || number_of_stmts >= 2)
-		f << stringf("%s" "end\n", indent.c_str());
+		f << indent << "end\n";
 }
 
 void dump_proc_switch(std::ostream &f, std::string indent, RTLIL::SwitchRule *sw)
 {
 	if (sw->signal.size() == 0) {
-		f << stringf("%s" "begin\n", indent.c_str());
+		f << indent << "begin\n";
 		for (auto it = sw->cases.begin(); it != sw->cases.end(); ++it) {
 			if ((*it)->compare.size() == 0)
 				dump_case_body(f, indent + "  ", *it);
 		}
-		f << stringf("%s" "end\n", indent.c_str());
+		f << indent << "end\n";
 		return;
 	}
 
 	dump_attributes(f, indent, sw->attributes);
-	f << stringf("%s" "casez (", indent.c_str());
+	f << indent << "casez (";
 	dump_sigspec(f, sw->signal);
-	f << stringf(")\n");
+	f << ")\n";
 
 	bool got_default = false;
 	for (auto it = sw->cases.begin(); it != sw->cases.end(); ++it) {
@@ -1906,15 +1966,15 @@ void dump_proc_switch(std::ostream &f, std::string indent, RTLIL::SwitchRule *sw
 			f << stringf("%s  ", indent.c_str());
 			for (size_t i = 0; i < (*it)->compare.size(); i++) {
 				if (i > 0)
-					f << stringf(", ");
+					f << ", ";
 				dump_sigspec(f, (*it)->compare[i]);
 			}
 		}
-		f << stringf(":\n");
+		f << ":\n";
 		dump_case_body(f, indent + "    ", *it);
 	}
 
-	f << stringf("%s" "endcase\n", indent.c_str());
+	f << indent << "endcase\n";
 }
 
 void case_body_find_regs(RTLIL::CaseRule *cs)
@@ -1958,15 +2018,15 @@ void dump_process(std::ostream &f, std::string indent, RTLIL::Process *proc, boo
 		if (sync->type == RTLIL::STa) {
 			f << stringf("%s" "always%s begin\n", indent.c_str(), systemverilog ? "_comb" : " @*");
 		} else if (sync->type == RTLIL::STi) {
-			f << stringf("%s" "initial begin\n", indent.c_str());
+			f << indent << "initial begin\n";
 		} else {
 			f << stringf("%s" "always%s @(", indent.c_str(), systemverilog ? "_ff" : "");
 			if (sync->type == RTLIL::STp || sync->type == RTLIL::ST1)
-				f << stringf("posedge ");
+				f << "posedge ";
 			if (sync->type == RTLIL::STn || sync->type == RTLIL::ST0)
-				f << stringf("negedge ");
+				f << "negedge ";
 			dump_sigspec(f, sync->signal);
-			f << stringf(") begin\n");
+			f << ") begin\n";
 		}
 		std::string ends = indent + "end\n";
 		indent += "  ";
@@ -1974,7 +2034,7 @@ void dump_process(std::ostream &f, std::string indent, RTLIL::Process *proc, boo
 		if (sync->type == RTLIL::ST0 || sync->type == RTLIL::ST1) {
 			f << stringf("%s" "if (%s", indent.c_str(), sync->type == RTLIL::ST0 ? "!" : "");
 			dump_sigspec(f, sync->signal);
-			f << stringf(") begin\n");
+			f << ") begin\n";
 			ends = indent + "end\n" + ends;
 			indent += "  ";
 		}
@@ -1985,7 +2045,7 @@ void dump_process(std::ostream &f, std::string indent, RTLIL::Process *proc, boo
 				if (sync2->type == RTLIL::ST0 || sync2->type == RTLIL::ST1) {
 					f << stringf("%s" "if (%s", indent.c_str(), sync2->type == RTLIL::ST1 ? "!" : "");
 					dump_sigspec(f, sync2->signal);
-					f << stringf(") begin\n");
+					f << ") begin\n";
 					ends = indent + "end\n" + ends;
 					indent += "  ";
 				}
@@ -1997,9 +2057,9 @@ void dump_process(std::ostream &f, std::string indent, RTLIL::Process *proc, boo
 				continue;
 			f << stringf("%s  ", indent.c_str());
 			dump_sigspec(f, it->first);
-			f << stringf(" <= ");
+			f << " <= ";
 			dump_sigspec(f, it->second);
-			f << stringf(";\n");
+			f << ";\n";
 		}
 
 		f << stringf("%s", ends.c_str());
@@ -2029,13 +2089,13 @@ void dump_module(std::ostream &f, std::string indent, RTLIL::Module *module)
 				"changes in simulation behavior are possible! Use \"proc\" to convert\n"
 				"processes to logic networks and registers.\n", log_id(module));
 
-	f << stringf("\n");
+	f << "\n";
 	for (auto it = module->processes.begin(); it != module->processes.end(); ++it)
 		dump_process(f, indent + "  ", it->second, true);
 
 	if (!noexpr)
 	{
-		std::set<std::pair<RTLIL::Wire*,int>> reg_bits;
+		pool<std::pair<RTLIL::Wire*,int>> reg_bits;
 		for (auto cell : module->cells())
 		{
 			if (!RTLIL::builtin_ff_cell_types().count(cell->type) || !cell->hasPort(ID::Q) || cell->type.in(ID($ff), ID($_FF_)))
@@ -2062,25 +2122,30 @@ void dump_module(std::ostream &f, std::string indent, RTLIL::Module *module)
 	}
 
 	dump_attributes(f, indent, module->attributes, '\n', /*modattr=*/true);
-	f << stringf("%s" "module %s(", indent.c_str(), id(module->name, false).c_str());
-	bool keep_running = true;
-	int cnt = 0;
-	for (int port_id = 1; keep_running; port_id++) {
-		keep_running = false;
-		for (auto wire : module->wires()) {
-			if (wire->port_id == port_id) {
-				if (port_id != 1)
-					f << stringf(", ");
-				f << stringf("%s", id(wire->name).c_str());
-				keep_running = true;
-				if (cnt==20) { f << stringf("\n"); cnt = 0; } else cnt++;
-				continue;
-			}
-		}
+	f << indent << "module ";
+	dump_id(f, module->name, false);
+	f << '(';
+	std::vector<RTLIL::Wire*> port_wires;
+	for (auto wire : module->wires())
+		if (wire->port_id > 0)
+			port_wires.push_back(wire);
+	std::stable_sort(port_wires.begin(), port_wires.end(), [](RTLIL::Wire *a, RTLIL::Wire *b) { return a->port_id < b->port_id; });
+	int cnt = 0, last_port_id = 0;
+	for (auto wire : port_wires) {
+		// stop at the first missing port id
+		if (wire->port_id > last_port_id + 1)
+			break;
+		last_port_id = wire->port_id;
+		if (wire->port_id != 1)
+			f << ", ";
+		dump_id(f, wire->name);
+		if (cnt==20) { f << "\n"; cnt = 0; } else cnt++;
 	}
-	f << stringf(");\n");
+	f << ");\n";
 	if (!systemverilog && !module->processes.empty()) {
-		initial_id = NEW_ID;
+		// named after the module contents rather than NEW_ID, so that the
+		// output does not depend on the order in which modules are dumped
+		initial_id = module->uniquify(ID($verilog_initial_trigger));
 		f << indent + "  " << "reg " << id(initial_id) << " = 0;\n";
 	}
 
@@ -2099,14 +2164,14 @@ void dump_module(std::ostream &f, std::string indent, RTLIL::Module *module)
 	for (auto it = module->connections().begin(); it != module->connections().end(); ++it)
 		dump_conn(f, indent + "  ", it->first, it->second);
 
-	f << stringf("%s" "endmodule\n", indent.c_str());
+	f << indent << "endmodule\n";
 	active_module = NULL;
 	active_sigmap.clear();
 	active_initdata.clear();
 }
 
 struct VerilogBackend : public Backend {
-	VerilogBackend() : Backend("verilog", "write design to Verilog file") { }
+	VerilogBackend() : Backend("verilog", "write design to Verilog file") { module_local(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -2187,6 +2252,12 @@ struct VerilogBackend : public Backend {
 		log("    -v\n");
 		log("        verbose output (print new names of all renamed wires and cells)\n");
 		log("\n");
+		log("When Yosys runs with more than one thread (\"yosys -j <threads>\"), the\n");
+		log("modules are rendered in parallel into per-module buffers, which are written\n");
+		log("to the output file in module order. Only a few modules per thread are held\n");
+		log("in memory at a time. Modules are dumped one after the other with -extmem,\n");
+		log("which numbers the memory initialization files in module order.\n");
+		log("\n");
 		log("Note that RTLIL processes can't always be mapped directly to Verilog\n");
 		log("always blocks. This frontend should only be used to export an RTLIL\n");
 		log("netlist, i.e. after the \"proc\" pass has been used to convert all\n");
@@ -2194,6 +2265,37 @@ struct VerilogBackend : public Backend {
 		log("this command is called on a design with RTLIL processes.\n");
 		log("\n");
 	}
+	// Render windows of a few modules per thread into string buffers in
+	// parallel, and write each window to f in module order before rendering
+	// the next, so that memory use does not grow with the size of the design.
+	void dump_modules_parallel(std::ostream &f, const std::vector<RTLIL::Module*> &modules)
+	{
+		int window = 4 * yosys_threads;
+		std::vector<std::ostringstream> buffers(window);
+		dict<RTLIL::Module*, int> buffer_index;
+
+		for (int offset = 0; offset < GetSize(modules); offset += window)
+		{
+			std::vector<RTLIL::Module*> batch(modules.begin() + offset, modules.begin() + std::min(offset + window, GetSize(modules)));
+			buffer_index.clear();
+			for (int i = 0; i < GetSize(batch); i++)
+				buffer_index[batch[i]] = i;
+
+			run_on_modules(batch, [&](RTLIL::Module *module) {
+				log("Dumping module `%s'.\n", module->name.c_str());
+				dump_module(buffers[buffer_index.at(module)], "", module);
+			});
+
+			for (int i = 0; i < GetSize(batch); i++) {
+				// streaming an empty buffer would set the failbit on f
+				if (buffers[i].tellp() > 0)
+					f << buffers[i].rdbuf();
+				buffers[i].str(std::string());
+				buffers[i].clear();
+			}
+		}
+	}
+
 	void execute(std::ostream *&f, std::string filename, std::vector<std::string> args, RTLIL::Design *design) override
 	{
 		log_header(design, "Executing Verilog backend.\n");
@@ -2309,8 +2411,8 @@ struct VerilogBackend : public Backend {
 
 		design->sort();
 
-		*f << stringf("/* Generated by %s */\n", yosys_version_str);
-		for (auto module : design->modules()) {
+		std::vector<RTLIL::Module*> modules;
+		for (auto module : design->modules_readonly()) {
 			if (module->get_blackbox_attribute() != blackboxes)
 				continue;
 			if (selected && !design->selected_whole_module(module->name)) {
@@ -2318,10 +2420,18 @@ struct VerilogBackend : public Backend {
 					log_cmd_error("Can't handle partially selected module %s!\n", log_id(module->name));
 				continue;
 			}
-			log("Dumping module `%s'.\n", module->name.c_str());
-			dump_module(*f, "", module);
+			modules.push_back(module);
 		}
 
+		*f << stringf("/* Generated by %s */\n", yosys_version_str);
+		if (yosys_threads > 1 && !extmem)
+			dump_modules_parallel(*f, modules);
+		else
+			for (auto module : modules) {
+				log("Dumping module `%s'.\n", module->name.c_str());
+				dump_module(*f, "", module);
+			}
+
 		auto_name_map.clear();
 		reg_wires.clear();
 	}
@@ -29,8 +29,15 @@
 
 #include "kernel/yosys.h"
 #include "libs/sha1/sha1.h"
+#include "frontends/rtlil/rtlil_binary.h"
 #include "ast.h"
 
+#if defined(_WIN32)
+#  include <direct.h>
+#else
+#  include <sys/stat.h>
+#endif
+
 YOSYS_NAMESPACE_BEGIN
 
 using namespace AST;
@@ -197,6 +204,112 @@ bool AstNode::get_bool_attribute(RTLIL::IdString id)
 	return attr->integer != 0;
 }
 
+const std::string *AstFilename::intern(const std::string &name)
+{
+	// consecutive nodes almost always come from the same file
+	static std::unordered_set<std::string> names;
+	static const std::string *last = nullptr;
+	if (last == nullptr || *last != name)
+		last = &*names.insert(name).first;
+	return last;
+}
+
+static const std::vector<int> no_multirange_dimensions;
+static const std::vector<bool> no_multirange_swapped;
+
+const std::vector<int> &AstNode::multirange_dimensions() const
+{
+	return extra_ ? extra_->multirange_dimensions : no_multirange_dimensions;
+}
+
+const std::vector<bool> &AstNode::multirange_swapped() const
+{
+	return extra_ ? extra_->multirange_swapped : no_multirange_swapped;
+}
+
+// Nodes come from a pooled allocator shared by all ASTs of the process, not
+// from an arena per elaboration: nodes move between trees (e.g. the globals of
+// a design are cloned into every module) and AST modules keep their tree for
+// as long as they are in a design, so no elaboration owns its nodes. Released
+// nodes are reused, and the slabs are returned once the last node is gone,
+// e.g. after "design -reset". The pool is never destroyed otherwise, as
+// designs with AST modules may outlive static destructors. Elaboration runs
+// on the main thread only, but the pool is locked anyway, as it is shared by
+// all designs.
+static ys_mutex node_arena_mutex;
+static object_arena<AstNode> *node_arena;
+static int64_t node_arena_allocated;
+static int node_arena_peak;
+static size_t node_arena_peak_slab_bytes;
+static int node_extra_live, node_extra_peak;
+
+void *AstNode::operator new(size_t size)
+{
+	log_assert(size == sizeof(AstNode));
+	ys_lock_guard lock(node_arena_mutex);
+	if (node_arena == nullptr)
+		node_arena = new object_arena<AstNode>;
+	node_arena_allocated++;
+	node_arena_peak = std::max(node_arena_peak, node_arena->num_objects() + 1);
+	int num_slabs = node_arena->num_slabs();
+	void *p = node_arena->allocate();
+	if (node_arena->num_slabs() != num_slabs)
+		node_arena_peak_slab_bytes = std::max(node_arena_peak_slab_bytes, node_arena->slab_bytes());
+	return p;
+}
+
+void AstNode::operator delete(void *p)
+{
+	if (p == nullptr)
+		return;
+	ys_lock_guard lock(node_arena_mutex);
+	node_arena->deallocate(p);
+	if (node_arena->num_objects() == 0) {
+		delete node_arena;
+		node_arena = nullptr;
+	}
+}
+
+AstNode::arena_stats_t AstNode::arena_stats(bool reset_peak)
+{
+	ys_lock_guard lock(node_arena_mutex);
+	arena_stats_t stats;
+	stats.allocated = node_arena_allocated;
+	stats.live = node_arena ? node_arena->num_objects() : 0;
+	stats.peak_live = node_arena_peak;
+	stats.slab_bytes = node_arena ? node_arena->slab_bytes() : 0;
+	stats.peak_slab_bytes = node_arena_peak_slab_bytes;
+	stats.extra_live = node_extra_live;
+	stats.peak_extra_live = node_extra_peak;
+	if (reset_peak) {
+		node_arena_peak = stats.live;
+		node_arena_peak_slab_bytes = stats.slab_bytes;
+		node_extra_peak = stats.extra_live;
+	}
+	return stats;
+}
+
+void *AstNodeExtra::operator new(size_t size)
+{
+	{
+		ys_lock_guard lock(node_arena_mutex);
+		node_extra_live++;
+		node_extra_peak = std::max(node_extra_peak, node_extra_live);
+	}
+	return ::operator new(size);
+}
+
+void AstNodeExtra::operator delete(void *p)
+{
+	if (p == nullptr)
+		return;
+	{
+		ys_lock_guard lock(node_arena_mutex);
+		node_extra_live--;
+	}
+	::operator delete(p);
+}
+
 // create new node (AstNode constructor)
 // (the optional child arguments make it easier to create AST trees)
 AstNode::AstNode(AstNodeType type, AstNode *child1, AstNode *child2, AstNode *child3, AstNode *child4)
@@ -336,15 +449,15 @@ void AstNode::dumpAst(FILE *f, std::string indent) const
 		fprintf(f, " int=%u", (int)integer);
 	if (realvalue != 0)
 		fprintf(f, " real=%e", realvalue);
-	if (!multirange_dimensions.empty()) {
+	if (!multirange_dimensions().empty()) {
 		fprintf(f, " multirange=[");
-		for (int v : multirange_dimensions)
+		for (int v : multirange_dimensions())
 			fprintf(f, " %d", v);
 		fprintf(f, " ]");
 	}
-	if (!multirange_swapped.empty()) {
+	if (!multirange_swapped().empty()) {
 		fprintf(f, " multirange_swapped=[");
-		for (bool v : multirange_swapped)
+		for (bool v : multirange_swapped())
 			fprintf(f, " %d", v);
 		fprintf(f, " ]");
 	}
@@ -859,7 +972,7 @@ RTLIL::Const AstNode::asAttrConst() const
 	log_assert(type == AST_CONSTANT);
 
 	RTLIL::Const val;
-	val.bits = bits;
+	val.bits() = bits;
 
 	if (is_string) {
 		val.flags |= RTLIL::CONST_FLAG_STRING;
@@ -912,7 +1025,7 @@ uint64_t AstNode::asInt(bool is_signed)
 		uint64_t ret = 0;
 
 		for (int i = 0; i < 64; i++)
-			if (v.bits.at(i) == RTLIL::State::S1)
+			if (v.bits().at(i) == RTLIL::State::S1)
 				ret |= uint64_t(1) << i;
 
 		return ret;
@@ -930,15 +1043,15 @@ double AstNode::asReal(bool is_signed)
 	{
 		RTLIL::Const val(bits);
 
-		bool is_negative = is_signed && !val.bits.empty() && val.bits.back() == RTLIL::State::S1;
+		bool is_negative = is_signed && !val.empty() && val.bits().back() == RTLIL::State::S1;
 		if (is_negative)
-			val = const_neg(val, val, false, false, val.bits.size());
+			val = const_neg(val, val, false, false, val.size());
 
 		double v = 0;
-		for (size_t i = 0; i < val.bits.size(); i++)
+		for (int i = 0; i < GetSize(val); i++)
 			// IEEE Std 1800-2012 Par 6.12.2: Individual bits that are x or z in
 			// the net or the variable shall be treated as zero upon conversion.
-			if (val.bits.at(i) == RTLIL::State::S1)
+			if (val.bits().at(i) == RTLIL::State::S1)
 				v += exp2(i);
 		if (is_negative)
 			v *= -1;
@@ -961,15 +1074,15 @@ RTLIL::Const AstNode::realAsConst(int width)
 #else
 	if (!std::isfinite(v)) {
 #endif
-		result.bits = std::vector<RTLIL::State>(width, RTLIL::State::Sx);
+		result.bits() = std::vector<RTLIL::State>(width, RTLIL::State::Sx);
 	} else {
 		bool is_negative = v < 0;
 		if (is_negative)
 			v *= -1;
 		for (int i = 0; i < width; i++, v /= 2)
-			result.bits.push_back((fmod(floor(v), 2) != 0) ? RTLIL::State::S1 : RTLIL::State::S0);
+			result.bits().push_back((fmod(floor(v), 2) != 0) ? RTLIL::State::S1 : RTLIL::State::S0);
 		if (is_negative)
-			result = const_neg(result, result, false, false, result.bits.size());
+			result = const_neg(result, result, false, false, result.size());
 	}
 	return result;
 }
@@ -1600,8 +1713,11 @@ RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdStr
 			explode_interface_port(new_ast, intfmodule, intfname, modport);
 		}
 
-		process_module(design, new_ast, false);
-		design->module(modname)->check();
+		if (has_interfaces) {
+			process_module(design, new_ast, false);
+			design->module(modname)->check();
+		} else
+			process_derived_module(design, new_ast, false);
 
 		RTLIL::Module* mod = design->module(modname);
 
@@ -1641,6 +1757,222 @@ RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdStr
 	return modname;
 }
 
+// Serialize everything in the AST that can affect the elaborated module into
+// buf. Returns false for constructs that read files or call other code during
+// elaboration, as the result then does not only depend on the AST.
+static bool derive_cache_key_node(const AstNode *node, std::string &buf)
+{
+	if (node->type == AST_DPI_FUNCTION)
+		return false;
+	if ((node->type == AST_FCALL || node->type == AST_TCALL) && (node->str == "\\$readmemh" || node->str == "\\$readmemb"))
+		return false;
+
+	buf += stringf("(%d %zu:%s %d:", node->type, node->str.size(), node->str.c_str(), GetSize(node->bits));
+	for (auto bit : node->bits)
+		buf += char('0' + bit);
+	buf += stringf(" %d%d%d%d%d%d%d%d%d%d%d%d%d%d %d %d %d %u %.17g",
+			node->is_input, node->is_output, node->is_reg, node->is_logic, node->is_signed, node->is_string,
+			node->is_wand, node->is_wor, node->range_valid, node->range_swapped, node->was_checked, node->is_unsized,
+			node->is_custom_type, node->is_enum, node->port_id, node->range_left, node->range_right, node->integer,
+			node->realvalue);
+	for (int dim : node->multirange_dimensions())
+		buf += stringf(" %d", dim);
+	for (bool swapped : node->multirange_swapped())
+		buf += swapped ? " s" : " n";
+
+	// the location ends up in the src attributes
+	buf += stringf(" %zu:%s %d.%d-%d.%d", node->filename.size(), node->filename.c_str(), node->location.first_line,
+			node->location.first_column, node->location.last_line, node->location.last_column);
+
+	// std::map<IdString, ...> is ordered by the IdString index, which is not
+	// stable between runs
+	std::vector<std::pair<std::string, const AstNode*>> attrs;
+	for (auto &it : node->attributes)
+		attrs.emplace_back(it.first.str(), it.second);
+	std::sort(attrs.begin(), attrs.end());
+	for (auto &it : attrs) {
+		buf += stringf(" @%zu:%s", it.first.size(), it.first.c_str());
+		if (!derive_cache_key_node(it.second, buf))
+			return false;
+	}
+
+	for (auto child : node->children) {
+		buf += ' ';
+		if (child == nullptr)
+			buf += '-';
+		else if (!derive_cache_key_node(child, buf))
+			return false;
+	}
+	buf += ')';
+	return true;
+}
+
+// Return the file of the derive cache (scratchpad variable "ast.derive_cache")
+// that holds the module elaborated from new_ast, or an empty string if the
+// cache is disabled or the module can not be cached.
+std::string AstModule::derive_cache_file(RTLIL::Design *design, const AstNode *new_ast) const
+{
+	std::string dir = design->scratchpad_get_string("ast.derive_cache");
+	if (dir.empty())
+		return std::string();
+
+	std::string key = stringf("%s\n%d%d%d%d%d%d%d%d%d%d%d\n", yosys_version_str, nolatches, nomeminit, nomem2reg, mem2reg,
+			noblackbox, lib, nowb, noopt, icells, pwires, autowire);
+	if (!derive_cache_key_node(new_ast, key))
+		return std::string();
+
+	if (!check_file_exists(dir)) {
+#if defined(_WIN32)
+		mkdir(dir.c_str());
+#else
+		mkdir(dir.c_str(), 0777);
+#endif
+	}
+	return dir + "/" + sha1(key) + ".rtlilb";
+}
+
+// The messages and warnings of an elaboration are kept in a text file next to
+// the derive cache entry: a header line, then for each message a line with
+// its kind and the sizes of its prefix and text, followed by both. The kind is
+// one letter per LogCapture::kind_t.
+static const char derive_log_kinds[] = "LWHPO";
+
+static bool write_derive_log(const std::string &filename, const LogCapture &capture)
+{
+	std::string tmp_file = make_temp_file(filename + ".XXXXXX");
+	std::ofstream f(tmp_file, std::ios::binary);
+	f << "yosys-derive-log 1\n";
+	for (auto &it : capture.messages) {
+		const std::string &prefix = std::get<1>(it), &text = std::get<2>(it);
+		f << derive_log_kinds[std::get<0>(it)] << ' ' << prefix.size() << ' ' << text.size() << '\n';
+		f << prefix << text;
+	}
+	f.close();
+	if (f.fail() || std::rename(tmp_file.c_str(), filename.c_str()) != 0) {
+		std::remove(tmp_file.c_str());
+		return false;
+	}
+	return true;
+}
+
+static bool read_derive_log(const std::string &filename, LogCapture &capture)
+{
+	std::ifstream f(filename, std::ios::binary);
+	std::string line;
+	if (!std::getline(f, line) || line != "yosys-derive-log 1")
+		return false;
+
+	char kind;
+	size_t prefix_size, text_size;
+	while (f >> kind >> prefix_size >> text_size) {
+		const char *kind_ptr = strchr(derive_log_kinds, kind);
+		if (kind == 0 || kind_ptr == nullptr || f.get() != '\n')
+			return false;
+		std::string prefix(prefix_size, 0), text(text_size, 0);
+		if (!f.read(&prefix[0], prefix_size) || !f.read(&text[0], text_size))
+			return false;
+		capture.messages.push_back(std::make_tuple(LogCapture::kind_t(kind_ptr - derive_log_kinds), prefix, text));
+	}
+	return f.eof();
+}
+
+// Elaborate new_ast (as returned by derive_common, renamed to the derived
+// module name) into the design, or load it from the derive cache. Takes
+// ownership of new_ast when the module is loaded from the cache.
+void AstModule::process_derived_module(RTLIL::Design *design, AstNode *&new_ast, bool quiet)
+{
+	std::string modname = new_ast->str;
+	std::string cache_file = derive_cache_file(design, new_ast);
+	std::string log_file = cache_file.substr(0, cache_file.rfind('.')) + ".log";
+
+	if (!cache_file.empty()) {
+		AstModule *module = new AstModule;
+		LogCapture cached_log;
+		bool corrupt = false;
+		if (read_derive_log(log_file, cached_log) && RTLIL_BINARY::read_module(cache_file, module, &corrupt)) {
+			// a temporary cache (scratchpad variable "ast.derive_cache_tmp")
+			// only passes on the results of "hierarchy -j" worker processes,
+			// the log looks as if the module was elaborated here
+			if (!quiet && !design->scratchpad_get_bool("ast.derive_cache_tmp"))
+				log("Loading module `%s' from derive cache file `%s'.\n", modname.c_str(), cache_file.c_str());
+			log_assert(module->name == modname);
+			module->ast = new_ast;
+			module->nolatches = nolatches;
+			module->nomeminit = nomeminit;
+			module->nomem2reg = nomem2reg;
+			module->mem2reg = mem2reg;
+			module->noblackbox = noblackbox;
+			module->lib = lib;
+			module->nowb = nowb;
+			module->noopt = noopt;
+			module->icells = icells;
+			module->pwires = pwires;
+			module->autowire = autowire;
+			design->add(module);
+			new_ast = nullptr;
+			// the messages of the elaboration, with warnings counted and
+			// checked against -w/-W/-e as if they just happened
+			cached_log.replay();
+			return;
+		}
+		module->ast = nullptr;
+		delete module;
+		if (corrupt) {
+			log("Discarding truncated or corrupt derive cache file `%s'.\n", cache_file.c_str());
+			std::remove(cache_file.c_str());
+		}
+	}
+
+	if (cache_file.empty()) {
+		process_module(design, new_ast, false, NULL, quiet);
+		design->module(modname)->check();
+		return;
+	}
+
+	int lookups = simplify_design_lookups;
+	LogCapture elaboration_log;
+	{
+		LogCaptureGuard guard(&elaboration_log);
+		try {
+			process_module(design, new_ast, false, NULL, quiet);
+		} catch (log_capture_error_exception &) {
+			guard.end();
+			elaboration_log.replay();
+			log_abort();
+		}
+	}
+
+	RTLIL::Module *mod = design->module(modname);
+	mod->check();
+
+	// Modules that depend on other modules in the design are not cached,
+	// neither are modules that will be reprocessed once the modules they
+	// instantiate become available.
+	bool cacheable = lookups == simplify_design_lookups;
+	for (auto cell : mod->cells())
+		if (cell->has_attribute(ID::reprocess_after))
+			cacheable = false;
+
+	// the log is written first, a cache entry is only used when both exist
+	bool cache_failed = false;
+	if (cacheable && !write_derive_log(log_file, elaboration_log))
+		cache_failed = true;
+	else if (cacheable) {
+		std::string tmp_file = make_temp_file(cache_file + ".XXXXXX");
+		std::ofstream f(tmp_file, std::ios::binary);
+		RTLIL_BINARY::write_design(f, {mod});
+		f.close();
+		if (f.fail() || std::rename(tmp_file.c_str(), cache_file.c_str()) != 0) {
+			cache_failed = true;
+			std::remove(tmp_file.c_str());
+		}
+	}
+
+	elaboration_log.replay();
+	if (cache_failed)
+		log_warning("Can't write derive cache file `%s'.\n", cache_file.c_str());
+}
+
 // create a new parametric module (when needed) and return the name of the generated module - without support for interfaces
 RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, bool /*mayfail*/)
 {
@@ -1651,8 +1983,7 @@ RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdStr
 
 	if (!design->has(modname)) {
 		new_ast->str = modname;
-		process_module(design, new_ast, false, NULL, quiet);
-		design->module(modname)->check();
+		process_derived_module(design, new_ast, quiet);
 	} else if (!quiet) {
 		log("Found cached RTLIL representation for module `%s'.\n", modname.c_str());
 	}
@@ -1672,7 +2003,7 @@ static std::string serialize_param_value(const RTLIL::Const &val) {
 	res += stringf("%d", GetSize(val));
 	res.push_back('\'');
 	for (int i = GetSize(val) - 1; i >= 0; i--) {
-		switch (val.bits[i]) {
+		switch (val[i]) {
 			case RTLIL::State::S0: res.push_back('0'); break;
 			case RTLIL::State::S1: res.push_back('1'); break;
 			case RTLIL::State::Sx: res.push_back('x'); break;
@@ -1771,7 +2102,7 @@ std::string AstModule::derive_common(RTLIL::Design *design, const dict<RTLIL::Id
 		} else if ((it->second.flags & RTLIL::CONST_FLAG_STRING) != 0)
 			child->children[0] = AstNode::mkconst_str(it->second.decode_string());
 		else
-			child->children[0] = AstNode::mkconst_bits(it->second.bits, (it->second.flags & RTLIL::CONST_FLAG_SIGNED) != 0);
+			child->children[0] = AstNode::mkconst_bits(it->second.to_bits(), (it->second.flags & RTLIL::CONST_FLAG_SIGNED) != 0);
 		rewritten.insert(it->first);
 	}
 
@@ -1784,7 +2115,7 @@ std::string AstModule::derive_common(RTLIL::Design *design, const dict<RTLIL::Id
 			if ((param.second.flags & RTLIL::CONST_FLAG_STRING) != 0)
 				defparam->children.push_back(AstNode::mkconst_str(param.second.decode_string()));
 			else
-				defparam->children.push_back(AstNode::mkconst_bits(param.second.bits, (param.second.flags & RTLIL::CONST_FLAG_SIGNED) != 0));
+				defparam->children.push_back(AstNode::mkconst_bits(param.second.to_bits(), (param.second.flags & RTLIL::CONST_FLAG_SIGNED) != 0));
 			new_ast->children.push_back(defparam);
 		}
 
@@ -174,6 +174,45 @@ namespace AST
 	// convert an node type to a string (e.g. for debug output)
 	std::string type2str(AstNodeType type);
 
+	// The name of the source file of an AST node. Nodes share one interned
+	// copy of each file name instead of holding a std::string each.
+	struct AstFilename
+	{
+		AstFilename() : name_(intern(std::string())) { }
+		AstFilename(const std::string &name) : name_(intern(name)) { }
+		AstFilename &operator=(const std::string &name) { name_ = intern(name); return *this; }
+
+		operator const std::string&() const { return *name_; }
+		const std::string &str() const { return *name_; }
+		const char *c_str() const { return name_->c_str(); }
+		size_t size() const { return name_->size(); }
+		bool empty() const { return name_->empty(); }
+
+	private:
+		const std::string *name_;
+		static const std::string *intern(const std::string &name);
+	};
+
+	// Node content that only few nodes use, allocated when it is first set.
+	struct AstNodeExtra
+	{
+		// if this is a multirange memory then this vector contains offset and length of each dimension
+		std::vector<int> multirange_dimensions;
+		std::vector<bool> multirange_swapped; // true if range is swapped, not used for structs
+
+		// counted for "bench -ast" (see ast.cc)
+		static void *operator new(size_t size);
+		static void operator delete(void *p);
+	};
+
+	// owning pointer to an AstNodeExtra that is copied along with its node
+	struct AstNodeExtraPtr : std::unique_ptr<AstNodeExtra>
+	{
+		AstNodeExtraPtr() { }
+		AstNodeExtraPtr(const AstNodeExtraPtr &other) : std::unique_ptr<AstNodeExtra>(other ? new AstNodeExtra(*other) : nullptr) { }
+		AstNodeExtraPtr &operator=(const AstNodeExtraPtr &other) { reset(other ? new AstNodeExtra(*other) : nullptr); return *this; }
+	};
+
 	// The AST is built using instances of this struct
 	struct AstNode
 	{
@@ -201,9 +240,11 @@ namespace AST
 		// set for IDs typed to an enumeration, not used
 		bool is_enum;
 
-		// if this is a multirange memory then this vector contains offset and length of each dimension
-		std::vector<int> multirange_dimensions;
-		std::vector<bool> multirange_swapped; // true if range is swapped, not used for structs
+		// rarely used node content, see AstNodeExtra; use extra() to modify it
+		AstNodeExtraPtr extra_;
+		AstNodeExtra &extra() { if (!extra_) extra_.reset(new AstNodeExtra); return *extra_; }
+		const std::vector<int> &multirange_dimensions() const;
+		const std::vector<bool> &multirange_swapped() const;
 
 		// this is set by simplify and used during RTLIL generation
 		AstNode *id2ast;
@@ -217,7 +258,7 @@ namespace AST
 		// this is the original sourcecode location that resulted in this AST node
 		// it is automatically set by the constructor using AST::current_filename and
 		// the AST::get_line_num() callback function.
-		std::string filename;
+		AstFilename filename;
 		AstSrcLocType location;
 
 		// creating and deleting nodes
@@ -227,6 +268,19 @@ namespace AST
 		void delete_children();
 		~AstNode();
 
+		// nodes are allocated from a pooled allocator shared by all ASTs (see ast.cc)
+		static void *operator new(size_t size);
+		static void operator delete(void *p);
+
+		// statistics for "bench -ast"
+		struct arena_stats_t {
+			int64_t allocated;
+			int live, peak_live;
+			size_t slab_bytes, peak_slab_bytes;
+			int extra_live, peak_extra_live;
+		};
+		static arena_stats_t arena_stats(bool reset_peak = false);
+
 		enum mem2reg_flags
 		{
 			/* status flags */
@@ -350,6 +404,8 @@ namespace AST
 		RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, bool mayfail) override;
 		RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, const dict<RTLIL::IdString, RTLIL::Module*> &interfaces, const dict<RTLIL::IdString, RTLIL::IdString> &modports, bool mayfail) override;
 		std::string derive_common(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, AstNode **new_ast_out, bool quiet = false);
+		std::string derive_cache_file(RTLIL::Design *design, const AstNode *new_ast) const;
+		void process_derived_module(RTLIL::Design *design, AstNode *&new_ast, bool quiet);
 		void expand_interfaces(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Module *> &local_interfaces) override;
 		bool reprocess_if_necessary(RTLIL::Design *design) override;
 		RTLIL::Module *clone() const override;
@@ -388,6 +444,11 @@ namespace AST
 	// used to provide simplify() access to the current design for looking up
 	// modules, ports, wires, etc.
 	void set_simplify_design_context(const RTLIL::Design *design);
+
+	// number of cell module lookups in the design context that found a
+	// module; a derived module that depends on other modules is not stored
+	// in the derive cache
+	extern int simplify_design_lookups;
 }
 
 namespace AST_INTERNAL
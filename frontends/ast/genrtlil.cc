@@ -726,7 +726,7 @@ struct AST_INTERNAL::ProcessGenerator
 				RTLIL::Const priority_mask = RTLIL::Const(0, cur_idx);
 				for (int i = 0; i < portid; i++) {
 					int new_bit = port_map[std::make_pair(memid, i)];
-					priority_mask.bits[new_bit] = orig_priority_mask.bits[i];
+					priority_mask.bits()[new_bit] = orig_priority_mask.bits()[i];
 				}
 				action.priority_mask = priority_mask;
 				sync->mem_write_actions.push_back(action);
@@ -1383,7 +1383,6 @@ RTLIL::SigSpec AstNode::genRTLIL(int width_hint, bool sign_hint)
 			if (id2ast->type == AST_AUTOWIRE && current_module->wires_.count(str) == 0) {
 				RTLIL::Wire *wire = current_module->addWire(str);
 				set_src_attr(wire, this);
-				wire->name = str;
 
 				// If we are currently processing a bind directive which wires up
 				// signals or parameters explicitly, rather than with .*, then
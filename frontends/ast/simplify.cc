@@ -140,7 +140,7 @@ std::string AstNode::process_format_str(const std::string &sformat, int next_arg
 						Const val = node_arg->bitsAsConst();
 
 						while (GetSize(val) % 4 != 0)
-							val.bits.push_back(State::S0);
+							val.bits().push_back(State::S0);
 
 						int len = GetSize(val) / 4;
 						for (int i = len; i < len_value; i++)
@@ -281,14 +281,14 @@ static int range_width(AstNode *node, AstNode *rnode)
 static void save_struct_array_width(AstNode *node, int width)
 {
 	// stash the stride for the array
-	node->multirange_dimensions.push_back(width);
+	node->extra().multirange_dimensions.push_back(width);
 
 }
 
 static int get_struct_array_width(AstNode *node)
 {
 	// the stride for the array, 1 if not an array
-	return (node->multirange_dimensions.empty() ? 1 : node->multirange_dimensions.back());
+	return (node->multirange_dimensions().empty() ? 1 : node->multirange_dimensions().back());
 
 }
 
@@ -568,6 +568,7 @@ static std::string prefix_id(const std::string &prefix, const std::string &str)
 
 // direct access to this global should be limited to the following two functions
 static const RTLIL::Design *simplify_design_context = nullptr;
+int AST::simplify_design_lookups = 0;
 
 void AST::set_simplify_design_context(const RTLIL::Design *design)
 {
@@ -578,7 +579,10 @@ void AST::set_simplify_design_context(const RTLIL::Design *design)
 // lookup the module with the given name in the current design context
 static const RTLIL::Module* lookup_module(const std::string &name)
 {
-	return simplify_design_context->module(name);
+	const RTLIL::Module *module = simplify_design_context->module(name);
+	if (module)
+		simplify_design_lookups++;
+	return module;
 }
 
 const RTLIL::Module* AstNode::lookup_cell_module()
@@ -1547,8 +1551,8 @@ bool AstNode::simplify(bool const_fold, bool at_zero, bool in_lvalue, int stage,
 					if (v->type == AST_CONSTANT && v->bits_only_01()) {
 						RTLIL::Const case_item_expr = v->bitsAsConst(width_hint, sign_hint);
 						RTLIL::Const match = const_eq(case_expr, case_item_expr, sign_hint, sign_hint, 1);
-						log_assert(match.bits.size() == 1);
-						if (match.bits.front() == RTLIL::State::S1) {
+						log_assert(match.size() == 1);
+						if (match.bits().front() == RTLIL::State::S1) {
 							while (i+1 < GetSize(children))
 								delete children[++i];
 							goto keep_const_cond;
@@ -1870,7 +1874,7 @@ bool AstNode::simplify(bool const_fold, bool at_zero, bool in_lvalue, int stage,
 		if (children[1]->type != AST_CONSTANT)
 			log_file_error(filename, location.first_line, "Right operand of to_bits expression is not constant!\n");
 		RTLIL::Const new_value = children[1]->bitsAsConst(children[0]->bitsAsConst().as_int(), children[1]->is_signed);
-		newNode = mkconst_bits(new_value.bits, children[1]->is_signed);
+		newNode = mkconst_bits(new_value.bits(), children[1]->is_signed);
 		goto apply_newNode;
 	}
 
@@ -1948,15 +1952,16 @@ bool AstNode::simplify(bool const_fold, bool at_zero, bool in_lvalue, int stage,
 	if (type == AST_MEMORY && children.size() > 1 && children[1]->type == AST_MULTIRANGE)
 	{
 		int total_size = 1;
-		multirange_dimensions.clear();
-		multirange_swapped.clear();
+		AstNodeExtra &ext = extra();
+		ext.multirange_dimensions.clear();
+		ext.multirange_swapped.clear();
 		for (auto range : children[1]->children) {
 			if (!range->range_valid)
 				log_file_error(filename, location.first_line, "Non-constant range on memory decl.\n");
-			multirange_dimensions.push_back(min(range->range_left, range->range_right));
-			multirange_dimensions.push_back(max(range->range_left, range->range_right) - min(range->range_left, range->range_right) + 1);
-			multirange_swapped.push_back(range->range_swapped);
-			total_size *= multirange_dimensions.back();
+			ext.multirange_dimensions.push_back(min(range->range_left, range->range_right));
+			ext.multirange_dimensions.push_back(max(range->range_left, range->range_right) - min(range->range_left, range->range_right) + 1);
+			ext.multirange_swapped.push_back(range->range_swapped);
+			total_size *= ext.multirange_dimensions.back();
 		}
 		delete children[1];
 		children[1] = new AstNode(AST_RANGE, AstNode::mkconst_int(0, true), AstNode::mkconst_int(total_size-1, true));
@@ -1969,23 +1974,23 @@ bool AstNode::simplify(bool const_fold, bool at_zero, bool in_lvalue, int stage,
 		AstNode *index_expr = nullptr;
 
 		integer = children[0]->children.size(); // save original number of dimensions for $size() etc.
-		for (int i = 0; 2*i < GetSize(id2ast->multirange_dimensions); i++)
+		for (int i = 0; 2*i < GetSize(id2ast->multirange_dimensions()); i++)
 		{
 			if (GetSize(children[0]->children) <= i)
 				log_file_error(filename, location.first_line, "Insufficient number of array indices for %s.\n", log_id(str));
 
 			AstNode *new_index_expr = children[0]->children[i]->children.at(0)->clone();
 
-			if (id2ast->multirange_dimensions[2*i])
-				new_index_expr = new AstNode(AST_SUB, new_index_expr, AstNode::mkconst_int(id2ast->multirange_dimensions[2*i], true));
+			if (id2ast->multirange_dimensions()[2*i])
+				new_index_expr = new AstNode(AST_SUB, new_index_expr, AstNode::mkconst_int(id2ast->multirange_dimensions()[2*i], true));
 
 			if (i == 0)
 				index_expr = new_index_expr;
 			else
-				index_expr = new AstNode(AST_ADD, new AstNode(AST_MUL, index_expr, AstNode::mkconst_int(id2ast->multirange_dimensions[2*i+1], true)), new_index_expr);
+				index_expr = new AstNode(AST_ADD, new AstNode(AST_MUL, index_expr, AstNode::mkconst_int(id2ast->multirange_dimensions()[2*i+1], true)), new_index_expr);
 		}
 
-		for (int i = GetSize(id2ast->multirange_dimensions)/2; i < GetSize(children[0]->children); i++)
+		for (int i = GetSize(id2ast->multirange_dimensions())/2; i < GetSize(children[0]->children); i++)
 			children.push_back(children[0]->children[i]->clone());
 
 		delete children[0];
@@ -2008,7 +2013,7 @@ bool AstNode::simplify(bool const_fold, bool at_zero, bool in_lvalue, int stage,
 				log_file_warning(filename, location.first_line, "converting real value %e to binary %s.\n",
 						children[0]->realvalue, log_signal(constvalue));
 				delete children[0];
-				children[0] = mkconst_bits(constvalue.bits, sign_hint);
+				children[0] = mkconst_bits(constvalue.bits(), sign_hint);
 				did_something = true;
 			}
 			if (children[0]->type == AST_CONSTANT) {
@@ -2016,7 +2021,7 @@ bool AstNode::simplify(bool const_fold, bool at_zero, bool in_lvalue, int stage,
 					RTLIL::SigSpec sig(children[0]->bits);
 					sig.extend_u0(width, children[0]->is_signed);
 					AstNode *old_child_0 = children[0];
-					children[0] = mkconst_bits(sig.as_const().bits, is_signed);
+					children[0] = mkconst_bits(sig.as_const().bits(), is_signed);
 					delete old_child_0;
 				}
 				children[0]->is_signed = is_signed;
@@ -3320,8 +3325,8 @@ skip_dynamic_range_lvalue_expansion:;
 				delete buf;
 
 				uint32_t result = 0;
-				for (size_t i = 0; i < arg_value.bits.size(); i++)
-					if (arg_value.bits.at(i) == RTLIL::State::S1)
+				for (int i = 0; i < GetSize(arg_value); i++)
+					if (arg_value.bits().at(i) == RTLIL::State::S1)
 						result = i + 1;
 
 				newNode = mkconst_int(result, true);
@@ -3402,7 +3407,7 @@ skip_dynamic_range_lvalue_expansion:;
 							// $size(), $left(), $right(), $high(), $low()
 							int dims = 1;
 							if (mem_range->type == AST_RANGE) {
-								if (id_ast->multirange_dimensions.empty()) {
+								if (id_ast->multirange_dimensions().empty()) {
 									if (!mem_range->range_valid)
 										log_file_error(filename, location.first_line, "Failed to detect width of memory access `%s'!\n", buf->str.c_str());
 									if (dim == 1) {
@@ -3412,12 +3417,12 @@ skip_dynamic_range_lvalue_expansion:;
 										low  = min(left, right);
 									}
 								} else {
-									dims = GetSize(id_ast->multirange_dimensions)/2;
+									dims = GetSize(id_ast->multirange_dimensions())/2;
 									if (dim <= dims) {
-										width_hint = id_ast->multirange_dimensions[2*dim-1];
-										high = id_ast->multirange_dimensions[2*dim-2] + id_ast->multirange_dimensions[2*dim-1] - 1;
-										low  = id_ast->multirange_dimensions[2*dim-2];
-										if (id_ast->multirange_swapped[dim-1]) {
+										width_hint = id_ast->multirange_dimensions()[2*dim-1];
+										high = id_ast->multirange_dimensions()[2*dim-2] + id_ast->multirange_dimensions()[2*dim-1] - 1;
+										low  = id_ast->multirange_dimensions()[2*dim-2];
+										if (id_ast->multirange_swapped()[dim-1]) {
 											left = low;
 											right = high;
 										} else {
@@ -4039,14 +4044,14 @@ replace_fcall_later:;
 		case AST_BIT_NOT:
 			if (children[0]->type == AST_CONSTANT) {
 				RTLIL::Const y = RTLIL::const_not(children[0]->bitsAsConst(width_hint, sign_hint), dummy_arg, sign_hint, false, width_hint);
-				newNode = mkconst_bits(y.bits, sign_hint);
+				newNode = mkconst_bits(y.bits(), sign_hint);
 			}
 			break;
 		case AST_TO_SIGNED:
 		case AST_TO_UNSIGNED:
 			if (children[0]->type == AST_CONSTANT) {
 				RTLIL::Const y = children[0]->bitsAsConst(width_hint, sign_hint);
-				newNode = mkconst_bits(y.bits, type == AST_TO_SIGNED);
+				newNode = mkconst_bits(y.bits(), type == AST_TO_SIGNED);
 			}
 			break;
 		if (0) { case AST_BIT_AND:  const_func = RTLIL::const_and;  }
@@ -4056,7 +4061,7 @@ replace_fcall_later:;
 			if (children[0]->type == AST_CONSTANT && children[1]->type == AST_CONSTANT) {
 				RTLIL::Const y = const_func(children[0]->bitsAsConst(width_hint, sign_hint),
 						children[1]->bitsAsConst(width_hint, sign_hint), sign_hint, sign_hint, width_hint);
-				newNode = mkconst_bits(y.bits, sign_hint);
+				newNode = mkconst_bits(y.bits(), sign_hint);
 			}
 			break;
 		if (0) { case AST_REDUCE_AND:  const_func = RTLIL::const_reduce_and;  }
@@ -4066,13 +4071,13 @@ replace_fcall_later:;
 		if (0) { case AST_REDUCE_BOOL: const_func = RTLIL::const_reduce_bool; }
 			if (children[0]->type == AST_CONSTANT) {
 				RTLIL::Const y = const_func(RTLIL::Const(children[0]->bits), dummy_arg, false, false, -1);
-				newNode = mkconst_bits(y.bits, false);
+				newNode = mkconst_bits(y.bits(), false);
 			}
 			break;
 		case AST_LOGIC_NOT:
 			if (children[0]->type == AST_CONSTANT) {
 				RTLIL::Const y = RTLIL::const_logic_not(RTLIL::Const(children[0]->bits), dummy_arg, children[0]->is_signed, false, -1);
-				newNode = mkconst_bits(y.bits, false);
+				newNode = mkconst_bits(y.bits(), false);
 			} else
 			if (children[0]->isConst()) {
 				newNode = mkconst_int(children[0]->asReal(sign_hint) == 0, false, 1);
@@ -4083,7 +4088,7 @@ replace_fcall_later:;
 			if (children[0]->type == AST_CONSTANT && children[1]->type == AST_CONSTANT) {
 				RTLIL::Const y = const_func(RTLIL::Const(children[0]->bits), RTLIL::Const(children[1]->bits),
 						children[0]->is_signed, children[1]->is_signed, -1);
-				newNode = mkconst_bits(y.bits, false);
+				newNode = mkconst_bits(y.bits(), false);
 			} else
 			if (children[0]->isConst() && children[1]->isConst()) {
 				if (type == AST_LOGIC_AND)
@@ -4100,7 +4105,7 @@ replace_fcall_later:;
 			if (children[0]->type == AST_CONSTANT && children[1]->type == AST_CONSTANT) {
 				RTLIL::Const y = const_func(children[0]->bitsAsConst(width_hint, sign_hint),
 						RTLIL::Const(children[1]->bits), sign_hint, type == AST_POW ? children[1]->is_signed : false, width_hint);
-				newNode = mkconst_bits(y.bits, sign_hint);
+				newNode = mkconst_bits(y.bits(), sign_hint);
 			} else
 			if (type == AST_POW && children[0]->isConst() && children[1]->isConst()) {
 				newNode = new AstNode(AST_REALVALUE);
@@ -4120,7 +4125,7 @@ replace_fcall_later:;
 				bool cmp_signed = children[0]->is_signed && children[1]->is_signed;
 				RTLIL::Const y = const_func(children[0]->bitsAsConst(cmp_width, cmp_signed),
 						children[1]->bitsAsConst(cmp_width, cmp_signed), cmp_signed, cmp_signed, 1);
-				newNode = mkconst_bits(y.bits, false);
+				newNode = mkconst_bits(y.bits(), false);
 			} else
 			if (children[0]->isConst() && children[1]->isConst()) {
 				bool cmp_signed = (children[0]->type == AST_REALVALUE || children[0]->is_signed) && (children[1]->type == AST_REALVALUE || children[1]->is_signed);
@@ -4145,7 +4150,7 @@ replace_fcall_later:;
 			if (children[0]->type == AST_CONSTANT && children[1]->type == AST_CONSTANT) {
 				RTLIL::Const y = const_func(children[0]->bitsAsConst(width_hint, sign_hint),
 						children[1]->bitsAsConst(width_hint, sign_hint), sign_hint, sign_hint, width_hint);
-				newNode = mkconst_bits(y.bits, sign_hint);
+				newNode = mkconst_bits(y.bits(), sign_hint);
 			} else
 			if (children[0]->isConst() && children[1]->isConst()) {
 				newNode = new AstNode(AST_REALVALUE);
@@ -4164,7 +4169,7 @@ replace_fcall_later:;
 		if (0) { case AST_NEG: const_func = RTLIL::const_neg; }
 			if (children[0]->type == AST_CONSTANT) {
 				RTLIL::Const y = const_func(children[0]->bitsAsConst(width_hint, sign_hint), dummy_arg, sign_hint, false, width_hint);
-				newNode = mkconst_bits(y.bits, sign_hint);
+				newNode = mkconst_bits(y.bits(), sign_hint);
 			} else
 			if (children[0]->isConst()) {
 				newNode = new AstNode(AST_REALVALUE);
@@ -4192,10 +4197,10 @@ replace_fcall_later:;
 							newNode->realvalue = choice->asReal(sign_hint);
 						} else {
 							RTLIL::Const y = choice->bitsAsConst(width_hint, sign_hint);
-							if (choice->is_string && y.bits.size() % 8 == 0 && sign_hint == false)
-								newNode = mkconst_str(y.bits);
+							if (choice->is_string && y.size() % 8 == 0 && sign_hint == false)
+								newNode = mkconst_str(y.bits());
 							else
-								newNode = mkconst_bits(y.bits, sign_hint);
+								newNode = mkconst_bits(y.bits(), sign_hint);
 						}
 					} else
 					if (choice->isConst()) {
@@ -4204,11 +4209,11 @@ replace_fcall_later:;
 				} else if (children[1]->type == AST_CONSTANT && children[2]->type == AST_CONSTANT) {
 					RTLIL::Const a = children[1]->bitsAsConst(width_hint, sign_hint);
 					RTLIL::Const b = children[2]->bitsAsConst(width_hint, sign_hint);
-					log_assert(a.bits.size() == b.bits.size());
-					for (size_t i = 0; i < a.bits.size(); i++)
-						if (a.bits[i] != b.bits[i])
-							a.bits[i] = RTLIL::State::Sx;
-					newNode = mkconst_bits(a.bits, sign_hint);
+					log_assert(a.size() == b.size());
+					for (int i = 0; i < GetSize(a); i++)
+						if (a.bits()[i] != b.bits()[i])
+							a.bits()[i] = RTLIL::State::Sx;
+					newNode = mkconst_bits(a.bits(), sign_hint);
 				} else if (children[1]->isConst() && children[2]->isConst()) {
 					newNode = new AstNode(AST_REALVALUE);
 					if (children[1]->asReal(sign_hint) == children[2]->asReal(sign_hint))
@@ -4229,7 +4234,7 @@ replace_fcall_later:;
 					val = children[1]->bitsAsUnsizedConst(width);
 				else
 					val = children[1]->bitsAsConst(width);
-				newNode = mkconst_bits(val.bits, children[1]->is_signed);
+				newNode = mkconst_bits(val.bits(), children[1]->is_signed);
 			}
 			break;
 		case AST_CONCAT:
@@ -4310,7 +4315,7 @@ AstNode *AstNode::readmem(bool is_readmemh, std::string mem_filename, AstNode *m
 #else
 		char slash = '/';
 #endif
-		std::string path = filename.substr(0, filename.find_last_of(slash)+1);
+		std::string path = filename.str().substr(0, filename.str().find_last_of(slash)+1);
 		f.open(path + mem_filename.c_str());
 		yosys_input_files.insert(path + mem_filename);
 	} else {
@@ -4809,7 +4814,7 @@ bool AstNode::mem2reg_as_needed_pass2(pool<AstNode*> &mem2reg_set, AstNode *mod,
 						target->str = str;
 						target->id2ast = id2ast;
 						target->was_checked = true;
-						block->children.push_back(new AstNode(AST_ASSIGN_EQ, target, mkconst_bits(data.extract(i*wordsz + pos, clen).bits, false)));
+						block->children.push_back(new AstNode(AST_ASSIGN_EQ, target, mkconst_bits(data.extract(i*wordsz + pos, clen).bits(), false)));
 						pos = epos;
 					}
 				}
@@ -5154,7 +5159,7 @@ bool AstNode::is_simple_const_expr()
 bool AstNode::replace_variables(std::map<std::string, AstNode::varinfo_t> &variables, AstNode *fcall, bool must_succeed)
 {
 	if (type == AST_IDENTIFIER && variables.count(str)) {
-		int offset = variables.at(str).offset, width = variables.at(str).val.bits.size();
+		int offset = variables.at(str).offset, width = variables.at(str).val.size();
 		if (!children.empty()) {
 			if (children.size() != 1 || children.at(0)->type != AST_RANGE) {
 				if (!must_succeed)
@@ -5177,7 +5182,7 @@ bool AstNode::replace_variables(std::map<std::string, AstNode::varinfo_t> &varia
 		offset -= variables.at(str).offset;
 		if (variables.at(str).range_swapped)
 			offset = -offset;
-		std::vector<RTLIL::State> &var_bits = variables.at(str).val.bits;
+		std::vector<RTLIL::State> &var_bits = variables.at(str).val.bits();
 		std::vector<RTLIL::State> new_bits(var_bits.begin() + offset, var_bits.begin() + offset + width);
 		AstNode *newNode = mkconst_bits(new_bits, variables.at(str).is_signed);
 		newNode->cloneInto(this);
@@ -5307,7 +5312,7 @@ AstNode *AstNode::eval_const_function(AstNode *fcall, bool must_succeed)
 			}
 
 			if (stmt->children.at(0)->children.empty()) {
-				variables[stmt->children.at(0)->str].val = stmt->children.at(1)->bitsAsConst(variables[stmt->children.at(0)->str].val.bits.size());
+				variables[stmt->children.at(0)->str].val = stmt->children.at(1)->bitsAsConst(variables[stmt->children.at(0)->str].val.size());
 			} else {
 				AstNode *range = stmt->children.at(0)->children.at(0);
 				if (!range->range_valid) {
@@ -5319,12 +5324,12 @@ AstNode *AstNode::eval_const_function(AstNode *fcall, bool must_succeed)
 				int offset = min(range->range_left, range->range_right);
 				int width = std::abs(range->range_left - range->range_right) + 1;
 				varinfo_t &v = variables[stmt->children.at(0)->str];
-				RTLIL::Const r = stmt->children.at(1)->bitsAsConst(v.val.bits.size());
+				RTLIL::Const r = stmt->children.at(1)->bitsAsConst(v.val.size());
 				for (int i = 0; i < width; i++) {
 					int index = i + offset - v.offset;
 					if (v.range_swapped)
 						index = -index;
-					v.val.bits.at(index) = r.bits.at(i);
+					v.val.bits().at(index) = r.bits().at(i);
 				}
 			}
 
@@ -5462,7 +5467,7 @@ AstNode *AstNode::eval_const_function(AstNode *fcall, bool must_succeed)
 		log_abort();
 	}
 
-	result = AstNode::mkconst_bits(variables.at(str).val.bits, variables.at(str).is_signed);
+	result = AstNode::mkconst_bits(variables.at(str).val.bits(), variables.at(str).is_signed);
 
 finished:
 	delete block;
@@ -0,0 +1,637 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  Reader for the binary RTLIL format (see rtlil_binary.h).
+ *
+ */
+
+#include "frontends/rtlil/rtlil_binary.h"
+#include "frontends/rtlil/rtlil_frontend.h"
+
+#if !defined(_WIN32) && !defined(__wasm)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+using namespace RTLIL_BINARY;
+
+// Thrown instead of a log_error() when a derive cache entry is read, so that a
+// corrupt entry can be discarded.
+struct binary_file_corrupt_exception { };
+
+// The contents of a binary RTLIL file, mapped into memory if possible. Modules
+// that are loaded lazily keep a reference to it until they are materialized,
+// so for those the contents are read into memory instead: a mapping of a file
+// that is truncated or rewritten in the meantime would crash the process.
+struct BinaryFile
+{
+	struct module_entry_t {
+		RTLIL::IdString name;
+		size_t offset, size;
+	};
+
+	std::string filename;
+	bool throw_errors = false;
+	const unsigned char *data = nullptr;
+	size_t size = 0;
+	void *mapping = nullptr;
+	std::string buffer;
+
+	std::vector<std::pair<size_t, size_t>> strings;
+	std::vector<RTLIL::IdString> ids;
+	std::vector<module_entry_t> modules;
+	int autoidx = 0;
+
+	~BinaryFile()
+	{
+#if !defined(_WIN32) && !defined(__wasm)
+		if (mapping != nullptr)
+			munmap(mapping, size);
+#endif
+	}
+
+	bool map_file()
+	{
+#if !defined(_WIN32) && !defined(__wasm)
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat st;
+		void *p = MAP_FAILED;
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size >= (off_t)sizeof(magic))
+			p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (p == MAP_FAILED)
+			return false;
+
+		// a compressed file has been decompressed by the frontend, so the
+		// mapped contents are only usable if they start with the magic
+		if (memcmp(p, magic, sizeof(magic)) != 0) {
+			munmap(p, st.st_size);
+			return false;
+		}
+
+		mapping = p;
+		data = (const unsigned char*)p;
+		size = st.st_size;
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	void read_stream(std::istream *f)
+	{
+		buffer.assign(std::istreambuf_iterator<char>(*f), std::istreambuf_iterator<char>());
+		data = (const unsigned char*)buffer.data();
+		size = buffer.size();
+	}
+
+	[[noreturn]] void error() const
+	{
+		if (throw_errors)
+			throw binary_file_corrupt_exception();
+		log_error("Binary RTLIL file `%s' is truncated or corrupt.\n", filename.c_str());
+	}
+
+	std::string str(int idx) const
+	{
+		if (idx >= GetSize(strings))
+			error();
+		return std::string((const char*)data + strings[idx].first, strings[idx].second);
+	}
+
+	RTLIL::IdString id(int idx)
+	{
+		if (idx >= GetSize(strings))
+			error();
+		if (ids[idx].empty()) {
+			std::string s = str(idx);
+			if (s.size() < 2 || (s[0] != '\\' && s[0] != '$'))
+				error();
+			ids[idx] = s;
+		}
+		return ids[idx];
+	}
+
+	void parse_header();
+	dict<RTLIL::IdString, RTLIL::Const> load_attributes(int idx);
+	RTLIL::Module *load_module(int idx);
+};
+
+struct BinaryReader
+{
+	BinaryFile *file;
+	const unsigned char *pos, *end;
+	std::vector<RTLIL::Wire*> wires;
+
+	BinaryReader(BinaryFile *file, size_t offset, size_t size) : file(file)
+	{
+		if (offset > file->size || size > file->size - offset)
+			file->error();
+		pos = file->data + offset;
+		end = pos + size;
+	}
+
+	void need(size_t n)
+	{
+		if (size_t(end - pos) < n)
+			file->error();
+	}
+
+	unsigned char get_byte()
+	{
+		need(1);
+		return *pos++;
+	}
+
+	uint64_t get_uint()
+	{
+		uint64_t v = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			unsigned char c = get_byte();
+			v |= uint64_t(c & 0x7f) << shift;
+			if ((c & 0x80) == 0)
+				return v;
+		}
+		file->error();
+	}
+
+	int get_size()
+	{
+		uint64_t v = get_uint();
+		if (v > INT_MAX)
+			file->error();
+		return v;
+	}
+
+	int get_int()
+	{
+		uint64_t v = get_uint();
+		int64_t x = int64_t(v >> 1) ^ -int64_t(v & 1);
+		if (x < INT_MIN || x > INT_MAX)
+			file->error();
+		return x;
+	}
+
+	RTLIL::IdString get_id()
+	{
+		return file->id(get_size());
+	}
+
+	RTLIL::Const get_const()
+	{
+		int flags = get_size();
+		int width = get_size();
+		RTLIL::Const c;
+
+		switch (get_uint())
+		{
+		case CONST_KIND_BITS: {
+			need((size_t(width) + 7) / 8);
+			std::vector<uint64_t> words((width + 63) / 64);
+			for (int i = 0; i < width; i += 8)
+				words[i / 64] |= uint64_t(*pos++) << (i % 64);
+			c = RTLIL::Const::from_words(words, width);
+			break;
+		}
+		case CONST_KIND_STATES:
+			need((size_t(width) + 1) / 2);
+			c.bits().resize(width);
+			for (int i = 0; i < width; i++) {
+				unsigned char state = (i % 2 == 0 ? *pos : *pos++ >> 4) & 15;
+				if (state > RTLIL::Sm)
+					file->error();
+				c.bits()[i] = RTLIL::State(state);
+			}
+			if (width % 2 != 0)
+				pos++;
+			break;
+		case CONST_KIND_STRING:
+			c = RTLIL::Const(file->str(get_size()));
+			if (c.size() != width)
+				file->error();
+			break;
+		default:
+			file->error();
+		}
+
+		c.flags = flags;
+		return c;
+	}
+
+	RTLIL::SigSpec get_sigspec()
+	{
+		RTLIL::SigSpec sig;
+		int num_chunks = get_size();
+		for (int i = 0; i < num_chunks; i++) {
+			int tag = get_size();
+			if (tag == 0) {
+				sig.append(get_const());
+				continue;
+			}
+			if (tag > GetSize(wires))
+				file->error();
+			RTLIL::Wire *wire = wires[tag - 1];
+			int offset = get_size();
+			int width = get_size();
+			if (offset > wire->width || width > wire->width - offset)
+				file->error();
+			sig.append(RTLIL::SigSpec(wire, offset, width));
+		}
+		return sig;
+	}
+
+	void get_attrs(dict<RTLIL::IdString, RTLIL::Const> &attrs)
+	{
+		int n = get_size();
+		for (int i = 0; i < n; i++) {
+			RTLIL::IdString name = get_id();
+			attrs[name] = get_const();
+		}
+	}
+
+	void get_case(RTLIL::CaseRule *cs)
+	{
+		get_attrs(cs->attributes);
+		int num_compare = get_size();
+		for (int i = 0; i < num_compare; i++)
+			cs->compare.push_back(get_sigspec());
+		int num_actions = get_size();
+		for (int i = 0; i < num_actions; i++) {
+			RTLIL::SigSpec lhs = get_sigspec();
+			cs->actions.push_back(RTLIL::SigSig(lhs, get_sigspec()));
+		}
+		int num_switches = get_size();
+		for (int i = 0; i < num_switches; i++) {
+			RTLIL::SwitchRule *sw = new RTLIL::SwitchRule;
+			cs->switches.push_back(sw);
+			get_attrs(sw->attributes);
+			sw->signal = get_sigspec();
+			int num_cases = get_size();
+			for (int j = 0; j < num_cases; j++) {
+				RTLIL::CaseRule *sub_cs = new RTLIL::CaseRule;
+				sw->cases.push_back(sub_cs);
+				get_case(sub_cs);
+			}
+		}
+	}
+
+	void get_sync(RTLIL::Process *proc)
+	{
+		int type = get_size();
+		if (type > RTLIL::STi)
+			file->error();
+
+		RTLIL::SyncRule *sy = new RTLIL::SyncRule;
+		proc->syncs.push_back(sy);
+		sy->type = RTLIL::SyncType(type);
+		sy->signal = get_sigspec();
+
+		int num_actions = get_size();
+		for (int i = 0; i < num_actions; i++) {
+			RTLIL::SigSpec lhs = get_sigspec();
+			sy->actions.push_back(RTLIL::SigSig(lhs, get_sigspec()));
+		}
+
+		int num_memwr = get_size();
+		for (int i = 0; i < num_memwr; i++) {
+			RTLIL::MemWriteAction act;
+			act.memid = get_id();
+			act.address = get_sigspec();
+			act.data = get_sigspec();
+			act.enable = get_sigspec();
+			act.priority_mask = get_const();
+			get_attrs(act.attributes);
+			sy->mem_write_actions.push_back(std::move(act));
+		}
+	}
+
+	void get_module(RTLIL::Module *module)
+	{
+		get_attrs(module->attributes);
+
+		int num_params = get_size();
+		for (int i = 0; i < num_params; i++) {
+			RTLIL::IdString param = get_id();
+			module->avail_parameters(param);
+			if (get_byte())
+				module->parameter_default_values[param] = get_const();
+		}
+
+		int num_wires = get_size();
+		wires.clear();
+		wires.reserve(num_wires);
+		for (int i = 0; i < num_wires; i++) {
+			RTLIL::IdString name = get_id();
+			if (module->wire(name) != nullptr)
+				file->error();
+			RTLIL::Wire *wire = module->addWire(name, get_size());
+			wire->start_offset = get_int();
+			wire->port_id = get_size();
+			int flags = get_size();
+			wire->port_input = (flags & WIRE_INPUT) != 0;
+			wire->port_output = (flags & WIRE_OUTPUT) != 0;
+			wire->upto = (flags & WIRE_UPTO) != 0;
+			wire->is_signed = (flags & WIRE_SIGNED) != 0;
+			get_attrs(wire->attributes);
+			wires.push_back(wire);
+		}
+
+		int num_memories = get_size();
+		for (int i = 0; i < num_memories; i++) {
+			RTLIL::Memory *memory = new RTLIL::Memory;
+			memory->name = get_id();
+			if (module->memories.count(memory->name))
+				file->error();
+			module->memories[memory->name] = memory;
+			memory->width = get_size();
+			memory->start_offset = get_int();
+			memory->size = get_size();
+			get_attrs(memory->attributes);
+		}
+
+		int num_cells = get_size();
+		for (int i = 0; i < num_cells; i++) {
+			RTLIL::IdString name = get_id();
+			if (module->cell(name) != nullptr)
+				file->error();
+			RTLIL::Cell *cell = module->addCell(name, get_id());
+			get_attrs(cell->attributes);
+			int num_cell_params = get_size();
+			for (int j = 0; j < num_cell_params; j++) {
+				RTLIL::IdString param = get_id();
+				cell->parameters[param] = get_const();
+			}
+			int num_ports = get_size();
+			for (int j = 0; j < num_ports; j++) {
+				RTLIL::IdString port = get_id();
+				cell->setPort(port, get_sigspec());
+			}
+		}
+
+		int num_conns = get_size();
+		for (int i = 0; i < num_conns; i++) {
+			RTLIL::SigSpec lhs = get_sigspec();
+			RTLIL::SigSpec rhs = get_sigspec();
+			if (lhs.size() != rhs.size())
+				file->error();
+			module->connect(lhs, rhs);
+		}
+
+		int num_processes = get_size();
+		for (int i = 0; i < num_processes; i++) {
+			RTLIL::IdString name = get_id();
+			if (module->processes.count(name))
+				file->error();
+			RTLIL::Process *proc = module->addProcess(name);
+			get_attrs(proc->attributes);
+			get_case(&proc->root_case);
+			int num_syncs = get_size();
+			for (int j = 0; j < num_syncs; j++)
+				get_sync(proc);
+		}
+
+		if (pos != end)
+			file->error();
+	}
+};
+
+void BinaryFile::parse_header()
+{
+	BinaryReader reader(this, 0, size);
+
+	reader.need(sizeof(magic));
+	if (memcmp(reader.pos, magic, sizeof(magic)) != 0) {
+		if (throw_errors)
+			error();
+		log_error("File `%s' is not a binary RTLIL file (or has been corrupted by line ending conversion).\n", filename.c_str());
+	}
+	reader.pos += sizeof(magic);
+
+	int file_version = reader.get_size();
+	if (file_version != version) {
+		if (throw_errors)
+			error();
+		log_error("Binary RTLIL file `%s' has unsupported version %d (expected %d).\n", filename.c_str(), file_version, version);
+	}
+
+	autoidx = reader.get_size();
+
+	int num_strings = reader.get_size();
+	reader.need(num_strings);
+	strings.reserve(num_strings);
+	for (int i = 0; i < num_strings; i++) {
+		int len = reader.get_size();
+		reader.need(len);
+		strings.push_back(std::make_pair(size_t(reader.pos - data), size_t(len)));
+		reader.pos += len;
+	}
+	ids.resize(num_strings);
+
+	int num_modules = reader.get_size();
+	reader.need(num_modules);
+	for (int i = 0; i < num_modules; i++) {
+		module_entry_t entry;
+		entry.name = reader.get_id();
+		entry.offset = reader.get_uint();
+		entry.size = reader.get_uint();
+		modules.push_back(entry);
+	}
+
+	size_t bodies_offset = reader.pos - data;
+	for (auto &entry : modules) {
+		if (entry.offset > size - bodies_offset || entry.size > size - bodies_offset - entry.offset)
+			error();
+		entry.offset += bodies_offset;
+	}
+}
+
+dict<RTLIL::IdString, RTLIL::Const> BinaryFile::load_attributes(int idx)
+{
+	dict<RTLIL::IdString, RTLIL::Const> attrs;
+	BinaryReader reader(this, modules[idx].offset, modules[idx].size);
+	reader.get_attrs(attrs);
+	return attrs;
+}
+
+RTLIL::Module *BinaryFile::load_module(int idx)
+{
+	RTLIL::Module *module = new RTLIL::Module;
+	module->name = modules[idx].name;
+	BinaryReader reader(this, modules[idx].offset, modules[idx].size);
+	reader.get_module(module);
+	module->fixup_ports();
+	return module;
+}
+
+// A module of a binary RTLIL file read with "read_rtlil -lazy". It is named
+// "$abstract<name>" and is only loaded when the hierarchy pass derives it.
+struct BinaryModule : RTLIL::Module
+{
+	std::shared_ptr<BinaryFile> file;
+	int index;
+
+	RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, bool mayfail) override
+	{
+		RTLIL::IdString modname = file->modules[index].name;
+
+		if (!parameters.empty()) {
+			if (mayfail)
+				return RTLIL::IdString();
+			log_error("Module `%s' is used with parameters but is not parametric!\n", id2cstr(modname));
+		}
+
+		if (!design->has(modname)) {
+			log("Loading module `%s' from binary RTLIL file `%s'.\n", log_id(modname), file->filename.c_str());
+			design->add(file->load_module(index));
+		}
+
+		return modname;
+	}
+
+	RTLIL::Module *clone() const override
+	{
+		BinaryModule *new_mod = new BinaryModule;
+		new_mod->name = name;
+		cloneInto(new_mod);
+		new_mod->file = file;
+		new_mod->index = index;
+		return new_mod;
+	}
+};
+
+// Handle a module that is already in the design the same way as the text
+// RTLIL parser does. Returns false if the new module should be ignored.
+bool handle_redefinition(RTLIL::Design *design, RTLIL::IdString name, bool is_blackbox)
+{
+	if (!design->has(name))
+		return true;
+
+	RTLIL::Module *existing_mod = design->module(name);
+	if (!RTLIL_FRONTEND::flag_overwrite && (RTLIL_FRONTEND::flag_lib || is_blackbox)) {
+		log("Ignoring blackbox re-definition of module %s.\n", log_id(name));
+		return false;
+	}
+	if (!RTLIL_FRONTEND::flag_nooverwrite && !RTLIL_FRONTEND::flag_overwrite && !existing_mod->get_bool_attribute(ID::blackbox))
+		log_error("RTLIL error: redefinition of module %s.\n", log_id(name));
+	if (RTLIL_FRONTEND::flag_nooverwrite) {
+		log("Ignoring re-definition of module %s.\n", log_id(name));
+		return false;
+	}
+
+	log("Replacing existing%s module %s.\n", existing_mod->get_bool_attribute(ID::blackbox) ? " blackbox" : "", log_id(name));
+	design->remove(existing_mod);
+	return true;
+}
+
+PRIVATE_NAMESPACE_END
+YOSYS_NAMESPACE_BEGIN
+
+void RTLIL_BINARY::read_design(std::istream *f, std::string filename, RTLIL::Design *design, bool lazy)
+{
+	std::shared_ptr<BinaryFile> file = std::make_shared<BinaryFile>();
+	file->filename = filename;
+
+	if (lazy || filename == "-" || filename.compare(0, 2, "<<") == 0 || !file->map_file())
+		file->read_stream(f);
+	else
+		log("Mapped %zu bytes of binary RTLIL.\n", file->size);
+
+	file->parse_header();
+	autoidx = max(autoidx.load(), file->autoidx);
+
+	int num_lazy = 0;
+	for (int i = 0; i < GetSize(file->modules); i++)
+	{
+		RTLIL::IdString name = file->modules[i].name;
+
+		// Blackbox modules are always loaded: hierarchy only derives
+		// cells of abstract modules, which would drop their parameters.
+		dict<RTLIL::IdString, RTLIL::Const> attrs = file->load_attributes(i);
+		bool is_blackbox = (attrs.count(ID::blackbox) && attrs.at(ID::blackbox).as_bool()) ||
+				(attrs.count(ID::whitebox) && attrs.at(ID::whitebox).as_bool());
+
+		if (lazy && !is_blackbox && !RTLIL_FRONTEND::flag_lib) {
+			RTLIL::IdString abstract_name = "$abstract" + name.str();
+			if (!handle_redefinition(design, abstract_name, false))
+				continue;
+			BinaryModule *module = new BinaryModule;
+			module->name = abstract_name;
+			module->attributes = attrs;
+			module->file = file;
+			module->index = i;
+			design->add(module);
+			num_lazy++;
+			continue;
+		}
+
+		if (!handle_redefinition(design, name, is_blackbox))
+			continue;
+
+		RTLIL::Module *module = file->load_module(i);
+		if (RTLIL_FRONTEND::flag_lib)
+			module->makeblackbox();
+		design->add(module);
+	}
+
+	if (lazy)
+		log("Deferred loading of %d out of %d modules.\n", num_lazy, GetSize(file->modules));
+}
+
+bool RTLIL_BINARY::read_module(std::string filename, RTLIL::Module *module, bool *corrupt)
+{
+	BinaryFile file;
+	file.filename = filename;
+
+	if (!file.map_file()) {
+		std::ifstream f(filename, std::ios::binary);
+		if (f.fail())
+			return false;
+		file.read_stream(&f);
+	}
+
+	file.throw_errors = true;
+	try {
+		file.parse_header();
+
+		if (GetSize(file.modules) != 1)
+			file.error();
+
+		module->name = file.modules[0].name;
+		BinaryReader reader(&file, file.modules[0].offset, file.modules[0].size);
+		reader.get_module(module);
+	} catch (binary_file_corrupt_exception &) {
+		if (corrupt)
+			*corrupt = true;
+		return false;
+	}
+
+	autoidx = max(autoidx.load(), file.autoidx);
+	module->fixup_ports();
+	return true;
+}
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1,100 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  The binary RTLIL format, written by "write_rtlil -binary" and detected
+ *  by "read_rtlil".
+ *
+ *  All integers are unsigned LEB128 varints, signed integers are zigzag
+ *  encoded first. Strings are referenced by their index in the string table.
+ *
+ *    file:      magic (8 bytes), version, autoidx, string table, module
+ *               index, module bodies
+ *    strings:   count, { length, bytes }
+ *    index:     count, { name, offset, size }
+ *               (offset relative to the first module body)
+ *
+ *    module:    attrs, count, { parameter name, has_default, [const] },
+ *               count, { wire: name, width, start_offset (signed), port_id,
+ *                        flags, attrs },
+ *               count, { memory: name, width, start_offset (signed), size,
+ *                        attrs },
+ *               count, { cell: name, type, attrs, count, { param, const },
+ *                        count, { port, sigspec } },
+ *               count, { connection: sigspec, sigspec },
+ *               count, { process: name, attrs, case, count, { sync } }
+ *    attrs:     count, { name, const }
+ *    const:     flags, width, kind, data
+ *               (kind 0: 0/1 bits packed into bytes, kind 1: one state per
+ *                nibble, kind 2: string table index for string constants)
+ *    sigspec:   count, { chunk: wire index + 1, offset, width
+ *                        or 0, const }
+ *    case:      attrs, count, { compare sigspec }, count, { action sigspec,
+ *               sigspec }, count, { switch: attrs, signal, count, { case } }
+ *    sync:      type, signal, count, { sigspec, sigspec }, count,
+ *               { memwr: memid, address, data, enable, priority_mask, attrs }
+ *
+ *  The module index allows modules to be loaded individually, which
+ *  "read_rtlil -lazy" uses to only materialize the modules that are
+ *  actually instantiated.
+ *
+ */
+
+#ifndef RTLIL_BINARY_H
+#define RTLIL_BINARY_H
+
+#include "kernel/yosys.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+namespace RTLIL_BINARY
+{
+	// PNG style: a non-ASCII first byte, and CR/LF to detect text mode
+	// line ending conversion
+	static const char magic[8] = { '\x89', 'R', 'T', 'L', 'I', 'L', '\r', '\n' };
+	static const int version = 1;
+
+	enum ConstKind {
+		CONST_KIND_BITS = 0,
+		CONST_KIND_STATES = 1,
+		CONST_KIND_STRING = 2
+	};
+
+	enum WireFlags {
+		WIRE_INPUT = 1,
+		WIRE_OUTPUT = 2,
+		WIRE_UPTO = 4,
+		WIRE_SIGNED = 8
+	};
+
+	// implemented in backends/rtlil/rtlil_binary.cc
+	void write_design(std::ostream &f, const std::vector<RTLIL::Module*> &modules);
+
+	// implemented in frontends/rtlil/rtlil_binary.cc
+	void read_design(std::istream *f, std::string filename, RTLIL::Design *design, bool lazy);
+
+	// Read the single module of a file written by write_design() into an
+	// empty module. Returns false if the file can not be opened, or if it is
+	// truncated or corrupt, which also sets *corrupt. The module is then
+	// partially filled and must be deleted by the caller.
+	bool read_module(std::string filename, RTLIL::Module *module, bool *corrupt = nullptr);
+}
+
+YOSYS_NAMESPACE_END
+
+#endif
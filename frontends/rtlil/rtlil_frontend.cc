@@ -23,6 +23,7 @@
  */
 
 #include "rtlil_frontend.h"
+#include "rtlil_binary.h"
 #include "kernel/register.h"
 #include "kernel/log.h"
 
@@ -55,12 +56,24 @@ struct RTLILFrontend : public Frontend {
 		log("    -lib\n");
 		log("        only create empty blackbox modules\n");
 		log("\n");
+		log("    -lazy\n");
+		log("        only read the module index of a binary RTLIL file and load modules\n");
+		log("        when they are first used by the 'hierarchy' command (like\n");
+		log("        'read_verilog -defer'). modules that are never instantiated are\n");
+		log("        never loaded. has no effect together with -lib.\n");
+		log("\n");
+		log("Binary RTLIL files written by 'write_rtlil -binary' are detected\n");
+		log("automatically. They are memory-mapped when read from a regular file\n");
+		log("without -lazy. With -lazy, the file is read into memory, so that it can be\n");
+		log("changed before all modules are loaded.\n");
+		log("\n");
 	}
 	void execute(std::istream *&f, std::string filename, std::vector<std::string> args, RTLIL::Design *design) override
 	{
 		RTLIL_FRONTEND::flag_nooverwrite = false;
 		RTLIL_FRONTEND::flag_overwrite = false;
 		RTLIL_FRONTEND::flag_lib = false;
+		bool flag_lazy = false;
 
 		log_header(design, "Executing RTLIL frontend.\n");
 
@@ -81,12 +94,24 @@ struct RTLILFrontend : public Frontend {
 				RTLIL_FRONTEND::flag_lib = true;
 				continue;
 			}
+			if (arg == "-lazy") {
+				flag_lazy = true;
+				continue;
+			}
 			break;
 		}
-		extra_args(f, filename, args, argidx);
+		extra_args(f, filename, args, argidx, true);
 
 		log("Input filename: %s\n", filename.c_str());
 
+		if (f->peek() == (unsigned char)RTLIL_BINARY::magic[0]) {
+			RTLIL_BINARY::read_design(f, filename, design, flag_lazy);
+			return;
+		}
+
+		if (flag_lazy)
+			log_cmd_error("Option -lazy is only supported for binary RTLIL files.\n");
+
 		RTLIL_FRONTEND::lexin = f;
 		RTLIL_FRONTEND::current_design = design;
 		rtlil_frontend_yydebug = false;
@@ -170,7 +170,7 @@ attr_stmt:
 
 autoidx_stmt:
 	TOK_AUTOIDX TOK_INT EOL {
-		autoidx = max(autoidx, $2);
+		autoidx = max(autoidx.load(), $2);
 	};
 
 wire_stmt:
@@ -437,7 +437,7 @@ constant:
 			bits.pop_back();
 		$$ = new RTLIL::Const;
 		for (auto it = bits.begin(); it != bits.end(); it++)
-			$$->bits.push_back(*it);
+			$$->bits().push_back(*it);
 		free($1);
 	} |
 	TOK_INT {
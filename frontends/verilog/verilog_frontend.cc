@@ -32,6 +32,13 @@
 #include "libs/sha1/sha1.h"
 #include <stdarg.h>
 
+#if !defined(_WIN32) && !defined(__wasm)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
 YOSYS_NAMESPACE_BEGIN
 using namespace VERILOG_FRONTEND;
 
@@ -40,6 +47,59 @@ using namespace VERILOG_FRONTEND;
 static std::vector<std::string> verilog_defaults;
 static std::list<std::vector<std::string>> verilog_defaults_stack;
 
+// A Verilog file mapped into memory. Files that the pre-processor would pass
+// through unchanged are lexed directly from the mapping, without building a
+// pre-processed copy of the file first.
+struct MappedSource
+{
+	const char *data = nullptr;
+	size_t size = 0;
+
+	~MappedSource()
+	{
+#if !defined(_WIN32) && !defined(__wasm)
+		if (data != nullptr)
+			munmap((void*)data, size);
+#endif
+	}
+
+	bool map_file(const std::string &filename)
+	{
+#if !defined(_WIN32) && !defined(__wasm)
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat st;
+		void *p = MAP_FAILED;
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+			p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (p == MAP_FAILED)
+			return false;
+
+		data = (const char*)p;
+		size = st.st_size;
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	// The pre-processor expands compiler directives, drops carriage returns,
+	// stops at NUL bytes and rewrites // comments as /* */ comments, which is
+	// the only form in which the lexer recognizes synopsys/synthesis pragmas.
+	bool needs_preproc() const
+	{
+		if (memchr(data, '`', size) || memchr(data, '\r', size) || memchr(data, 0, size))
+			return true;
+		for (std::string word : {"synopsys", "synthesis"})
+			if (std::search(data, data + size, word.begin(), word.end()) != data + size)
+				return true;
+		return false;
+	}
+};
+
 static void error_on_dpi_function(AST::AstNode *node)
 {
 	if (node->type == AST::AST_DPI_FUNCTION)
@@ -155,12 +215,25 @@ struct VerilogFrontend : public Frontend {
 		log("        do not infer $meminit cells and instead convert initialized\n");
 		log("        memories to registers directly in the front-end.\n");
 		log("\n");
+		log("    -netlist\n");
+		log("        read a structural netlist, i.e. module instances, wire declarations\n");
+		log("        and continuous assignments of plain signals, as written e.g. by\n");
+		log("        \"write_verilog -noexpr\". The netlist is parsed directly into RTLIL\n");
+		log("        modules without building an AST, which is much faster and uses much\n");
+		log("        less memory for large gate-level netlists. Of the options below\n");
+		log("        only -D, -I, -ppdump, -nopp, -icells, -noautowire, -noblackbox, -lib,\n");
+		log("        -nowb, -nooverwrite and -overwrite are used in this mode.\n");
+		log("\n");
 		log("    -ppdump\n");
 		log("        dump Verilog code after pre-processor\n");
 		log("\n");
 		log("    -nopp\n");
 		log("        do not run the pre-processor\n");
 		log("\n");
+		log("        Files without any compiler directives, which the pre-processor would\n");
+		log("        leave unchanged, are lexed directly from a memory-mapped copy of the\n");
+		log("        file.\n");
+		log("\n");
 		log("    -nodpi\n");
 		log("        disable DPI-C support\n");
 		log("\n");
@@ -247,6 +320,7 @@ struct VerilogFrontend : public Frontend {
 		bool flag_mem2reg = false;
 		bool flag_ppdump = false;
 		bool flag_nopp = false;
+		bool flag_netlist = false;
 		bool flag_nodpi = false;
 		bool flag_noopt = false;
 		bool flag_icells = false;
@@ -368,6 +442,10 @@ struct VerilogFrontend : public Frontend {
 				flag_nopp = true;
 				continue;
 			}
+			if (arg == "-netlist") {
+				flag_netlist = true;
+				continue;
+			}
 			if (arg == "-nodpi") {
 				flag_nodpi = true;
 				continue;
@@ -460,25 +538,66 @@ struct VerilogFrontend : public Frontend {
 
 		log_header(design, "Executing Verilog-2005 frontend: %s\n", filename.c_str());
 
-		log("Parsing %s%s input from `%s' to AST representation.\n",
-				formal_mode ? "formal " : "", sv_mode ? "SystemVerilog" : "Verilog", filename.c_str());
+		if (flag_netlist)
+			log("Parsing structural Verilog netlist from `%s' to RTLIL modules.\n", filename.c_str());
+		else
+			log("Parsing %s%s input from `%s' to AST representation.\n",
+					formal_mode ? "formal " : "", sv_mode ? "SystemVerilog" : "Verilog", filename.c_str());
 
 		AST::current_filename = filename;
 		AST::set_line_num = &frontend_verilog_yyset_lineno;
 		AST::get_line_num = &frontend_verilog_yyget_lineno;
 
-		current_ast = new AST::AstNode(AST::AST_DESIGN);
-
 		lexin = f;
+		lexin_data = nullptr;
+		lexin_size = 0;
 		std::string code_after_preproc;
-
-		if (!flag_nopp) {
+		MappedSource source;
+		bool delete_lexin = false;
+
+		if (!flag_nopp && !flag_ppdump && dynamic_cast<std::ifstream*>(f) != nullptr &&
+				source.map_file(filename) && !source.needs_preproc()) {
+			log("No compiler directives found, skipping pre-processor.\n");
+			lexin_data = source.data;
+			lexin_size = source.size;
+		} else if (!flag_nopp) {
 			code_after_preproc = frontend_verilog_preproc(*f, filename, defines_map, *design->verilog_defines, include_dirs);
 			if (flag_ppdump)
 				log("-- Verilog code after preprocessor --\n%s-- END OF DUMP --\n", code_after_preproc.c_str());
 			lexin = new std::istringstream(code_after_preproc);
+			delete_lexin = true;
+		}
+
+		if (flag_netlist) {
+			NetlistOptions options;
+			options.icells = flag_icells;
+			options.lib = lib_mode;
+			options.nowb = flag_nowb;
+			options.noblackbox = flag_noblackbox;
+			options.overwrite = flag_overwrite;
+			options.nooverwrite = flag_nooverwrite;
+			options.autowire = default_nettype_wire;
+
+			if (lexin_data != nullptr)
+				read_netlist(design, lexin_data, lexin_size, filename, options);
+			else if (delete_lexin)
+				read_netlist(design, code_after_preproc.data(), code_after_preproc.size(), filename, options);
+			else {
+				std::string code(std::istreambuf_iterator<char>(*f), std::istreambuf_iterator<char>{});
+				read_netlist(design, code.data(), code.size(), filename, options);
+			}
+
+			if (delete_lexin)
+				delete lexin;
+			lexin_data = nullptr;
+			lexin_size = 0;
+
+			log("Successfully finished Verilog frontend.\n");
+			return;
 		}
 
+		current_ast = new AST::AstNode(AST::AST_DESIGN);
+
 		// make package typedefs available to parser
 		add_package_types(pkg_user_types, design->verilog_packages);
 
@@ -514,8 +633,10 @@ struct VerilogFrontend : public Frontend {
 				flag_nomeminit, flag_nomem2reg, flag_mem2reg, flag_noblackbox, lib_mode, flag_nowb, flag_noopt, flag_icells, flag_pwires, flag_nooverwrite, flag_overwrite, flag_defer, default_nettype_wire);
 
 
-		if (!flag_nopp)
+		if (delete_lexin)
 			delete lexin;
+		lexin_data = nullptr;
+		lexin_size = 0;
 
 		// only the previous and new global type maps remain
 		log_assert(user_type_stack.size() == 2);
@@ -528,6 +649,44 @@ struct VerilogFrontend : public Frontend {
 	}
 } VerilogFrontend;
 
+int VERILOG_FRONTEND::lex_file(const std::string &filename, bool preproc)
+{
+	MappedSource source;
+	std::istringstream code_after_preproc;
+
+	lexin_data = nullptr;
+	lexin_size = 0;
+
+	if (preproc) {
+		std::ifstream f(filename);
+		if (f.fail())
+			log_error("Can't open input file `%s' for reading: %s\n", filename.c_str(), strerror(errno));
+		define_map_t defines_map, global_defines;
+		code_after_preproc.str(frontend_verilog_preproc(f, filename, defines_map, global_defines, std::list<std::string>()));
+		lexin = &code_after_preproc;
+	} else {
+		if (!source.map_file(filename))
+			log_error("Can't map input file `%s' into memory.\n", filename.c_str());
+		lexin_data = source.data;
+		lexin_size = source.size;
+	}
+
+	AST::current_filename = filename;
+	frontend_verilog_yyset_lineno(1);
+	frontend_verilog_yyrestart(NULL);
+	int count = frontend_verilog_yylex_count();
+	frontend_verilog_yylex_destroy();
+
+	lexin_data = nullptr;
+	lexin_size = 0;
+	return count;
+}
+
+const std::vector<std::string> &VERILOG_FRONTEND::default_options()
+{
+	return verilog_defaults;
+}
+
 struct VerilogDefaults : public Pass {
 	VerilogDefaults() : Pass("verilog_defaults", "set default options for read_verilog") { }
 	void help() override
@@ -84,6 +84,29 @@ namespace VERILOG_FRONTEND
 
 	// lexer input stream
 	extern std::istream *lexin;
+
+	// lexer input buffer, read instead of lexin when not null
+	extern const char *lexin_data;
+	extern size_t lexin_size;
+
+	// run only the lexer on a file, with or without the pre-processor, and
+	// return the number of tokens (used by "bench -verilog_lexer")
+	int lex_file(const std::string &filename, bool preproc);
+
+	// the options registered with "verilog_defaults -add", which are
+	// prepended to the arguments of every read_verilog call
+	const std::vector<std::string> &default_options();
+
+	// options for read_netlist()
+	struct NetlistOptions
+	{
+		bool icells = false, lib = false, nowb = false, noblackbox = false;
+		bool overwrite = false, nooverwrite = false, autowire = true;
+	};
+
+	// read a structural netlist (module instances and assignments of plain
+	// signals) directly into RTLIL modules, without building an AST
+	void read_netlist(RTLIL::Design *design, const char *data, size_t size, const std::string &filename, const NetlistOptions &options);
 }
 
 YOSYS_NAMESPACE_END
@@ -94,6 +117,7 @@ void frontend_verilog_yyerror(char const *fmt, ...);
 void frontend_verilog_yyrestart(FILE *f);
 int frontend_verilog_yyparse(void);
 int frontend_verilog_yylex_destroy(void);
+int frontend_verilog_yylex_count(void);
 int frontend_verilog_yyget_lineno(void);
 void frontend_verilog_yyset_lineno (int);
 
@@ -0,0 +1,888 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  The Verilog frontend.
+ *
+ *  This file contains the reader for "read_verilog -netlist". Structural
+ *  netlists (module instances, wire declarations and continuous assignments
+ *  of plain signals) are parsed in a single pass directly into RTLIL modules,
+ *  without building an AST. Constants are converted with const2ast().
+ *
+ */
+
+#include "verilog_frontend.h"
+#include "frontends/ast/ast.h"
+#include "kernel/log.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+using namespace VERILOG_FRONTEND;
+
+namespace {
+
+// line number for the messages from const2ast()
+static int netlist_line;
+
+static int get_netlist_line()
+{
+	return netlist_line;
+}
+
+static void set_netlist_line(int line)
+{
+	netlist_line = line;
+}
+
+struct NetlistReader
+{
+	enum token_t {
+		T_EOF = 256,
+		T_ID,
+		T_NUMBER,
+		T_STRING,
+		T_ATTR_BEGIN,
+		T_ATTR_END
+	};
+
+	RTLIL::Design *design;
+	const NetlistOptions &options;
+
+	// input position
+	const char *p, *end, *line_start;
+	std::string filename;
+	int line;
+	std::vector<std::pair<std::string, int>> file_stack;
+	bool autowire;
+
+	// current token, identifiers are stored as RTLIL names in text
+	int tok;
+	std::string text;
+	bool escaped;
+	int tok_line, tok_col, last_line, last_col;
+
+	// current module
+	RTLIL::Module *module;
+	std::vector<RTLIL::IdString> port_order;
+	pool<RTLIL::IdString> implicit_wires;
+	int num_assigns;
+
+	NetlistReader(RTLIL::Design *design, const char *data, size_t size, const std::string &filename, const NetlistOptions &options) :
+			design(design), options(options), p(data), end(data + size), line_start(data), filename(filename), line(1),
+			autowire(options.autowire), tok(T_EOF), escaped(false), tok_line(1), tok_col(1), last_line(1), last_col(1),
+			module(nullptr), num_assigns(0) { }
+
+	[[noreturn]] void error(const char *fmt, ...) YS_ATTRIBUTE(format(printf, 2, 3))
+	{
+		va_list ap;
+		va_start(ap, fmt);
+		std::string msg = vstringf(fmt, ap);
+		va_end(ap);
+		delete module;
+		module = nullptr;
+		log_file_error(filename, tok_line, "%s", msg.c_str());
+	}
+
+	[[noreturn]] void unsupported()
+	{
+		error("Unexpected %s in structural netlist, read this file without -netlist.\n", describe().c_str());
+	}
+
+	std::string describe() const
+	{
+		switch (tok) {
+		case T_EOF:
+			return "end of file";
+		case T_ID:
+			return stringf("`%s'", RTLIL::unescape_id(text).c_str());
+		case T_NUMBER:
+			return stringf("constant `%s'", text.c_str());
+		case T_STRING:
+			return "string";
+		case T_ATTR_BEGIN:
+			return "`(*'";
+		case T_ATTR_END:
+			return "`*)'";
+		default:
+			return stringf("`%c'", tok);
+		}
+	}
+
+	std::string src(int first_line, int first_col) const
+	{
+		return stringf("%s:%d.%d-%d.%d", filename.c_str(), first_line, first_col, last_line, last_col);
+	}
+
+	// ---- lexer ----
+
+	void newline()
+	{
+		line++;
+		line_start = ++p;
+	}
+
+	void skip_to_eol()
+	{
+		while (p < end && *p != '\n')
+			p++;
+	}
+
+	// compiler directives left in the pre-processor output, or in a file read
+	// with -nopp
+	void directive()
+	{
+		const char *start = p++;
+		while (p < end && (isalnum((unsigned char)*p) || *p == '_'))
+			p++;
+		std::string name(start, p);
+		const char *args = p;
+		skip_to_eol();
+		std::string arg = std::string(args, p);
+		arg = arg.substr(0, arg.find("//"));
+		while (!arg.empty() && isspace((unsigned char)arg.front()))
+			arg = arg.substr(1);
+		while (!arg.empty() && isspace((unsigned char)arg.back()))
+			arg.pop_back();
+
+		if (name == "`file_push") {
+			file_stack.push_back(std::make_pair(filename, line));
+			if (GetSize(arg) >= 2 && arg.front() == '"' && arg.back() == '"')
+				arg = arg.substr(1, GetSize(arg) - 2);
+			filename = arg;
+			AST::current_filename = filename;
+			line = 0;
+		} else if (name == "`file_pop") {
+			if (file_stack.empty())
+				error("Unbalanced `file_pop.\n");
+			if (p < end)
+				p++;
+			line_start = p;
+			filename = file_stack.back().first;
+			AST::current_filename = filename;
+			line = file_stack.back().second;
+			file_stack.pop_back();
+		} else if (name == "`file_notfound") {
+			error("Can't open include file `%s'!\n", arg.c_str());
+		} else if (name == "`default_nettype") {
+			autowire = arg != "none";
+		} else if (name != "`timescale" && name != "`celldefine" && name != "`endcelldefine" && name != "`resetall") {
+			tok_line = line;
+			error("Unsupported compiler directive `%s' in structural netlist.\n", name.c_str() + 1);
+		}
+	}
+
+	void skip_space()
+	{
+		while (p < end) {
+			char ch = *p;
+			if (ch == '\n')
+				newline();
+			else if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\f' || ch == '\v')
+				p++;
+			else if (ch == '/' && p + 1 < end && p[1] == '/')
+				skip_to_eol();
+			else if (ch == '/' && p + 1 < end && p[1] == '*') {
+				p += 2;
+				while (p < end && !(p[0] == '*' && p + 1 < end && p[1] == '/')) {
+					if (*p == '\n')
+						newline();
+					else
+						p++;
+				}
+				if (p == end) {
+					tok_line = line;
+					error("Unterminated comment.\n");
+				}
+				p += 2;
+			} else if (ch == '`')
+				directive();
+			else
+				break;
+		}
+	}
+
+	static bool is_id_char(char ch)
+	{
+		return isalnum((unsigned char)ch) || ch == '_' || ch == '$';
+	}
+
+	void next()
+	{
+		last_line = line;
+		last_col = p - line_start + 1;
+		skip_space();
+		netlist_line = tok_line = line;
+		tok_col = p - line_start + 1;
+		escaped = false;
+
+		if (p == end) {
+			tok = T_EOF;
+			return;
+		}
+
+		const char *start = p;
+		char ch = *p;
+
+		if (isalpha((unsigned char)ch) || ch == '_' || ch == '$') {
+			while (p < end && is_id_char(*p))
+				p++;
+			text = "\\" + std::string(start, p);
+			tok = T_ID;
+		} else if (ch == '\\') {
+			while (p < end && !isspace((unsigned char)*p))
+				p++;
+			text = std::string(start, p);
+			escaped = true;
+			tok = T_ID;
+		} else if (isdigit((unsigned char)ch) || ch == '\'') {
+			text.clear();
+			while (p < end && (isdigit((unsigned char)*p) || *p == '_'))
+				text += *p++;
+			const char *q = p;
+			while (q < end && (*q == ' ' || *q == '\t'))
+				q++;
+			if (q < end && *q == '\'') {
+				text += '\'';
+				p = q + 1;
+				if (p < end && (*p == 's' || *p == 'S'))
+					text += *p++;
+				if (p < end && *p != 0 && strchr("bBoOdDhH", *p)) {
+					text += *p++;
+					while (p < end && (*p == ' ' || *p == '\t'))
+						p++;
+				}
+				while (p < end && *p != 0 && (isxdigit((unsigned char)*p) || strchr("xXzZ?_", *p)))
+					text += *p++;
+			}
+			tok = T_NUMBER;
+		} else if (ch == '"') {
+			text.clear();
+			for (p++; p < end && *p != '"'; p++) {
+				if (*p == '\n')
+					break;
+				if (*p == '\\' && p + 1 < end) {
+					p++;
+					if (*p == 'n')
+						text += '\n';
+					else if (*p == 't')
+						text += '\t';
+					else if ('0' <= *p && *p <= '7') {
+						int value = 0;
+						for (int i = 0; i < 3 && p < end && '0' <= *p && *p <= '7'; i++)
+							value = 8 * value + *p++ - '0';
+						text += char(value);
+						p--;
+					} else
+						text += *p;
+				} else
+					text += *p;
+			}
+			if (p == end || *p != '"')
+				error("Unterminated string.\n");
+			p++;
+			tok = T_STRING;
+		} else if (ch == '(' && p + 1 < end && p[1] == '*' && !(p + 2 < end && p[2] == ')')) {
+			p += 2;
+			tok = T_ATTR_BEGIN;
+		} else if (ch == '*' && p + 1 < end && p[1] == ')') {
+			p += 2;
+			tok = T_ATTR_END;
+		} else {
+			p++;
+			tok = (unsigned char)ch;
+		}
+	}
+
+	bool is_keyword(const char *keyword) const
+	{
+		return tok == T_ID && !escaped && text.compare(1, std::string::npos, keyword) == 0;
+	}
+
+	void expect(int expected)
+	{
+		if (tok < T_EOF && strchr("!~&|^+-*/%<>?", tok))
+			unsupported();
+		if (tok != expected)
+			error("Expected %s but got %s.\n", expected == T_ATTR_END ? "`*)'" : stringf("`%c'", expected).c_str(), describe().c_str());
+		next();
+	}
+
+	// keywords that can't start an instance, including the gate primitives
+	// that the AST frontend maps to internal cells
+	bool is_reserved() const
+	{
+		static const pool<std::string> keywords = {
+			"\\module", "\\macromodule", "\\always", "\\initial", "\\generate", "\\function", "\\task",
+			"\\parameter", "\\localparam", "\\defparam", "\\specify", "\\integer", "\\genvar",
+			"\\supply0", "\\supply1", "\\tri", "\\wand", "\\wor",
+			"\\and", "\\nand", "\\or", "\\nor", "\\xor", "\\xnor", "\\not", "\\buf",
+			"\\bufif0", "\\bufif1", "\\notif0", "\\notif1"
+		};
+		return tok == T_ID && !escaped && keywords.count(text);
+	}
+
+	RTLIL::IdString expect_id()
+	{
+		if (tok != T_ID)
+			error("Expected identifier but got %s.\n", describe().c_str());
+		RTLIL::IdString id = text;
+		next();
+		return id;
+	}
+
+	// ---- constants ----
+
+	enum const_use_t {
+		CONST_SIGNAL,
+		CONST_PARAM,
+		CONST_ATTR
+	};
+
+	RTLIL::Const parse_const(const_use_t use, bool *is_signed = nullptr)
+	{
+		RTLIL::Const value;
+		if (is_signed)
+			*is_signed = false;
+		if (tok == T_STRING) {
+			value = RTLIL::Const(text);
+		} else if (tok == T_NUMBER) {
+			AST::AstNode *node = const2ast(text);
+			if (node == nullptr || node->type != AST::AST_CONSTANT || node->is_unsized) {
+				delete node;
+				error("Unsupported constant `%s' in structural netlist.\n", text.c_str());
+			}
+			value = use == CONST_PARAM ? node->asParaConst() : use == CONST_ATTR ? node->asAttrConst() : node->bitsAsConst();
+			if (is_signed)
+				*is_signed = node->is_signed;
+			delete node;
+		} else
+			error("Expected constant but got %s.\n", describe().c_str());
+		next();
+		return value;
+	}
+
+	int parse_int()
+	{
+		if (tok != T_NUMBER)
+			error("Expected integer but got %s.\n", describe().c_str());
+		return parse_const(CONST_SIGNAL).as_int(true);
+	}
+
+	void parse_attributes(dict<RTLIL::IdString, RTLIL::Const> &attributes)
+	{
+		while (tok == T_ATTR_BEGIN) {
+			next();
+			while (tok != T_ATTR_END) {
+				RTLIL::IdString name = expect_id();
+				RTLIL::Const value(1);
+				if (tok == '=') {
+					next();
+					value = parse_const(CONST_ATTR);
+				}
+				attributes[name] = value;
+				if (tok != ',')
+					break;
+				next();
+			}
+			expect(T_ATTR_END);
+		}
+	}
+
+	// ---- signals ----
+
+	RTLIL::Wire *lookup_wire(RTLIL::IdString name)
+	{
+		RTLIL::Wire *wire = module->wire(name);
+		if (wire == nullptr) {
+			if (!autowire)
+				error("Identifier `%s' is implicitly declared and `default_nettype is set to none.\n", log_id(name));
+			wire = module->addWire(name);
+			wire->attributes[ID::src] = stringf("%s:%d.%d-%d.%d", filename.c_str(), tok_line, tok_col, line, int(p - line_start + 1));
+			implicit_wires.insert(name);
+		}
+		return wire;
+	}
+
+	// offset of Verilog bit index idx in wire
+	int bit_offset(RTLIL::Wire *wire, int idx)
+	{
+		int offset = wire->upto ? wire->start_offset + wire->width - 1 - idx : idx - wire->start_offset;
+		if (offset < 0 || offset >= wire->width)
+			error("Index %d is out of range for wire `%s'.\n", idx, log_id(wire));
+		return offset;
+	}
+
+	// is_signed is set for an unselected signed wire or a signed constant,
+	// the only signed expressions in a structural netlist
+	RTLIL::SigSpec parse_primary(bool *is_signed = nullptr)
+	{
+		if (is_signed)
+			*is_signed = false;
+		if (tok == '{') {
+			next();
+			RTLIL::SigSpec first = parse_expr();
+			if (tok == '{') {
+				if (!first.is_fully_const())
+					error("Non-constant replication count.\n");
+				int count = first.as_int();
+				next();
+				RTLIL::SigSpec item = parse_concat('}');
+				expect('}');
+				RTLIL::SigSpec sig;
+				for (int i = 0; i < count; i++)
+					sig.append(item);
+				return sig;
+			}
+			std::vector<RTLIL::SigSpec> items = {first};
+			while (tok == ',') {
+				next();
+				items.push_back(parse_expr());
+			}
+			expect('}');
+			RTLIL::SigSpec sig;
+			for (auto it = items.rbegin(); it != items.rend(); ++it)
+				sig.append(*it);
+			return sig;
+		}
+
+		if (tok == T_NUMBER || tok == T_STRING)
+			return parse_const(CONST_SIGNAL, is_signed);
+
+		RTLIL::Wire *wire = lookup_wire(text);
+		next();
+		if (tok != '[') {
+			if (is_signed)
+				*is_signed = wire->is_signed;
+			return wire;
+		}
+
+		next();
+		int msb = bit_offset(wire, parse_int());
+		int lsb = msb;
+		if (tok == ':') {
+			next();
+			lsb = bit_offset(wire, parse_int());
+		}
+		expect(']');
+		if (lsb > msb)
+			error("Reversed part select on wire `%s'.\n", log_id(wire));
+		return RTLIL::SigSpec(wire, lsb, msb - lsb + 1);
+	}
+
+	RTLIL::SigSpec parse_expr(bool *is_signed = nullptr)
+	{
+		if (tok == '{' || tok == T_NUMBER || tok == T_STRING || tok == T_ID)
+			return parse_primary(is_signed);
+		unsupported();
+	}
+
+	// comma-separated list of signals, the first one being the MSB
+	RTLIL::SigSpec parse_concat(int terminator)
+	{
+		std::vector<RTLIL::SigSpec> items;
+		while (true) {
+			items.push_back(parse_expr());
+			if (tok == terminator)
+				break;
+			expect(',');
+		}
+		expect(terminator);
+		RTLIL::SigSpec sig;
+		for (auto it = items.rbegin(); it != items.rend(); ++it)
+			sig.append(*it);
+		return sig;
+	}
+
+	// ---- declarations ----
+
+	struct range_t {
+		int width = 1, offset = 0;
+		bool upto = false, is_signed = false;
+	};
+
+	range_t parse_range()
+	{
+		range_t range;
+		if (is_keyword("signed")) {
+			range.is_signed = true;
+			next();
+		}
+		if (tok == '[') {
+			next();
+			int msb = parse_int();
+			expect(':');
+			int lsb = parse_int();
+			expect(']');
+			range.width = abs(msb - lsb) + 1;
+			range.offset = std::min(msb, lsb);
+			range.upto = msb < lsb;
+		}
+		return range;
+	}
+
+	void declare_wire(RTLIL::IdString name, int direction, const range_t &range,
+			const dict<RTLIL::IdString, RTLIL::Const> &attributes, int first_line, int first_col)
+	{
+		RTLIL::Wire *wire = module->wire(name);
+		if (wire != nullptr && implicit_wires.count(name)) {
+			if (range.width != 1)
+				error("Wire `%s' is used before its declaration.\n", log_id(name));
+			implicit_wires.erase(name);
+		} else if (wire != nullptr) {
+			bool is_port = wire->port_input || wire->port_output;
+			if ((direction != 0) == is_port)
+				error("Re-declaration of wire `%s'.\n", log_id(name));
+			if (wire->width != range.width || wire->start_offset != range.offset || wire->upto != range.upto)
+				error("Inconsistent declarations of wire `%s'.\n", log_id(name));
+		} else {
+			wire = module->addWire(name, range.width);
+			wire->start_offset = range.offset;
+			wire->upto = range.upto;
+			wire->attributes[ID::src] = src(first_line, first_col);
+		}
+		if (range.is_signed)
+			wire->is_signed = true;
+		if (direction == 1 || direction == 3)
+			wire->port_input = true;
+		if (direction == 2 || direction == 3)
+			wire->port_output = true;
+		for (auto &attr : attributes)
+			wire->attributes[attr.first] = attr.second;
+	}
+
+	int parse_direction()
+	{
+		int direction = is_keyword("input") ? 1 : is_keyword("output") ? 2 : is_keyword("inout") ? 3 : 0;
+		if (direction != 0)
+			next();
+		return direction;
+	}
+
+	// "input a, b;", "wire [3:0] c = d;", ...
+	void parse_declaration(int direction, const dict<RTLIL::IdString, RTLIL::Const> &attributes, int first_line, int first_col)
+	{
+		if (is_keyword("wire") || is_keyword("reg"))
+			next();
+		range_t range = parse_range();
+		while (true) {
+			RTLIL::IdString name = expect_id();
+			declare_wire(name, direction, range, attributes, first_line, first_col);
+			if (tok == '=') {
+				next();
+				bool rhs_signed;
+				RTLIL::SigSpec rhs = parse_expr(&rhs_signed);
+				assign(module->wire(name), rhs, rhs_signed);
+			}
+			if (tok != ',')
+				break;
+			next();
+		}
+		expect(';');
+	}
+
+	// ANSI-style or plain list of port names in the module header
+	void parse_port_list()
+	{
+		expect('(');
+		int direction = 0;
+		range_t range;
+		while (tok != ')') {
+			dict<RTLIL::IdString, RTLIL::Const> attributes;
+			int first_line = tok_line, first_col = tok_col;
+			parse_attributes(attributes);
+			int new_direction = parse_direction();
+			if (new_direction != 0) {
+				direction = new_direction;
+				if (is_keyword("wire") || is_keyword("reg"))
+					next();
+				range = parse_range();
+			}
+			RTLIL::IdString name = expect_id();
+			if (direction != 0)
+				declare_wire(name, direction, range, attributes, first_line, first_col);
+			port_order.push_back(name);
+			if (tok != ',')
+				break;
+			next();
+		}
+		expect(')');
+	}
+
+	// ---- module items ----
+
+	// a narrower right hand side is sign extended if it is signed, as in
+	// "assign y = 4'sb1000;"
+	void assign(RTLIL::SigSpec lhs, RTLIL::SigSpec rhs, bool rhs_signed)
+	{
+		if (lhs.has_const())
+			error("Assignment to a constant.\n");
+		if (GetSize(rhs) < GetSize(lhs))
+			rhs.extend_u0(GetSize(lhs), rhs_signed);
+		else if (GetSize(rhs) > GetSize(lhs))
+			rhs = rhs.extract(0, GetSize(lhs));
+		module->connect(lhs, rhs);
+		num_assigns++;
+	}
+
+	void parse_assign()
+	{
+		next();
+		while (true) {
+			RTLIL::SigSpec lhs = parse_expr();
+			expect('=');
+			bool rhs_signed;
+			RTLIL::SigSpec rhs = parse_expr(&rhs_signed);
+			assign(lhs, rhs, rhs_signed);
+			if (tok != ',')
+				break;
+			next();
+		}
+		expect(';');
+	}
+
+	void parse_instances(const dict<RTLIL::IdString, RTLIL::Const> &attributes, int first_line, int first_col)
+	{
+		RTLIL::IdString type = expect_id();
+		if (options.icells && type.begins_with("\\$"))
+			type = type.substr(1);
+
+		dict<RTLIL::IdString, RTLIL::Const> parameters;
+		if (tok == '#') {
+			next();
+			expect('(');
+			int para_counter = 0;
+			while (tok != ')') {
+				if (tok == '.') {
+					next();
+					RTLIL::IdString name = expect_id();
+					expect('(');
+					parameters[name] = parse_const(CONST_PARAM);
+					expect(')');
+				} else
+					parameters[stringf("$%d", ++para_counter)] = parse_const(CONST_PARAM);
+				if (tok != ',')
+					break;
+				next();
+			}
+			expect(')');
+		}
+
+		for (bool first = true;; first = false) {
+			if (!first) {
+				first_line = tok_line;
+				first_col = tok_col;
+			}
+			RTLIL::IdString name = expect_id();
+			if (tok == '[')
+				error("Arrays of instances are not supported in structural netlists.\n");
+			if (module->cell(name) != nullptr)
+				error("Re-definition of cell `%s'.\n", log_id(name));
+
+			RTLIL::Cell *cell = module->addCell(name, type);
+			cell->parameters = parameters;
+			cell->set_bool_attribute(ID::module_not_derived);
+			for (auto &attr : attributes)
+				cell->attributes[attr.first] = attr.second;
+
+			expect('(');
+			int port_counter = 0;
+			while (tok != ')') {
+				if (tok == '.') {
+					next();
+					RTLIL::IdString port = expect_id();
+					expect('(');
+					RTLIL::SigSpec sig;
+					if (tok != ')')
+						sig = parse_expr();
+					expect(')');
+					cell->setPort(port, sig);
+				} else
+					cell->setPort(stringf("$%d", ++port_counter), parse_expr());
+				if (tok != ',')
+					break;
+				next();
+			}
+			expect(')');
+
+			cell->attributes[ID::src] = src(first_line, first_col);
+
+			if (tok != ',')
+				break;
+			next();
+		}
+		expect(';');
+	}
+
+	// ---- modules ----
+
+	void finish_module(int first_line)
+	{
+		tok_line = first_line;
+		for (int i = 0; i < GetSize(port_order); i++) {
+			RTLIL::Wire *wire = module->wire(port_order[i]);
+			if (wire == nullptr || !(wire->port_input || wire->port_output))
+				error("Port `%s' is not declared as input, output or inout.\n", log_id(port_order[i]));
+			if (wire->port_id != 0)
+				error("Port `%s' is listed twice in the module header.\n", log_id(wire));
+			wire->port_id = i + 1;
+		}
+		for (auto wire : module->wires())
+			if ((wire->port_input || wire->port_output) && wire->port_id == 0)
+				error("Module port `%s' is not declared in module header.\n", log_id(wire));
+		module->fixup_ports();
+
+		bool blackbox_module = options.lib;
+		if (!blackbox_module && !options.noblackbox) {
+			blackbox_module = module->cells().size() == 0 && num_assigns == 0;
+			for (auto wire : module->wires())
+				if (!wire->port_input && !wire->port_output)
+					blackbox_module = false;
+		}
+
+		if (options.nowb)
+			module->attributes.erase(ID::whitebox);
+		if (module->attributes.count(ID::lib_whitebox)) {
+			if (!options.lib || options.nowb)
+				module->attributes.erase(ID::lib_whitebox);
+			else {
+				module->attributes[ID::whitebox] = module->attributes.at(ID::lib_whitebox);
+				module->attributes.erase(ID::lib_whitebox);
+			}
+		}
+		if (!blackbox_module && module->attributes.count(ID::blackbox))
+			blackbox_module = module->attributes.at(ID::blackbox).as_bool();
+		if (blackbox_module && module->attributes.count(ID::whitebox))
+			blackbox_module = !module->attributes.at(ID::whitebox).as_bool();
+		if (module->attributes.count(ID::noblackbox)) {
+			if (blackbox_module)
+				blackbox_module = !module->attributes.at(ID::noblackbox).as_bool();
+			module->attributes.erase(ID::noblackbox);
+		}
+
+		if (blackbox_module) {
+			module->attributes.erase(ID::whitebox);
+			module->attributes.erase(ID::lib_whitebox);
+			module->new_connections(std::vector<RTLIL::SigSig>());
+			for (auto cell : module->cells().to_vector())
+				module->remove(cell);
+			pool<RTLIL::Wire*> internal_wires;
+			for (auto wire : module->wires())
+				if (!wire->port_input && !wire->port_output)
+					internal_wires.insert(wire);
+			module->remove(internal_wires);
+			module->set_bool_attribute(ID::blackbox);
+		}
+
+		if (design->has(module->name)) {
+			RTLIL::Module *existing_mod = design->module(module->name);
+			if (!options.nooverwrite && !options.overwrite && !existing_mod->get_blackbox_attribute()) {
+				error("Re-definition of module `%s'!\n", log_id(module->name));
+			} else if (options.nooverwrite) {
+				log("Ignoring re-definition of module `%s' at %s:%d.\n", log_id(module->name), filename.c_str(), first_line);
+				delete module;
+				module = nullptr;
+				return;
+			} else {
+				log("Replacing existing%s module `%s' at %s:%d.\n", existing_mod->get_bool_attribute(ID::blackbox) ? " blackbox" : "",
+						log_id(module->name), filename.c_str(), first_line);
+				design->remove(existing_mod);
+			}
+		}
+
+		design->add(module);
+		module = nullptr;
+	}
+
+	void parse_module(const dict<RTLIL::IdString, RTLIL::Const> &attributes)
+	{
+		int first_line = tok_line, first_col = tok_col;
+		next();
+
+		module = new RTLIL::Module;
+		module->name = expect_id();
+		module->attributes = attributes;
+		port_order.clear();
+		implicit_wires.clear();
+		num_assigns = 0;
+
+		log("Generating RTLIL representation for module `%s'.\n", module->name.c_str());
+
+		if (tok == '#')
+			error("Module parameters are not supported in structural netlists.\n");
+		if (tok == '(')
+			parse_port_list();
+		expect(';');
+
+		while (!is_keyword("endmodule")) {
+			dict<RTLIL::IdString, RTLIL::Const> item_attributes;
+			int item_line = tok_line, item_col = tok_col;
+			parse_attributes(item_attributes);
+			int direction = parse_direction();
+			if (direction != 0 || is_keyword("wire") || is_keyword("reg"))
+				parse_declaration(direction, item_attributes, item_line, item_col);
+			else if (is_keyword("assign"))
+				parse_assign();
+			else if (tok == T_ID && !is_reserved())
+				parse_instances(item_attributes, item_line, item_col);
+			else
+				unsupported();
+		}
+		next();
+
+		module->attributes[ID::src] = src(first_line, first_col);
+		finish_module(first_line);
+	}
+
+	void parse_file()
+	{
+		next();
+		while (tok != T_EOF) {
+			dict<RTLIL::IdString, RTLIL::Const> attributes;
+			parse_attributes(attributes);
+			if (!is_keyword("module") && !is_keyword("macromodule"))
+				unsupported();
+			parse_module(attributes);
+		}
+	}
+};
+
+}
+
+void VERILOG_FRONTEND::read_netlist(RTLIL::Design *design, const char *data, size_t size, const std::string &filename, const NetlistOptions &options)
+{
+	// restores the AST globals also when a parse error is thrown
+	struct AstGlobalsGuard {
+		std::string old_filename = AST::current_filename;
+		void (*old_set_line_num)(int) = AST::set_line_num;
+		int (*old_get_line_num)() = AST::get_line_num;
+		~AstGlobalsGuard() {
+			AST::current_filename = old_filename;
+			AST::set_line_num = old_set_line_num;
+			AST::get_line_num = old_get_line_num;
+		}
+	} guard;
+
+	AST::current_filename = filename;
+	AST::get_line_num = &get_netlist_line;
+	AST::set_line_num = &set_netlist_line;
+
+	NetlistReader reader(design, data, size, filename, options);
+	reader.parse_file();
+}
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1,99 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+
+#ifndef ARENA_H
+#define ARENA_H
+
+YOSYS_NAMESPACE_BEGIN
+
+// Memory for objects of type T, allocated in slabs of up to 1024 objects.
+// Released objects are kept on a free list for reuse, and all slabs are
+// returned at once when the arena is destroyed. The arena only provides the
+// memory: objects are constructed with placement new and must be destroyed
+// (but not deallocated) by the owner before the arena goes away.
+//
+// T may be incomplete where the arena is declared, it only needs to be
+// complete where allocate() and deallocate() are used.
+template<typename T>
+class object_arena
+{
+	std::vector<char*> slabs_;
+	void *free_list_;
+	char *next_, *end_;
+	int slab_objects_, num_objects_;
+
+	static size_t slot_size() {
+		size_t align = std::max(alignof(T), alignof(void*));
+		return (std::max(sizeof(T), sizeof(void*)) + align - 1) / align * align;
+	}
+
+	void add_slab() {
+		slab_objects_ = slabs_.empty() ? 16 : std::min(2 * slab_objects_, 1024);
+		char *slab = static_cast<char*>(::operator new(slab_objects_ * slot_size()));
+		slabs_.push_back(slab);
+		next_ = slab;
+		end_ = slab + slab_objects_ * slot_size();
+	}
+
+public:
+	object_arena() : free_list_(nullptr), next_(nullptr), end_(nullptr), slab_objects_(0), num_objects_(0) { }
+	object_arena(const object_arena&) = delete;
+	object_arena &operator=(const object_arena&) = delete;
+
+	~object_arena() {
+		for (auto slab : slabs_)
+			::operator delete(slab);
+	}
+
+	void *allocate() {
+		num_objects_++;
+		if (free_list_ != nullptr) {
+			void *p = free_list_;
+			free_list_ = *static_cast<void**>(p);
+			return p;
+		}
+		if (next_ == end_)
+			add_slab();
+		void *p = next_;
+		next_ += slot_size();
+		return p;
+	}
+
+	void deallocate(void *p) {
+		*static_cast<void**>(p) = free_list_;
+		free_list_ = p;
+		num_objects_--;
+	}
+
+	// statistics for "stat -mem"
+	int num_objects() const { return num_objects_; }
+	int num_slabs() const { return GetSize(slabs_); }
+	size_t slab_bytes() const {
+		size_t bytes = 0;
+		for (int i = 0, n = 16; i < GetSize(slabs_); i++, n = std::min(2 * n, 1024))
+			bytes += n * slot_size();
+		return bytes;
+	}
+};
+
+YOSYS_NAMESPACE_END
+
+#endif
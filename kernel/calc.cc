@@ -30,13 +30,13 @@ static void extend_u0(RTLIL::Const &arg, int width, bool is_signed)
 {
 	RTLIL::State padding = RTLIL::State::S0;
 
-	if (arg.bits.size() > 0 && is_signed)
-		padding = arg.bits.back();
+	if (arg.size() > 0 && is_signed)
+		padding = arg.bits().back();
 
-	while (int(arg.bits.size()) < width)
-		arg.bits.push_back(padding);
+	while (int(arg.size()) < width)
+		arg.bits().push_back(padding);
 
-	arg.bits.resize(width);
+	arg.bits().resize(width);
 }
 
 static BigInteger const2big(const RTLIL::Const &val, bool as_signed, int &undef_bit_pos)
@@ -45,17 +45,17 @@ static BigInteger const2big(const RTLIL::Const &val, bool as_signed, int &undef_
 
 	BigInteger::Sign sign = BigInteger::positive;
 	State inv_sign_bit = RTLIL::State::S1;
-	size_t num_bits = val.bits.size();
+	int num_bits = val.size();
 
-	if (as_signed && num_bits && val.bits[num_bits-1] == RTLIL::State::S1) {
+	if (as_signed && num_bits && val[num_bits-1] == RTLIL::State::S1) {
 		inv_sign_bit = RTLIL::State::S0;
 		sign = BigInteger::negative;
 		num_bits--;
 	}
 
-	for (size_t i = 0; i < num_bits; i++)
-		if (val.bits[i] == RTLIL::State::S0 || val.bits[i] == RTLIL::State::S1)
-			mag.setBit(i, val.bits[i] == inv_sign_bit);
+	for (int i = 0; i < num_bits; i++)
+		if (val[i] == RTLIL::State::S0 || val[i] == RTLIL::State::S1)
+			mag.setBit(i, val[i] == inv_sign_bit);
 		else if (undef_bit_pos < 0)
 			undef_bit_pos = i;
 
@@ -79,12 +79,12 @@ static RTLIL::Const big2const(const BigInteger &val, int result_len, int undef_b
 		{
 			mag--;
 			for (int i = 0; i < result_len; i++)
-				result.bits[i] = mag.getBit(i) ? RTLIL::State::S0 : RTLIL::State::S1;
+				result.bits()[i] = mag.getBit(i) ? RTLIL::State::S0 : RTLIL::State::S1;
 		}
 		else
 		{
 			for (int i = 0; i < result_len; i++)
-				result.bits[i] = mag.getBit(i) ? RTLIL::State::S1 : RTLIL::State::S0;
+				result.bits()[i] = mag.getBit(i) ? RTLIL::State::S1 : RTLIL::State::S0;
 		}
 	}
 
@@ -97,6 +97,47 @@ static RTLIL::Const big2const(const BigInteger &val, int result_len, int undef_b
 	return result;
 }
 
+bool RTLIL::const_word_ops = true;
+
+// The word-parallel fast paths below are used when all operands are fully
+// defined. const2words() converts an operand to 64-bit words (least
+// significant word first), sign or zero extended to `width` bits and rounded
+// up to full words. Operands wider than that are truncated, which is only
+// correct for operations whose low result bits depend only on the low operand
+// bits (bitwise operations, add, sub, mul). Returns false if the operand has
+// any undefined bits.
+static bool const2words(const RTLIL::Const &val, bool as_signed, int width, std::vector<uint64_t> &words)
+{
+	if (!val.as_words(words))
+		return false;
+
+	uint64_t fill = 0;
+	if (as_signed && !val.empty() && val.back() == RTLIL::State::S1) {
+		fill = ~uint64_t(0);
+		if (GetSize(val) % 64 != 0)
+			words.back() |= fill << (GetSize(val) % 64);
+	}
+
+	words.resize((width + 63) / 64, fill);
+	return true;
+}
+
+// Like const2words() for a single word. Returns false if the operand is wider
+// than `max_width` bits.
+static bool const2word(const RTLIL::Const &val, bool as_signed, int max_width, uint64_t &word)
+{
+	std::vector<uint64_t> words;
+	if (GetSize(val) > max_width || !const2words(val, as_signed, 64, words))
+		return false;
+	word = words[0];
+	return true;
+}
+
+static RTLIL::Const word2const(uint64_t word, int result_len)
+{
+	return RTLIL::Const::from_words(std::vector<uint64_t>{word}, result_len);
+}
+
 static RTLIL::State logic_and(RTLIL::State a, RTLIL::State b)
 {
 	if (a == RTLIL::State::S0) return RTLIL::State::S0;
@@ -132,38 +173,59 @@ static RTLIL::State logic_xnor(RTLIL::State a, RTLIL::State b)
 RTLIL::Const RTLIL::const_not(const RTLIL::Const &arg1, const RTLIL::Const&, bool signed1, bool, int result_len)
 {
 	if (result_len < 0)
-		result_len = arg1.bits.size();
+		result_len = arg1.size();
 
 	RTLIL::Const arg1_ext = arg1;
 	extend_u0(arg1_ext, result_len, signed1);
 
+	std::vector<uint64_t> words;
+	if (RTLIL::const_word_ops && arg1_ext.as_words(words)) {
+		for (auto &w : words)
+			w = ~w;
+		return RTLIL::Const::from_words(words, result_len);
+	}
+
 	RTLIL::Const result(RTLIL::State::Sx, result_len);
 	for (size_t i = 0; i < size_t(result_len); i++) {
-		if (i >= arg1_ext.bits.size())
-			result.bits[i] = RTLIL::State::S0;
-		else if (arg1_ext.bits[i] == RTLIL::State::S0)
-			result.bits[i] = RTLIL::State::S1;
-		else if (arg1_ext.bits[i] == RTLIL::State::S1)
-			result.bits[i] = RTLIL::State::S0;
+		if (i >= size_t(arg1_ext.size()))
+			result.bits()[i] = RTLIL::State::S0;
+		else if (arg1_ext.bits()[i] == RTLIL::State::S0)
+			result.bits()[i] = RTLIL::State::S1;
+		else if (arg1_ext.bits()[i] == RTLIL::State::S1)
+			result.bits()[i] = RTLIL::State::S0;
 	}
 
 	return result;
 }
 
-static RTLIL::Const logic_wrapper(RTLIL::State(*logic_func)(RTLIL::State, RTLIL::State),
+static uint64_t word_and(uint64_t a, uint64_t b) { return a & b; }
+static uint64_t word_or(uint64_t a, uint64_t b) { return a | b; }
+static uint64_t word_xor(uint64_t a, uint64_t b) { return a ^ b; }
+static uint64_t word_xnor(uint64_t a, uint64_t b) { return ~(a ^ b); }
+
+// `word_func` must compute the same function as `logic_func` on 64 fully
+// defined bits at once.
+static RTLIL::Const logic_wrapper(RTLIL::State(*logic_func)(RTLIL::State, RTLIL::State), uint64_t(*word_func)(uint64_t, uint64_t),
 		RTLIL::Const arg1, RTLIL::Const arg2, bool signed1, bool signed2, int result_len = -1)
 {
 	if (result_len < 0)
-		result_len = max(arg1.bits.size(), arg2.bits.size());
+		result_len = max(arg1.size(), arg2.size());
 
 	extend_u0(arg1, result_len, signed1);
 	extend_u0(arg2, result_len, signed2);
 
+	std::vector<uint64_t> words1, words2;
+	if (RTLIL::const_word_ops && arg1.as_words(words1) && arg2.as_words(words2)) {
+		for (size_t i = 0; i < words1.size(); i++)
+			words1[i] = word_func(words1[i], words2[i]);
+		return RTLIL::Const::from_words(words1, result_len);
+	}
+
 	RTLIL::Const result(RTLIL::State::Sx, result_len);
 	for (size_t i = 0; i < size_t(result_len); i++) {
-		RTLIL::State a = i < arg1.bits.size() ? arg1.bits[i] : RTLIL::State::S0;
-		RTLIL::State b = i < arg2.bits.size() ? arg2.bits[i] : RTLIL::State::S0;
-		result.bits[i] = logic_func(a, b);
+		RTLIL::State a = i < size_t(arg1.size()) ? arg1.bits()[i] : RTLIL::State::S0;
+		RTLIL::State b = i < size_t(arg2.size()) ? arg2.bits()[i] : RTLIL::State::S0;
+		result.bits()[i] = logic_func(a, b);
 	}
 
 	return result;
@@ -171,108 +233,111 @@ static RTLIL::Const logic_wrapper(RTLIL::State(*logic_func)(RTLIL::State, RTLIL:
 
 RTLIL::Const RTLIL::const_and(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_and, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_and, word_and, arg1, arg2, signed1, signed2, result_len);
 }
 
 RTLIL::Const RTLIL::const_or(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_or, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_or, word_or, arg1, arg2, signed1, signed2, result_len);
 }
 
 RTLIL::Const RTLIL::const_xor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_xor, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_xor, word_xor, arg1, arg2, signed1, signed2, result_len);
 }
 
 RTLIL::Const RTLIL::const_xnor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_xnor, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_xnor, word_xnor, arg1, arg2, signed1, signed2, result_len);
+}
+
+static RTLIL::Const logic_result(RTLIL::State bit, int result_len)
+{
+	RTLIL::Const result(bit);
+	while (int(result.size()) < result_len)
+		result.bits().push_back(RTLIL::State::S0);
+	return result;
 }
 
 static RTLIL::Const logic_reduce_wrapper(RTLIL::State initial, RTLIL::State(*logic_func)(RTLIL::State, RTLIL::State), const RTLIL::Const &arg1, int result_len)
 {
 	RTLIL::State temp = initial;
 
-	for (size_t i = 0; i < arg1.bits.size(); i++)
-		temp = logic_func(temp, arg1.bits[i]);
+	for (int i = 0; i < GetSize(arg1); i++)
+		temp = logic_func(temp, arg1[i]);
 
-	RTLIL::Const result(temp);
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	return logic_result(temp, result_len);
+}
+
+// Truth value of a constant as used by the logic operators: S1 if any bit
+// is 1, S0 if all bits are 0, Sx otherwise. (This is what comparing the
+// BigInteger value against zero yields, without building the BigInteger.)
+static RTLIL::State logic_truth(const RTLIL::Const &arg)
+{
+	if (arg.as_bool())
+		return RTLIL::State::S1;
+	return arg.is_fully_zero() ? RTLIL::State::S0 : RTLIL::State::Sx;
 }
 
 RTLIL::Const RTLIL::const_reduce_and(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
+	if (RTLIL::const_word_ops && arg1.is_fully_def())
+		return logic_result(arg1.is_fully_ones() ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
 	return logic_reduce_wrapper(RTLIL::State::S1, logic_and, arg1, result_len);
 }
 
 RTLIL::Const RTLIL::const_reduce_or(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
+	if (arg1.as_bool())
+		return logic_result(RTLIL::State::S1, result_len);
 	return logic_reduce_wrapper(RTLIL::State::S0, logic_or, arg1, result_len);
 }
 
 RTLIL::Const RTLIL::const_reduce_xor(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
+	std::vector<uint64_t> words;
+	if (RTLIL::const_word_ops && arg1.as_words(words)) {
+		uint64_t parity = 0;
+		for (auto w : words)
+			parity ^= w;
+		for (int shift = 32; shift > 0; shift >>= 1)
+			parity ^= parity >> shift;
+		return logic_result(parity & 1 ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
+	}
 	return logic_reduce_wrapper(RTLIL::State::S0, logic_xor, arg1, result_len);
 }
 
-RTLIL::Const RTLIL::const_reduce_xnor(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
+RTLIL::Const RTLIL::const_reduce_xnor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	RTLIL::Const buffer = logic_reduce_wrapper(RTLIL::State::S0, logic_xor, arg1, result_len);
-	if (!buffer.bits.empty()) {
-		if (buffer.bits.front() == RTLIL::State::S0)
-			buffer.bits.front() = RTLIL::State::S1;
-		else if (buffer.bits.front() == RTLIL::State::S1)
-			buffer.bits.front() = RTLIL::State::S0;
+	RTLIL::Const buffer = RTLIL::const_reduce_xor(arg1, arg2, signed1, signed2, result_len);
+	if (!buffer.empty()) {
+		if (buffer.bits().front() == RTLIL::State::S0)
+			buffer.bits().front() = RTLIL::State::S1;
+		else if (buffer.bits().front() == RTLIL::State::S1)
+			buffer.bits().front() = RTLIL::State::S0;
 	}
 	return buffer;
 }
 
-RTLIL::Const RTLIL::const_reduce_bool(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
+RTLIL::Const RTLIL::const_reduce_bool(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_reduce_wrapper(RTLIL::State::S0, logic_or, arg1, result_len);
+	return RTLIL::const_reduce_or(arg1, arg2, signed1, signed2, result_len);
 }
 
-RTLIL::Const RTLIL::const_logic_not(const RTLIL::Const &arg1, const RTLIL::Const&, bool signed1, bool, int result_len)
+RTLIL::Const RTLIL::const_logic_not(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
-	int undef_bit_pos_a = -1;
-	BigInteger a = const2big(arg1, signed1, undef_bit_pos_a);
-	RTLIL::Const result(a.isZero() ? undef_bit_pos_a >= 0 ? RTLIL::State::Sx : RTLIL::State::S1 : RTLIL::State::S0);
-
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	RTLIL::State bit_a = logic_truth(arg1);
+	return logic_result(bit_a == RTLIL::State::Sx ? RTLIL::State::Sx : bit_a == RTLIL::State::S0 ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
 }
 
-RTLIL::Const RTLIL::const_logic_and(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
+RTLIL::Const RTLIL::const_logic_and(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool, bool, int result_len)
 {
-	int undef_bit_pos_a = -1, undef_bit_pos_b = -1;
-	BigInteger a = const2big(arg1, signed1, undef_bit_pos_a);
-	BigInteger b = const2big(arg2, signed2, undef_bit_pos_b);
-
-	RTLIL::State bit_a = a.isZero() ? undef_bit_pos_a >= 0 ? RTLIL::State::Sx : RTLIL::State::S0 : RTLIL::State::S1;
-	RTLIL::State bit_b = b.isZero() ? undef_bit_pos_b >= 0 ? RTLIL::State::Sx : RTLIL::State::S0 : RTLIL::State::S1;
-	RTLIL::Const result(logic_and(bit_a, bit_b));
-
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	return logic_result(logic_and(logic_truth(arg1), logic_truth(arg2)), result_len);
 }
 
-RTLIL::Const RTLIL::const_logic_or(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
+RTLIL::Const RTLIL::const_logic_or(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool, bool, int result_len)
 {
-	int undef_bit_pos_a = -1, undef_bit_pos_b = -1;
-	BigInteger a = const2big(arg1, signed1, undef_bit_pos_a);
-	BigInteger b = const2big(arg2, signed2, undef_bit_pos_b);
-
-	RTLIL::State bit_a = a.isZero() ? undef_bit_pos_a >= 0 ? RTLIL::State::Sx : RTLIL::State::S0 : RTLIL::State::S1;
-	RTLIL::State bit_b = b.isZero() ? undef_bit_pos_b >= 0 ? RTLIL::State::Sx : RTLIL::State::S0 : RTLIL::State::S1;
-	RTLIL::Const result(logic_or(bit_a, bit_b));
-
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	return logic_result(logic_or(logic_truth(arg1), logic_truth(arg2)), result_len);
 }
 
 // Shift `arg1` by `arg2` bits.
@@ -286,7 +351,7 @@ static RTLIL::Const const_shift_worker(const RTLIL::Const &arg1, const RTLIL::Co
 	BigInteger offset = const2big(arg2, signed2, undef_bit_pos) * direction;
 
 	if (result_len < 0)
-		result_len = arg1.bits.size();
+		result_len = arg1.size();
 
 	RTLIL::Const result(RTLIL::State::Sx, result_len);
 	if (undef_bit_pos >= 0)
@@ -295,18 +360,41 @@ static RTLIL::Const const_shift_worker(const RTLIL::Const &arg1, const RTLIL::Co
 	for (int i = 0; i < result_len; i++) {
 		BigInteger pos = BigInteger(i) + offset;
 		if (pos < 0)
-			result.bits[i] = vacant_bits;
-		else if (pos >= BigInteger(int(arg1.bits.size())))
-			result.bits[i] = sign_ext ? arg1.bits.back() : vacant_bits;
+			result.bits()[i] = vacant_bits;
+		else if (pos >= BigInteger(int(arg1.size())))
+			result[i] = sign_ext ? arg1.back() : vacant_bits;
 		else
-			result.bits[i] = arg1.bits[pos.toInt()];
+			result[i] = arg1[pos.toInt()];
 	}
 
 	return result;
 }
 
+// Shift `arg1` (extended to 64 bits according to `sign_ext`) by `arg2` bits
+// in the direction given as for const_shift_worker(). Returns false if the
+// BigInteger implementation has to be used.
+static bool word_shift(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool sign_ext, int direction, int result_len, RTLIL::Const &result)
+{
+	uint64_t a, b;
+	if (!RTLIL::const_word_ops || result_len < 0 || result_len > 64 || !const2word(arg1, sign_ext, 64, a) || !const2word(arg2, false, 64, b))
+		return false;
+
+	uint64_t fill = sign_ext && (a >> 63) ? ~uint64_t(0) : 0;
+	if (direction < 0)
+		a = b >= 64 ? 0 : a << b;
+	else
+		a = b >= 64 ? fill : b == 0 ? a : (a >> b) | (fill << (64 - b));
+
+	result = word2const(a, result_len);
+	return true;
+}
+
 RTLIL::Const RTLIL::const_shl(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool, int result_len)
 {
+	RTLIL::Const result;
+	if (word_shift(arg1, arg2, signed1, -1, result_len, result))
+		return result;
+
 	RTLIL::Const arg1_ext = arg1;
 	extend_u0(arg1_ext, result_len, signed1);
 	return const_shift_worker(arg1_ext, arg2, false, false, -1, result_len);
@@ -316,16 +404,29 @@ RTLIL::Const RTLIL::const_shr(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 {
 	RTLIL::Const arg1_ext = arg1;
 	extend_u0(arg1_ext, max(result_len, GetSize(arg1)), signed1);
+
+	RTLIL::Const result;
+	if (word_shift(arg1_ext, arg2, false, +1, result_len, result))
+		return result;
+
 	return const_shift_worker(arg1_ext, arg2, false, false, +1, result_len);
 }
 
 RTLIL::Const RTLIL::const_sshl(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool, int result_len)
 {
+	RTLIL::Const result;
+	if (word_shift(arg1, arg2, signed1, -1, result_len < 0 ? GetSize(arg1) : result_len, result))
+		return result;
+
 	return const_shift_worker(arg1, arg2, signed1, false, -1, result_len);
 }
 
 RTLIL::Const RTLIL::const_sshr(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool, int result_len)
 {
+	RTLIL::Const result;
+	if (word_shift(arg1, arg2, signed1, +1, result_len < 0 ? GetSize(arg1) : result_len, result))
+		return result;
+
 	return const_shift_worker(arg1, arg2, signed1, false, +1, result_len);
 }
 
@@ -343,23 +444,31 @@ RTLIL::Const RTLIL::const_shiftx(const RTLIL::Const &arg1, const RTLIL::Const &a
 
 RTLIL::Const RTLIL::const_lt(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	uint64_t a, b;
+	if (RTLIL::const_word_ops && const2word(arg1, signed1, 63, a) && const2word(arg2, signed2, 63, b))
+		return logic_result(int64_t(a) < int64_t(b) ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
+
 	int undef_bit_pos = -1;
 	bool y = const2big(arg1, signed1, undef_bit_pos) < const2big(arg2, signed2, undef_bit_pos);
 	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
 
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
+	while (int(result.size()) < result_len)
+		result.bits().push_back(RTLIL::State::S0);
 	return result;
 }
 
 RTLIL::Const RTLIL::const_le(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	uint64_t a, b;
+	if (RTLIL::const_word_ops && const2word(arg1, signed1, 63, a) && const2word(arg2, signed2, 63, b))
+		return logic_result(int64_t(a) <= int64_t(b) ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
+
 	int undef_bit_pos = -1;
 	bool y = const2big(arg1, signed1, undef_bit_pos) <= const2big(arg2, signed2, undef_bit_pos);
 	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
 
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
+	while (int(result.size()) < result_len)
+		result.bits().push_back(RTLIL::State::S0);
 	return result;
 }
 
@@ -369,31 +478,36 @@ RTLIL::Const RTLIL::const_eq(const RTLIL::Const &arg1, const RTLIL::Const &arg2,
 	RTLIL::Const arg2_ext = arg2;
 	RTLIL::Const result(RTLIL::State::S0, result_len);
 
-	int width = max(arg1_ext.bits.size(), arg2_ext.bits.size());
+	int width = max(arg1_ext.size(), arg2_ext.size());
 	extend_u0(arg1_ext, width, signed1 && signed2);
 	extend_u0(arg2_ext, width, signed1 && signed2);
 
+	if (RTLIL::const_word_ops && arg1_ext.is_fully_def() && arg2_ext.is_fully_def()) {
+		result.bits().front() = arg1_ext == arg2_ext ? RTLIL::State::S1 : RTLIL::State::S0;
+		return result;
+	}
+
 	RTLIL::State matched_status = RTLIL::State::S1;
-	for (size_t i = 0; i < arg1_ext.bits.size(); i++) {
-		if (arg1_ext.bits.at(i) == RTLIL::State::S0 && arg2_ext.bits.at(i) == RTLIL::State::S1)
+	for (int i = 0; i < GetSize(arg1_ext); i++) {
+		if (arg1_ext.bits().at(i) == RTLIL::State::S0 && arg2_ext.bits().at(i) == RTLIL::State::S1)
 			return result;
-		if (arg1_ext.bits.at(i) == RTLIL::State::S1 && arg2_ext.bits.at(i) == RTLIL::State::S0)
+		if (arg1_ext.bits().at(i) == RTLIL::State::S1 && arg2_ext.bits().at(i) == RTLIL::State::S0)
 			return result;
-		if (arg1_ext.bits.at(i) > RTLIL::State::S1 || arg2_ext.bits.at(i) > RTLIL::State::S1)
+		if (arg1_ext.bits().at(i) > RTLIL::State::S1 || arg2_ext.bits().at(i) > RTLIL::State::S1)
 			matched_status = RTLIL::State::Sx;
 	}
 
-	result.bits.front() = matched_status;
+	result.bits().front() = matched_status;
 	return result;
 }
 
 RTLIL::Const RTLIL::const_ne(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
 	RTLIL::Const result = RTLIL::const_eq(arg1, arg2, signed1, signed2, result_len);
-	if (result.bits.front() == RTLIL::State::S0)
-		result.bits.front() = RTLIL::State::S1;
-	else if (result.bits.front() == RTLIL::State::S1)
-		result.bits.front() = RTLIL::State::S0;
+	if (result.bits().front() == RTLIL::State::S0)
+		result.bits().front() = RTLIL::State::S1;
+	else if (result.bits().front() == RTLIL::State::S1)
+		result.bits().front() = RTLIL::State::S0;
 	return result;
 }
 
@@ -403,75 +517,124 @@ RTLIL::Const RTLIL::const_eqx(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 	RTLIL::Const arg2_ext = arg2;
 	RTLIL::Const result(RTLIL::State::S0, result_len);
 
-	int width = max(arg1_ext.bits.size(), arg2_ext.bits.size());
+	int width = max(arg1_ext.size(), arg2_ext.size());
 	extend_u0(arg1_ext, width, signed1 && signed2);
 	extend_u0(arg2_ext, width, signed1 && signed2);
 
-	for (size_t i = 0; i < arg1_ext.bits.size(); i++) {
-		if (arg1_ext.bits.at(i) != arg2_ext.bits.at(i))
-			return result;
-	}
-
-	result.bits.front() = RTLIL::State::S1;
+	if (arg1_ext == arg2_ext)
+		result.bits().front() = RTLIL::State::S1;
 	return result;
 }
 
 RTLIL::Const RTLIL::const_nex(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
 	RTLIL::Const result = RTLIL::const_eqx(arg1, arg2, signed1, signed2, result_len);
-	if (result.bits.front() == RTLIL::State::S0)
-		result.bits.front() = RTLIL::State::S1;
-	else if (result.bits.front() == RTLIL::State::S1)
-		result.bits.front() = RTLIL::State::S0;
+	if (result.bits().front() == RTLIL::State::S0)
+		result.bits().front() = RTLIL::State::S1;
+	else if (result.bits().front() == RTLIL::State::S1)
+		result.bits().front() = RTLIL::State::S0;
 	return result;
 }
 
 RTLIL::Const RTLIL::const_ge(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	uint64_t a, b;
+	if (RTLIL::const_word_ops && const2word(arg1, signed1, 63, a) && const2word(arg2, signed2, 63, b))
+		return logic_result(int64_t(a) >= int64_t(b) ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
+
 	int undef_bit_pos = -1;
 	bool y = const2big(arg1, signed1, undef_bit_pos) >= const2big(arg2, signed2, undef_bit_pos);
 	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
 
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
+	while (int(result.size()) < result_len)
+		result.bits().push_back(RTLIL::State::S0);
 	return result;
 }
 
 RTLIL::Const RTLIL::const_gt(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	uint64_t a, b;
+	if (RTLIL::const_word_ops && const2word(arg1, signed1, 63, a) && const2word(arg2, signed2, 63, b))
+		return logic_result(int64_t(a) > int64_t(b) ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
+
 	int undef_bit_pos = -1;
 	bool y = const2big(arg1, signed1, undef_bit_pos) > const2big(arg2, signed2, undef_bit_pos);
 	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
 
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
+	while (int(result.size()) < result_len)
+		result.bits().push_back(RTLIL::State::S0);
 	return result;
 }
 
+// a + b + carry_in on multi-word operands of the same size
+static std::vector<uint64_t> words_add(std::vector<uint64_t> a, const std::vector<uint64_t> &b, bool invert_b, uint64_t carry)
+{
+	for (size_t i = 0; i < a.size(); i++) {
+		uint64_t x = a[i], y = invert_b ? ~b[i] : b[i];
+		a[i] = x + y + carry;
+		carry = a[i] < x || (carry && a[i] == x);
+	}
+	return a;
+}
+
 RTLIL::Const RTLIL::const_add(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int y_len = result_len >= 0 ? result_len : max(arg1.size(), arg2.size());
+	std::vector<uint64_t> a, b;
+	if (RTLIL::const_word_ops && const2words(arg1, signed1, y_len, a) && const2words(arg2, signed2, y_len, b))
+		return RTLIL::Const::from_words(words_add(a, b, false, 0), y_len);
+
 	int undef_bit_pos = -1;
 	BigInteger y = const2big(arg1, signed1, undef_bit_pos) + const2big(arg2, signed2, undef_bit_pos);
-	return big2const(y, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), undef_bit_pos);
+	return big2const(y, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), undef_bit_pos);
 }
 
 RTLIL::Const RTLIL::const_sub(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int y_len = result_len >= 0 ? result_len : max(arg1.size(), arg2.size());
+	std::vector<uint64_t> a, b;
+	if (RTLIL::const_word_ops && const2words(arg1, signed1, y_len, a) && const2words(arg2, signed2, y_len, b))
+		return RTLIL::Const::from_words(words_add(a, b, true, 1), y_len);
+
 	int undef_bit_pos = -1;
 	BigInteger y = const2big(arg1, signed1, undef_bit_pos) - const2big(arg2, signed2, undef_bit_pos);
-	return big2const(y, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), undef_bit_pos);
+	return big2const(y, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), undef_bit_pos);
 }
 
 RTLIL::Const RTLIL::const_mul(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int y_len = result_len >= 0 ? result_len : max(arg1.size(), arg2.size());
+	std::vector<uint64_t> a, b;
+	if (RTLIL::const_word_ops && y_len <= 64 && const2words(arg1, signed1, 64, a) && const2words(arg2, signed2, 64, b))
+		return word2const(a[0] * b[0], y_len);
+
 	int undef_bit_pos = -1;
 	BigInteger y = const2big(arg1, signed1, undef_bit_pos) * const2big(arg2, signed2, undef_bit_pos);
-	return big2const(y, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), min(undef_bit_pos, 0));
+	return big2const(y, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), min(undef_bit_pos, 0));
+}
+
+// Operands for the word-parallel division and modulo: both must be fully
+// defined and at most 63 bits wide, so that their values are exact in an
+// int64_t, and the divisor must not be zero.
+static bool word_div_operands(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len, int64_t &n, int64_t &d)
+{
+	uint64_t a_word, b_word;
+	if (!RTLIL::const_word_ops || result_len > 64 || (result_len < 0 && max(arg1.size(), arg2.size()) > 64))
+		return false;
+	if (!const2word(arg1, signed1, 63, a_word) || !const2word(arg2, signed2, 63, b_word) || b_word == 0)
+		return false;
+	n = a_word;
+	d = b_word;
+	return true;
 }
 
 // truncating division
 RTLIL::Const RTLIL::const_div(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int64_t n, d;
+	if (word_div_operands(arg1, arg2, signed1, signed2, result_len, n, d))
+		return word2const(n / d, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()));
+
 	int undef_bit_pos = -1;
 	BigInteger a = const2big(arg1, signed1, undef_bit_pos);
 	BigInteger b = const2big(arg2, signed2, undef_bit_pos);
@@ -480,12 +643,16 @@ RTLIL::Const RTLIL::const_div(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 	bool result_neg = (a.getSign() == BigInteger::negative) != (b.getSign() == BigInteger::negative);
 	a = a.getSign() == BigInteger::negative ? -a : a;
 	b = b.getSign() == BigInteger::negative ? -b : b;
-	return big2const(result_neg ? -(a / b) : (a / b), result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), min(undef_bit_pos, 0));
+	return big2const(result_neg ? -(a / b) : (a / b), result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), min(undef_bit_pos, 0));
 }
 
 // truncating modulo
 RTLIL::Const RTLIL::const_mod(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int64_t n, d;
+	if (word_div_operands(arg1, arg2, signed1, signed2, result_len, n, d))
+		return word2const(n % d, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()));
+
 	int undef_bit_pos = -1;
 	BigInteger a = const2big(arg1, signed1, undef_bit_pos);
 	BigInteger b = const2big(arg2, signed2, undef_bit_pos);
@@ -494,11 +661,15 @@ RTLIL::Const RTLIL::const_mod(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 	bool result_neg = a.getSign() == BigInteger::negative;
 	a = a.getSign() == BigInteger::negative ? -a : a;
 	b = b.getSign() == BigInteger::negative ? -b : b;
-	return big2const(result_neg ? -(a % b) : (a % b), result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), min(undef_bit_pos, 0));
+	return big2const(result_neg ? -(a % b) : (a % b), result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), min(undef_bit_pos, 0));
 }
 
 RTLIL::Const RTLIL::const_divfloor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int64_t n, d;
+	if (word_div_operands(arg1, arg2, signed1, signed2, result_len, n, d))
+		return word2const((n % d != 0 && (n < 0) != (d < 0)) ? n / d - 1 : n / d, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()));
+
 	int undef_bit_pos = -1;
 	BigInteger a = const2big(arg1, signed1, undef_bit_pos);
 	BigInteger b = const2big(arg2, signed2, undef_bit_pos);
@@ -516,11 +687,15 @@ RTLIL::Const RTLIL::const_divfloor(const RTLIL::Const &arg1, const RTLIL::Const
 		// bigint division with negative numbers is wonky, make sure we only negate at the very end
 		result = -((a + b - 1) / b);
 	}
-	return big2const(result, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), min(undef_bit_pos, 0));
+	return big2const(result, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), min(undef_bit_pos, 0));
 }
 
 RTLIL::Const RTLIL::const_modfloor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
+	int64_t n, d;
+	if (word_div_operands(arg1, arg2, signed1, signed2, result_len, n, d))
+		return word2const((n % d != 0 && (n % d < 0) != (d < 0)) ? n % d + d : n % d, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()));
+
 	int undef_bit_pos = -1;
 	BigInteger a = const2big(arg1, signed1, undef_bit_pos);
 	BigInteger b = const2big(arg2, signed2, undef_bit_pos);
@@ -539,7 +714,7 @@ RTLIL::Const RTLIL::const_modfloor(const RTLIL::Const &arg1, const RTLIL::Const
 	} else {
 		modulo = b_sign == BigInteger::negative ? truncated - b : truncated + b;
 	}
-	return big2const(modulo, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), min(undef_bit_pos, 0));
+	return big2const(modulo, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), min(undef_bit_pos, 0));
 }
 
 RTLIL::Const RTLIL::const_pow(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
@@ -590,7 +765,7 @@ RTLIL::Const RTLIL::const_pow(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 			y *= -1;
 	}
 
-	return big2const(y, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), min(undef_bit_pos, 0));
+	return big2const(y, result_len >= 0 ? result_len : max(arg1.size(), arg2.size()), min(undef_bit_pos, 0));
 }
 
 RTLIL::Const RTLIL::const_pos(const RTLIL::Const &arg1, const RTLIL::Const&, bool signed1, bool, int result_len)
@@ -634,18 +809,18 @@ RTLIL::Const RTLIL::const_pmux(const RTLIL::Const &arg1, const RTLIL::Const &arg
 
 	for (int i = 0; i < arg3.size(); i++)
 		if (arg3[i] == State::S1)
-			return RTLIL::Const(std::vector<RTLIL::State>(arg2.bits.begin() + i*arg1.bits.size(), arg2.bits.begin() + (i+1)*arg1.bits.size()));
+			return arg2.extract(i*arg1.size(), arg1.size());
 
 	log_abort(); // unreachable
 }
 
 RTLIL::Const RTLIL::const_bmux(const RTLIL::Const &arg1, const RTLIL::Const &arg2)
 {
-	std::vector<RTLIL::State> t = arg1.bits;
+	std::vector<RTLIL::State> t = arg1.to_bits();
 
 	for (int i = GetSize(arg2)-1; i >= 0; i--)
 	{
-		RTLIL::State sel = arg2.bits.at(i);
+		RTLIL::State sel = arg2[i];
 		std::vector<RTLIL::State> new_t;
 		if (sel == State::S0)
 			new_t = std::vector<RTLIL::State>(t.begin(), t.begin() + GetSize(t)/2);
@@ -681,10 +856,10 @@ RTLIL::Const RTLIL::const_demux(const RTLIL::Const &arg1, const RTLIL::Const &ar
 				res.push_back(State::S0);
 		} else if (x) {
 			for (int j = 0; j < width; j++)
-				res.push_back(arg1.bits[j] == State::S0 ? State::S0 : State::Sx);
+				res.push_back(arg1[j] == State::S0 ? State::S0 : State::Sx);
 		} else {
 			for (int j = 0; j < width; j++)
-				res.push_back(arg1.bits[j]);
+				res.push_back(arg1[j]);
 		}
 	}
 	return res;
@@ -18,6 +18,7 @@
  */
 
 #include "kernel/yosys.h"
+#include "kernel/threading.h"
 #include "libs/sha1/sha1.h"
 
 #ifdef YOSYS_ENABLE_READLINE
@@ -332,6 +333,10 @@ int main(int argc, char **argv)
 		printf("    -g\n");
 		printf("        globally enable debug log messages\n");
 		printf("\n");
+		printf("    -j <threads>\n");
+		printf("        run commands that support it on up to <threads> worker threads.\n");
+		printf("        use 0 for the number of hardware threads. (default: 1)\n");
+		printf("\n");
 		printf("    -V\n");
 		printf("        print version information and exit\n");
 		printf("\n");
@@ -358,7 +363,7 @@ int main(int argc, char **argv)
 	}
 
 	int opt;
-	while ((opt = getopt(argc, argv, "MXAQTVSgm:f:Hh:b:o:p:l:L:qv:tds:c:W:w:e:r:D:P:E:x:B:")) != -1)
+	while ((opt = getopt(argc, argv, "MXAQTVSgm:f:Hh:b:o:p:l:L:qv:tds:c:W:w:e:r:D:P:E:x:B:j:")) != -1)
 	{
 		switch (opt)
 		{
@@ -496,6 +501,11 @@ int main(int argc, char **argv)
 		case 'B':
 			perffile = optarg;
 			break;
+		case 'j':
+			yosys_threads = atoi(optarg);
+			if (yosys_threads <= 0)
+				yosys_threads = hardware_threads();
+			break;
 		default:
 			fprintf(stderr, "Run '%s -h' for help.\n", argv[0]);
 			exit(1);
@@ -17,6 +17,11 @@
 #include <string>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#  define HASHLIB_SSE2
+#endif
+
 namespace hashlib {
 
 const int hashtable_size_trigger = 2;
@@ -198,9 +203,11 @@ inline int hashtable_size(int min_size)
 }
 
 template<typename K, typename T, typename OPS = hash_ops<K>> class dict;
-template<typename K, int offset = 0, typename OPS = hash_ops<K>> class idict;
 template<typename K, typename OPS = hash_ops<K>> class pool;
-template<typename K, typename OPS = hash_ops<K>> class mfp;
+template<typename K, typename T, typename OPS = hash_ops<K>> class flat_dict;
+template<typename K, typename OPS = hash_ops<K>> class flat_pool;
+template<typename K, int offset = 0, typename OPS = hash_ops<K>, typename POOL = pool<K, OPS>> class idict;
+template<typename K, typename OPS = hash_ops<K>, typename POOL = pool<K, OPS>> class mfp;
 
 template<typename K, typename T, typename OPS>
 class dict
@@ -298,16 +305,13 @@ class dict
 		return 1;
 	}
 
+	// Lookups never rehash (do_insert() grows the table eagerly), so a dict
+	// that is not modified can be read from several threads at once.
 	int do_lookup(const K &key, int &hash) const
 	{
 		if (hashtable.empty())
 			return -1;
 
-		if (entries.size() * hashtable_size_trigger > hashtable.size()) {
-			((dict*)this)->do_rehash();
-			hash = do_hash(key);
-		}
-
 		int index = hashtable[hash];
 
 		while (index >= 0 && !ops.cmp(entries[index].udata.first, key)) {
@@ -327,6 +331,10 @@ class dict
 		} else {
 			entries.emplace_back(std::pair<K, T>(key, T()), hashtable[hash]);
 			hashtable[hash] = entries.size() - 1;
+			if (entries.size() * hashtable_size_trigger > hashtable.size()) {
+				do_rehash();
+				hash = do_hash(entries.back().udata.first);
+			}
 		}
 		return entries.size() - 1;
 	}
@@ -340,6 +348,10 @@ class dict
 		} else {
 			entries.emplace_back(value, hashtable[hash]);
 			hashtable[hash] = entries.size() - 1;
+			if (entries.size() * hashtable_size_trigger > hashtable.size()) {
+				do_rehash();
+				hash = do_hash(entries.back().udata.first);
+			}
 		}
 		return entries.size() - 1;
 	}
@@ -354,6 +366,10 @@ class dict
 		} else {
 			entries.emplace_back(std::forward<std::pair<K, T>>(rvalue), hashtable[hash]);
 			hashtable[hash] = entries.size() - 1;
+			if (entries.size() * hashtable_size_trigger > hashtable.size()) {
+				do_rehash();
+				hash = do_hash(entries.back().udata.first);
+			}
 		}
 		return entries.size() - 1;
 	}
@@ -650,7 +666,7 @@ public:
 template<typename K, typename OPS>
 class pool
 {
-	template<typename, int, typename> friend class idict;
+	template<typename, int, typename, typename> friend class idict;
 
 protected:
 	struct entry_t
@@ -741,16 +757,12 @@ protected:
 		return 1;
 	}
 
+	// Lookups never rehash, see dict::do_lookup().
 	int do_lookup(const K &key, int &hash) const
 	{
 		if (hashtable.empty())
 			return -1;
 
-		if (entries.size() * hashtable_size_trigger > hashtable.size()) {
-			((pool*)this)->do_rehash();
-			hash = do_hash(key);
-		}
-
 		int index = hashtable[hash];
 
 		while (index >= 0 && !ops.cmp(entries[index].udata, key)) {
@@ -770,6 +782,10 @@ protected:
 		} else {
 			entries.emplace_back(value, hashtable[hash]);
 			hashtable[hash] = entries.size() - 1;
+			if (entries.size() * hashtable_size_trigger > hashtable.size()) {
+				do_rehash();
+				hash = do_hash(entries.back().udata);
+			}
 		}
 		return entries.size() - 1;
 	}
@@ -783,6 +799,10 @@ protected:
 		} else {
 			entries.emplace_back(std::forward<K>(rvalue), hashtable[hash]);
 			hashtable[hash] = entries.size() - 1;
+			if (entries.size() * hashtable_size_trigger > hashtable.size()) {
+				do_rehash();
+				hash = do_hash(entries.back().udata);
+			}
 		}
 		return entries.size() - 1;
 	}
@@ -1003,10 +1023,752 @@ public:
 	const_iterator end() const { return const_iterator(nullptr, -1); }
 };
 
-template<typename K, int offset, typename OPS>
+// -------------------------------------------------------
+// flat_dict and flat_pool have the same interface and iteration order as
+// dict and pool, but find entries with an open addressing index instead of
+// chained buckets: one control byte per slot, holding seven bits of the
+// hash, is compared for a whole group of 16 slots at once (with SSE2 where
+// available) before any entry is touched. Entries keep their hash, so
+// growing the index and erasing never call OPS::hash() again.
+// -------------------------------------------------------
+
+class flat_index
+{
+	template<typename, typename, typename> friend class flat_dict;
+	template<typename, typename> friend class flat_pool;
+
+	enum : int { group_size = 16 };
+	enum : signed char { ctrl_empty = -128, ctrl_deleted = -2 };
+
+	std::vector<signed char> ctrl;
+	std::vector<int> slots;
+	int growth_left = 0;
+
+	// hashlib hash functions are often just an index or a pointer, so
+	// spread them over all bits first
+	static inline unsigned int mix(unsigned int hash) {
+		return (unsigned int)((unsigned long long)hash * 0x9e3779b97f4a7c15ULL >> 32);
+	}
+
+	static inline int first_bit(unsigned int mask) {
+	#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctz(mask);
+	#else
+		int i = 0;
+		while (!(mask & 1))
+			mask >>= 1, i++;
+		return i;
+	#endif
+	}
+
+	int group_mask() const {
+		return int(slots.size()) / group_size - 1;
+	}
+
+	// bit mask of the slots in group g with the given control byte
+	unsigned int match(int g, signed char c) const {
+	#ifdef HASHLIB_SSE2
+		__m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data() + g * group_size));
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(c)));
+	#else
+		unsigned int mask = 0;
+		for (int i = 0; i < group_size; i++)
+			if (ctrl[g * group_size + i] == c)
+				mask |= 1u << i;
+		return mask;
+	#endif
+	}
+
+	// bit mask of the empty or deleted slots in group g
+	unsigned int match_free(int g) const {
+	#ifdef HASHLIB_SSE2
+		__m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data() + g * group_size));
+		return _mm_movemask_epi8(group);
+	#else
+		unsigned int mask = 0;
+		for (int i = 0; i < group_size; i++)
+			if (ctrl[g * group_size + i] < 0)
+				mask |= 1u << i;
+		return mask;
+	#endif
+	}
+
+	// Calls found(slot) for the slots whose control byte matches the hash,
+	// in probe order, until it returns true. Returns that slot or -1.
+	template<typename F>
+	int probe(unsigned int hash, F found) const
+	{
+		if (slots.empty())
+			return -1;
+		unsigned int h = mix(hash);
+		signed char h2 = h & 0x7f;
+		int mask = group_mask();
+		int g = (h >> 7) & mask;
+		// triangular probing visits every group when their number is a
+		// power of two, and there is always an empty slot somewhere
+		for (int step = 1;; step++) {
+			for (unsigned int m = match(g, h2); m; m &= m - 1) {
+				int slot = g * group_size + first_bit(m);
+				if (found(slot))
+					return slot;
+			}
+			if (match(g, ctrl_empty))
+				return -1;
+			g = (g + step) & mask;
+		}
+	}
+
+	void insert(unsigned int hash, int index)
+	{
+		unsigned int h = mix(hash);
+		int mask = group_mask();
+		int g = (h >> 7) & mask;
+		for (int step = 1;; step++) {
+			unsigned int m = match_free(g);
+			if (m) {
+				int slot = g * group_size + first_bit(m);
+				if (ctrl[slot] == ctrl_empty)
+					growth_left--;
+				ctrl[slot] = h & 0x7f;
+				slots[slot] = index;
+				return;
+			}
+			g = (g + step) & mask;
+		}
+	}
+
+	void erase(unsigned int hash, int index)
+	{
+		int slot = probe(hash, [&](int s) { return slots[s] == index; });
+		if (slot < 0)
+			throw std::runtime_error("flat_index::erase() failed.");
+		// a lookup only continues past a group without empty slots
+		if (match(slot / group_size, ctrl_empty)) {
+			ctrl[slot] = ctrl_empty;
+			growth_left++;
+		} else
+			ctrl[slot] = ctrl_deleted;
+	}
+
+	void relink(unsigned int hash, int old_index, int new_index)
+	{
+		int slot = probe(hash, [&](int s) { return slots[s] == old_index; });
+		if (slot < 0)
+			throw std::runtime_error("flat_index::relink() failed.");
+		slots[slot] = new_index;
+	}
+
+	// size the index for n entries (at most 7/8 of the slots are used)
+	void reset(size_t n)
+	{
+		size_t capacity = group_size;
+		while (capacity - capacity / 8 < n)
+			capacity *= 2;
+		if (capacity > size_t(0x40000000))
+			throw std::length_error("hash table exceeded maximum size.");
+		ctrl.assign(capacity, (signed char)ctrl_empty);
+		slots.assign(capacity, -1);
+		growth_left = capacity - capacity / 8;
+	}
+
+	void clear()
+	{
+		ctrl.clear();
+		slots.clear();
+		growth_left = 0;
+	}
+
+	void swap(flat_index &other)
+	{
+		ctrl.swap(other.ctrl);
+		slots.swap(other.slots);
+		std::swap(growth_left, other.growth_left);
+	}
+};
+
+template<typename K, typename T, typename OPS>
+class flat_dict
+{
+	struct entry_t
+	{
+		std::pair<K, T> udata;
+		unsigned int hash;
+
+		entry_t() { }
+		entry_t(const std::pair<K, T> &udata, unsigned int hash) : udata(udata), hash(hash) { }
+		entry_t(std::pair<K, T> &&udata, unsigned int hash) : udata(std::move(udata)), hash(hash) { }
+	};
+
+	flat_index index;
+	std::vector<entry_t> entries;
+	OPS ops;
+
+	unsigned int do_hash(const K &key) const
+	{
+		return ops.hash(key);
+	}
+
+	void do_rehash(size_t n)
+	{
+		index.reset(n);
+		for (int i = 0; i < int(entries.size()); i++)
+			index.insert(entries[i].hash, i);
+	}
+
+	int do_lookup(const K &key, unsigned int hash) const
+	{
+		int slot = index.probe(hash, [&](int s) {
+			const entry_t &entry = entries[index.slots[s]];
+			return entry.hash == hash && ops.cmp(entry.udata.first, key);
+		});
+		return slot < 0 ? -1 : index.slots[slot];
+	}
+
+	int do_insert(std::pair<K, T> &&value, unsigned int hash)
+	{
+		entries.emplace_back(std::move(value), hash);
+		if (index.growth_left == 0)
+			do_rehash(2 * entries.size());
+		else
+			index.insert(hash, entries.size() - 1);
+		return entries.size() - 1;
+	}
+
+	int do_erase(int i)
+	{
+		if (i < 0)
+			return 0;
+		index.erase(entries[i].hash, i);
+		int back_idx = entries.size() - 1;
+		if (i != back_idx) {
+			index.relink(entries[back_idx].hash, back_idx, i);
+			entries[i] = std::move(entries[back_idx]);
+		}
+		entries.pop_back();
+		if (entries.empty())
+			index.clear();
+		return 1;
+	}
+
+public:
+	class const_iterator : public std::iterator<std::forward_iterator_tag, std::pair<K, T>>
+	{
+		friend class flat_dict;
+	protected:
+		const flat_dict *ptr;
+		int index;
+		const_iterator(const flat_dict *ptr, int index) : ptr(ptr), index(index) { }
+	public:
+		const_iterator() { }
+		const_iterator operator++() { index--; return *this; }
+		const_iterator operator+=(int amt) { index -= amt; return *this; }
+		bool operator<(const const_iterator &other) const { return index > other.index; }
+		bool operator==(const const_iterator &other) const { return index == other.index; }
+		bool operator!=(const const_iterator &other) const { return index != other.index; }
+		const std::pair<K, T> &operator*() const { return ptr->entries[index].udata; }
+		const std::pair<K, T> *operator->() const { return &ptr->entries[index].udata; }
+	};
+
+	class iterator : public std::iterator<std::forward_iterator_tag, std::pair<K, T>>
+	{
+		friend class flat_dict;
+	protected:
+		flat_dict *ptr;
+		int index;
+		iterator(flat_dict *ptr, int index) : ptr(ptr), index(index) { }
+	public:
+		iterator() { }
+		iterator operator++() { index--; return *this; }
+		iterator operator+=(int amt) { index -= amt; return *this; }
+		bool operator<(const iterator &other) const { return index > other.index; }
+		bool operator==(const iterator &other) const { return index == other.index; }
+		bool operator!=(const iterator &other) const { return index != other.index; }
+		std::pair<K, T> &operator*() { return ptr->entries[index].udata; }
+		std::pair<K, T> *operator->() { return &ptr->entries[index].udata; }
+		const std::pair<K, T> &operator*() const { return ptr->entries[index].udata; }
+		const std::pair<K, T> *operator->() const { return &ptr->entries[index].udata; }
+		operator const_iterator() const { return const_iterator(ptr, index); }
+	};
+
+	flat_dict()
+	{
+	}
+
+	flat_dict(const flat_dict &other) = default;
+
+	flat_dict(flat_dict &&other)
+	{
+		swap(other);
+	}
+
+	flat_dict &operator=(const flat_dict &other) = default;
+
+	flat_dict &operator=(flat_dict &&other) {
+		clear();
+		swap(other);
+		return *this;
+	}
+
+	flat_dict(const std::initializer_list<std::pair<K, T>> &list)
+	{
+		for (auto &it : list)
+			insert(it);
+	}
+
+	template<class InputIterator>
+	flat_dict(InputIterator first, InputIterator last)
+	{
+		insert(first, last);
+	}
+
+	template<class InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			insert(*first);
+	}
+
+	std::pair<iterator, bool> insert(const K &key)
+	{
+		unsigned int hash = do_hash(key);
+		int i = do_lookup(key, hash);
+		if (i >= 0)
+			return std::pair<iterator, bool>(iterator(this, i), false);
+		i = do_insert(std::pair<K, T>(key, T()), hash);
+		return std::pair<iterator, bool>(iterator(this, i), true);
+	}
+
+	std::pair<iterator, bool> insert(const std::pair<K, T> &value)
+	{
+		unsigned int hash = do_hash(value.first);
+		int i = do_lookup(value.first, hash);
+		if (i >= 0)
+			return std::pair<iterator, bool>(iterator(this, i), false);
+		i = do_insert(std::pair<K, T>(value), hash);
+		return std::pair<iterator, bool>(iterator(this, i), true);
+	}
+
+	std::pair<iterator, bool> insert(std::pair<K, T> &&rvalue)
+	{
+		unsigned int hash = do_hash(rvalue.first);
+		int i = do_lookup(rvalue.first, hash);
+		if (i >= 0)
+			return std::pair<iterator, bool>(iterator(this, i), false);
+		i = do_insert(std::move(rvalue), hash);
+		return std::pair<iterator, bool>(iterator(this, i), true);
+	}
+
+	template<typename KK, typename TT>
+	std::pair<iterator, bool> emplace(KK &&key, TT &&value)
+	{
+		return insert(std::pair<K, T>(std::forward<KK>(key), std::forward<TT>(value)));
+	}
+
+	int erase(const K &key)
+	{
+		return do_erase(do_lookup(key, do_hash(key)));
+	}
+
+	iterator erase(iterator it)
+	{
+		do_erase(it.index);
+		return ++it;
+	}
+
+	int count(const K &key) const
+	{
+		return do_lookup(key, do_hash(key)) < 0 ? 0 : 1;
+	}
+
+	int count(const K &key, const_iterator it) const
+	{
+		int i = do_lookup(key, do_hash(key));
+		return i < 0 || i > it.index ? 0 : 1;
+	}
+
+	iterator find(const K &key)
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			return end();
+		return iterator(this, i);
+	}
+
+	const_iterator find(const K &key) const
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			return end();
+		return const_iterator(this, i);
+	}
+
+	T& at(const K &key)
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			throw std::out_of_range("flat_dict::at()");
+		return entries[i].udata.second;
+	}
+
+	const T& at(const K &key) const
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			throw std::out_of_range("flat_dict::at()");
+		return entries[i].udata.second;
+	}
+
+	const T& at(const K &key, const T &defval) const
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			return defval;
+		return entries[i].udata.second;
+	}
+
+	T& operator[](const K &key)
+	{
+		unsigned int hash = do_hash(key);
+		int i = do_lookup(key, hash);
+		if (i < 0)
+			i = do_insert(std::pair<K, T>(key, T()), hash);
+		return entries[i].udata.second;
+	}
+
+	template<typename Compare = std::less<K>>
+	void sort(Compare comp = Compare())
+	{
+		std::sort(entries.begin(), entries.end(), [comp](const entry_t &a, const entry_t &b){ return comp(b.udata.first, a.udata.first); });
+		do_rehash(entries.size());
+	}
+
+	void swap(flat_dict &other)
+	{
+		index.swap(other.index);
+		entries.swap(other.entries);
+	}
+
+	bool operator==(const flat_dict &other) const {
+		if (size() != other.size())
+			return false;
+		for (auto &it : entries) {
+			auto oit = other.find(it.udata.first);
+			if (oit == other.end() || !(oit->second == it.udata.second))
+				return false;
+		}
+		return true;
+	}
+
+	bool operator!=(const flat_dict &other) const {
+		return !operator==(other);
+	}
+
+	unsigned int hash() const {
+		unsigned int h = mkhash_init;
+		for (auto &entry : entries) {
+			h ^= hash_ops<K>::hash(entry.udata.first);
+			h ^= hash_ops<T>::hash(entry.udata.second);
+		}
+		return h;
+	}
+
+	void reserve(size_t n) {
+		entries.reserve(n);
+		if (size_t(index.growth_left) + entries.size() < n)
+			do_rehash(n);
+	}
+	size_t size() const { return entries.size(); }
+	bool empty() const { return entries.empty(); }
+	void clear() { index.clear(); entries.clear(); }
+
+	iterator begin() { return iterator(this, int(entries.size())-1); }
+	iterator element(int n) { return iterator(this, int(entries.size())-1-n); }
+	iterator end() { return iterator(nullptr, -1); }
+
+	const_iterator begin() const { return const_iterator(this, int(entries.size())-1); }
+	const_iterator element(int n) const { return const_iterator(this, int(entries.size())-1-n); }
+	const_iterator end() const { return const_iterator(nullptr, -1); }
+};
+
+template<typename K, typename OPS>
+class flat_pool
+{
+	template<typename, int, typename, typename> friend class idict;
+
+protected:
+	struct entry_t
+	{
+		K udata;
+		unsigned int hash;
+
+		entry_t() { }
+		entry_t(const K &udata, unsigned int hash) : udata(udata), hash(hash) { }
+		entry_t(K &&udata, unsigned int hash) : udata(std::move(udata)), hash(hash) { }
+	};
+
+	flat_index index;
+	std::vector<entry_t> entries;
+	OPS ops;
+
+	// same signatures as in pool<>, for idict<>
+	int do_hash(const K &key) const
+	{
+		return ops.hash(key);
+	}
+
+	void do_rehash(size_t n)
+	{
+		index.reset(n);
+		for (int i = 0; i < int(entries.size()); i++)
+			index.insert(entries[i].hash, i);
+	}
+
+	int do_lookup(const K &key, int hash) const
+	{
+		int slot = index.probe(hash, [&](int s) {
+			const entry_t &entry = entries[index.slots[s]];
+			return entry.hash == (unsigned int)hash && ops.cmp(entry.udata, key);
+		});
+		return slot < 0 ? -1 : index.slots[slot];
+	}
+
+	int do_insert(const K &value, int hash)
+	{
+		return do_insert(K(value), hash);
+	}
+
+	int do_insert(K &&rvalue, int hash)
+	{
+		entries.emplace_back(std::move(rvalue), hash);
+		if (index.growth_left == 0)
+			do_rehash(2 * entries.size());
+		else
+			index.insert(hash, entries.size() - 1);
+		return entries.size() - 1;
+	}
+
+	int do_erase(int i)
+	{
+		if (i < 0)
+			return 0;
+		index.erase(entries[i].hash, i);
+		int back_idx = entries.size() - 1;
+		if (i != back_idx) {
+			index.relink(entries[back_idx].hash, back_idx, i);
+			entries[i] = std::move(entries[back_idx]);
+		}
+		entries.pop_back();
+		if (entries.empty())
+			index.clear();
+		return 1;
+	}
+
+public:
+	class const_iterator : public std::iterator<std::forward_iterator_tag, K>
+	{
+		friend class flat_pool;
+	protected:
+		const flat_pool *ptr;
+		int index;
+		const_iterator(const flat_pool *ptr, int index) : ptr(ptr), index(index) { }
+	public:
+		const_iterator() { }
+		const_iterator operator++() { index--; return *this; }
+		bool operator==(const const_iterator &other) const { return index == other.index; }
+		bool operator!=(const const_iterator &other) const { return index != other.index; }
+		const K &operator*() const { return ptr->entries[index].udata; }
+		const K *operator->() const { return &ptr->entries[index].udata; }
+	};
+
+	class iterator : public std::iterator<std::forward_iterator_tag, K>
+	{
+		friend class flat_pool;
+	protected:
+		flat_pool *ptr;
+		int index;
+		iterator(flat_pool *ptr, int index) : ptr(ptr), index(index) { }
+	public:
+		iterator() { }
+		iterator operator++() { index--; return *this; }
+		bool operator==(const iterator &other) const { return index == other.index; }
+		bool operator!=(const iterator &other) const { return index != other.index; }
+		K &operator*() { return ptr->entries[index].udata; }
+		K *operator->() { return &ptr->entries[index].udata; }
+		const K &operator*() const { return ptr->entries[index].udata; }
+		const K *operator->() const { return &ptr->entries[index].udata; }
+		operator const_iterator() const { return const_iterator(ptr, index); }
+	};
+
+	flat_pool()
+	{
+	}
+
+	flat_pool(const flat_pool &other) = default;
+
+	flat_pool(flat_pool &&other)
+	{
+		swap(other);
+	}
+
+	flat_pool &operator=(const flat_pool &other) = default;
+
+	flat_pool &operator=(flat_pool &&other) {
+		clear();
+		swap(other);
+		return *this;
+	}
+
+	flat_pool(const std::initializer_list<K> &list)
+	{
+		for (auto &it : list)
+			insert(it);
+	}
+
+	template<class InputIterator>
+	flat_pool(InputIterator first, InputIterator last)
+	{
+		insert(first, last);
+	}
+
+	template<class InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			insert(*first);
+	}
+
+	std::pair<iterator, bool> insert(const K &value)
+	{
+		int hash = do_hash(value);
+		int i = do_lookup(value, hash);
+		if (i >= 0)
+			return std::pair<iterator, bool>(iterator(this, i), false);
+		i = do_insert(value, hash);
+		return std::pair<iterator, bool>(iterator(this, i), true);
+	}
+
+	std::pair<iterator, bool> insert(K &&rvalue)
+	{
+		int hash = do_hash(rvalue);
+		int i = do_lookup(rvalue, hash);
+		if (i >= 0)
+			return std::pair<iterator, bool>(iterator(this, i), false);
+		i = do_insert(std::move(rvalue), hash);
+		return std::pair<iterator, bool>(iterator(this, i), true);
+	}
+
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Args&&... args)
+	{
+		return insert(K(std::forward<Args>(args)...));
+	}
+
+	int erase(const K &key)
+	{
+		return do_erase(do_lookup(key, do_hash(key)));
+	}
+
+	iterator erase(iterator it)
+	{
+		do_erase(it.index);
+		return ++it;
+	}
+
+	int count(const K &key) const
+	{
+		return do_lookup(key, do_hash(key)) < 0 ? 0 : 1;
+	}
+
+	int count(const K &key, const_iterator it) const
+	{
+		int i = do_lookup(key, do_hash(key));
+		return i < 0 || i > it.index ? 0 : 1;
+	}
+
+	iterator find(const K &key)
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			return end();
+		return iterator(this, i);
+	}
+
+	const_iterator find(const K &key) const
+	{
+		int i = do_lookup(key, do_hash(key));
+		if (i < 0)
+			return end();
+		return const_iterator(this, i);
+	}
+
+	bool operator[](const K &key)
+	{
+		return do_lookup(key, do_hash(key)) >= 0;
+	}
+
+	template<typename Compare = std::less<K>>
+	void sort(Compare comp = Compare())
+	{
+		std::sort(entries.begin(), entries.end(), [comp](const entry_t &a, const entry_t &b){ return comp(b.udata, a.udata); });
+		do_rehash(entries.size());
+	}
+
+	K pop()
+	{
+		iterator it = begin();
+		K ret = *it;
+		erase(it);
+		return ret;
+	}
+
+	void swap(flat_pool &other)
+	{
+		index.swap(other.index);
+		entries.swap(other.entries);
+	}
+
+	bool operator==(const flat_pool &other) const {
+		if (size() != other.size())
+			return false;
+		for (auto &it : entries)
+			if (!other.count(it.udata))
+				return false;
+		return true;
+	}
+
+	bool operator!=(const flat_pool &other) const {
+		return !operator==(other);
+	}
+
+	unsigned int hash() const {
+		unsigned int hashval = mkhash_init;
+		for (auto &it : entries)
+			hashval ^= ops.hash(it.udata);
+		return hashval;
+	}
+
+	void reserve(size_t n) {
+		entries.reserve(n);
+		if (size_t(index.growth_left) + entries.size() < n)
+			do_rehash(n);
+	}
+	size_t size() const { return entries.size(); }
+	bool empty() const { return entries.empty(); }
+	void clear() { index.clear(); entries.clear(); }
+
+	iterator begin() { return iterator(this, int(entries.size())-1); }
+	iterator element(int n) { return iterator(this, int(entries.size())-1-n); }
+	iterator end() { return iterator(nullptr, -1); }
+
+	const_iterator begin() const { return const_iterator(this, int(entries.size())-1); }
+	const_iterator element(int n) const { return const_iterator(this, int(entries.size())-1-n); }
+	const_iterator end() const { return const_iterator(nullptr, -1); }
+};
+
+template<typename K, int offset, typename OPS, typename POOL>
 class idict
 {
-	pool<K, OPS> database;
+	POOL database;
 
 public:
 	class const_iterator : public std::iterator<std::forward_iterator_tag, K>
@@ -1086,14 +1848,14 @@ public:
 	const_iterator end() const { return const_iterator(*this, offset + size()); }
 };
 
-template<typename K, typename OPS>
+template<typename K, typename OPS, typename POOL>
 class mfp
 {
-	mutable idict<K, 0, OPS> database;
+	mutable idict<K, 0, OPS, POOL> database;
 	mutable std::vector<int> parents;
 
 public:
-	typedef typename idict<K, 0, OPS>::const_iterator const_iterator;
+	typedef typename idict<K, 0, OPS, POOL>::const_iterator const_iterator;
 
 	int operator()(const K &key) const
 	{
@@ -61,12 +61,13 @@ void (*log_error_atexit)() = NULL;
 
 int log_make_debug = 0;
 int log_force_debug = 0;
-int log_debug_suppressed = 0;
+thread_local int log_debug_suppressed = 0;
 
 vector<int> header_count;
-vector<char*> log_id_cache;
-vector<shared_str> string_buf;
-int string_buf_index = -1;
+static thread_local vector<char*> log_id_cache;
+static thread_local vector<shared_str> string_buf;
+static thread_local int string_buf_index = -1;
+static thread_local LogCapture *log_capture = nullptr;
 
 static struct timeval initial_tv = { 0, 0 };
 static bool next_print_log = false;
@@ -114,6 +115,11 @@ void logv(const char *format, va_list ap)
 	if (str.empty())
 		return;
 
+	if (log_capture != nullptr) {
+		log_capture->messages.push_back(std::make_tuple(LogCapture::LOG, std::string(), str));
+		return;
+	}
+
 	size_t nnl_pos = str.find_last_not_of('\n');
 	if (nnl_pos == std::string::npos)
 		log_newline_count += GetSize(str);
@@ -194,6 +200,12 @@ void logv_header(RTLIL::Design *design, const char *format, va_list ap)
 {
 	bool pop_errfile = false;
 
+	if (log_capture != nullptr) {
+		log_capture->messages.push_back(std::make_tuple(LogCapture::HEADER, std::string(), vstringf(format, ap)));
+		log_capture->header_design = design;
+		return;
+	}
+
 	log_spacer();
 	if (header_count.size() > 0)
 		header_count.back()++;
@@ -235,6 +247,11 @@ static void logv_warning_with_prefix(const char *prefix,
 	std::string message = vstringf(format, ap);
 	bool suppressed = false;
 
+	if (log_capture != nullptr) {
+		log_capture->messages.push_back(std::make_tuple(LogCapture::WARNING, std::string(prefix), message));
+		return;
+	}
+
 	for (auto &re : log_nowarn_regexes)
 		if (YS_REGEX_NS::regex_search(message, re))
 			suppressed = true;
@@ -321,6 +338,13 @@ void log_file_info(const std::string &filename, int lineno,
 static void logv_error_with_prefix(const char *prefix,
                                    const char *format, va_list ap)
 {
+	if (log_capture != nullptr) {
+		log_capture->has_error = true;
+		log_capture->error_prefix = prefix;
+		log_capture->error_message = vstringf(format, ap);
+		throw log_capture_error_exception();
+	}
+
 #ifdef EMSCRIPTEN
 	auto backup_log_files = log_files;
 #endif
@@ -438,7 +462,10 @@ void log_cmd_error(const char *format, ...)
 	va_list ap;
 	va_start(ap, format);
 
-	if (log_cmd_error_throw) {
+	if (log_capture != nullptr)
+		log_capture->cmd_error = true;
+
+	if (log_cmd_error_throw && log_capture == nullptr) {
 		log_last_error = vstringf(format, ap);
 		log("ERROR: %s", log_last_error.c_str());
 		log_flush();
@@ -448,6 +475,73 @@ void log_cmd_error(const char *format, ...)
 	logv_error(format, ap);
 }
 
+static void log_warning_with_prefix(const char *prefix, const char *format, ...)
+{
+	va_list ap;
+	va_start(ap, format);
+	logv_warning_with_prefix(prefix, format, ap);
+	va_end(ap);
+}
+
+[[noreturn]]
+static void log_error_with_prefix(const char *prefix, const char *format, ...)
+{
+	va_list ap;
+	va_start(ap, format);
+	logv_error_with_prefix(prefix, format, ap);
+}
+
+void LogCapture::replay()
+{
+	log_assert(log_capture != this);
+
+	for (auto &it : messages) {
+		if (std::get<0>(it) == LOG)
+			log("%s", std::get<2>(it).c_str());
+		else if (std::get<0>(it) == HEADER)
+			log_header(header_design, "%s", std::get<2>(it).c_str());
+		else if (std::get<0>(it) == PUSH)
+			log_push();
+		else if (std::get<0>(it) == POP)
+			log_pop();
+		else
+			log_warning_with_prefix(std::get<1>(it).c_str(), "%s", std::get<2>(it).c_str());
+	}
+	messages.clear();
+
+	if (has_error) {
+		has_error = false;
+		if (cmd_error)
+			log_cmd_error("%s", error_message.c_str());
+		log_error_with_prefix(error_prefix.c_str(), "%s", error_message.c_str());
+	}
+}
+
+void log_capture_begin(LogCapture *capture)
+{
+	log_assert(capture->outer == nullptr);
+	capture->outer = log_capture;
+	log_capture = capture;
+}
+
+void log_capture_end()
+{
+	log_assert(log_capture != nullptr);
+	LogCapture *outer = log_capture->outer;
+	log_capture->outer = nullptr;
+	if (outer != nullptr) {
+		log_capture = outer;
+		return;
+	}
+	if (!log_capture->has_error)
+		log_suppressed();
+	log_capture = nullptr;
+	log_debug_suppressed = 0;
+	log_id_cache_clear();
+	string_buf.clear();
+	string_buf_index = -1;
+}
+
 void log_spacer()
 {
 	if (log_newline_count < 2) log("\n");
@@ -456,11 +550,22 @@ void log_spacer()
 
 void log_push()
 {
+	if (log_capture != nullptr) {
+		log_capture->messages.push_back(std::make_tuple(LogCapture::PUSH, std::string(), std::string()));
+		return;
+	}
 	header_count.push_back(0);
 }
 
 void log_pop()
 {
+	if (log_capture != nullptr) {
+		log_capture->messages.push_back(std::make_tuple(LogCapture::POP, std::string(), std::string()));
+		log_id_cache_clear();
+		string_buf.clear();
+		string_buf_index = -1;
+		return;
+	}
 	header_count.pop_back();
 	log_id_cache_clear();
 	string_buf.clear();
@@ -153,7 +153,7 @@ extern void (*log_error_atexit)();
 
 extern int log_make_debug;
 extern int log_force_debug;
-extern int log_debug_suppressed;
+extern thread_local int log_debug_suppressed;
 
 void logv(const char *format, va_list ap);
 void logv_header(RTLIL::Design *design, const char *format, va_list ap);
@@ -217,6 +217,56 @@ void log_spacer();
 void log_push();
 void log_pop();
 
+// Log messages, warnings, headers and errors produced while a LogCapture is
+// active on the current thread are recorded instead of printed. This is used
+// for work that runs on worker threads (see kernel/threading.h): replay() then
+// prints the recorded messages on the main thread, in a deterministic order.
+// Headers and log_push()/log_pop() are replayed as well, so their numbering
+// matches a serial run.
+// Captures nest: messages replayed while another capture is active are
+// recorded by that capture.
+
+struct log_capture_error_exception { };
+
+struct LogCapture
+{
+	enum kind_t { LOG, WARNING, HEADER, PUSH, POP };
+	std::vector<std::tuple<kind_t, std::string, std::string>> messages;
+
+	// the design passed to the last captured log_header() call
+	RTLIL::Design *header_design = nullptr;
+
+	// Set when the captured code called log_error() or log_cmd_error(). The
+	// error is re-raised by replay() after printing all other messages.
+	bool has_error = false, cmd_error = false;
+	std::string error_prefix, error_message;
+
+	// the capture that was active when this one began
+	LogCapture *outer = nullptr;
+
+	void replay();
+};
+
+void log_capture_begin(LogCapture *capture);
+void log_capture_end();
+
+// Ends the capture when leaving the scope, also when the captured code throws
+// something other than log_capture_error_exception.
+struct LogCaptureGuard
+{
+	bool active = true;
+
+	LogCaptureGuard(LogCapture *capture) { log_capture_begin(capture); }
+	~LogCaptureGuard() { end(); }
+
+	void end() {
+		if (active) {
+			active = false;
+			log_capture_end();
+		}
+	}
+};
+
 void log_backtrace(const char *prefix, int levels);
 void log_reset_stack();
 void log_flush();
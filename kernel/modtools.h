@@ -574,6 +574,206 @@ struct ModWalker
 	}
 };
 
+// A frozen snapshot of a module's netlist for read-only graph traversals.
+// Signal bits (after SigMap) and cells are numbered densely, and the drivers
+// and consumers of each bit and the input and output bits of each cell are
+// stored in contiguous (CSR) arrays, so traversals index vectors instead of
+// hashing SigBits and Cell pointers. The snapshot does not follow changes of
+// the module.
+struct ModGraph
+{
+	struct PortBit
+	{
+		int cell;	// cell id
+		int port;	// index into ports
+		int offset;
+	};
+
+	template<typename T>
+	struct Range
+	{
+		const T *begin_, *end_;
+		const T *begin() const { return begin_; }
+		const T *end() const { return end_; }
+		int size() const { return end_ - begin_; }
+		bool empty() const { return begin_ == end_; }
+		const T &operator[](int index) const { return begin_[index]; }
+	};
+
+	RTLIL::Module *module;
+	SigMap sigmap;
+
+	idict<RTLIL::SigBit, 0, hash_ops<RTLIL::SigBit>, flat_pool<RTLIL::SigBit>> bits;
+	idict<RTLIL::Cell*, 0, hash_ops<RTLIL::Cell*>, flat_pool<RTLIL::Cell*>> cells;
+	idict<RTLIL::IdString> ports;
+
+	// the entries for bit (or cell) i are [*_start[i], *_start[i+1])
+	std::vector<int> driver_start, consumer_start;
+	std::vector<PortBit> driver_list, consumer_list;
+	std::vector<int> input_start, output_start;
+	std::vector<int> input_list, output_list;
+
+	// bits of the module's input and output ports
+	std::vector<bool> port_input, port_output;
+
+	// all cells of the module
+	ModGraph(RTLIL::Module *module) : module(module)
+	{
+		std::vector<RTLIL::Cell*> all_cells;
+		for (auto cell : module->cells())
+			all_cells.push_back(cell);
+		setup(all_cells);
+	}
+
+	// only the given cells (e.g. module->selected_cells())
+	ModGraph(RTLIL::Module *module, const std::vector<RTLIL::Cell*> &cells) : module(module)
+	{
+		setup(cells);
+	}
+
+	// only the given cells, with port directions from celltypes instead of
+	// Cell::input()/output(); all ports of unknown cell types count as both
+	ModGraph(RTLIL::Module *module, const std::vector<RTLIL::Cell*> &cells, const CellTypes &celltypes) :
+			module(module), celltypes(&celltypes)
+	{
+		setup(cells);
+	}
+
+	int num_bits() const { return GetSize(bits); }
+	int num_cells() const { return GetSize(cells); }
+
+	// -1 for constant bits
+	int bit_id(RTLIL::SigBit bit) const { return bits.at(sigmap(bit), -1); }
+	int cell_id(RTLIL::Cell *cell) const { return cells.at(cell, -1); }
+
+	RTLIL::SigBit bit(int id) const { return bits[id]; }
+	RTLIL::Cell *cell(int id) const { return cells[id]; }
+	RTLIL::Cell *cell(const PortBit &pb) const { return cells[pb.cell]; }
+	RTLIL::IdString port(const PortBit &pb) const { return ports[pb.port]; }
+
+	Range<PortBit> drivers(int bit) const { return range(driver_list, driver_start, bit); }
+	Range<PortBit> consumers(int bit) const { return range(consumer_list, consumer_start, bit); }
+
+	// input and output bit ids of a cell in connection order, constants omitted
+	Range<int> inputs(int cell) const { return range(input_list, input_start, cell); }
+	Range<int> outputs(int cell) const { return range(output_list, output_start, cell); }
+
+private:
+	const CellTypes *celltypes = nullptr;
+
+	template<typename T>
+	static Range<T> range(const std::vector<T> &list, const std::vector<int> &start, int index) {
+		Range<T> r;
+		r.begin_ = list.data() + start[index];
+		r.end_ = list.data() + start[index + 1];
+		return r;
+	}
+
+	// turn per-index counts into start offsets
+	static void make_starts(std::vector<int> &start) {
+		int sum = 0;
+		for (auto &s : start) {
+			int n = s;
+			s = sum;
+			sum += n;
+		}
+	}
+
+	void setup(const std::vector<RTLIL::Cell*> &cell_list)
+	{
+		sigmap.set(module);
+
+		for (auto wire : module->wires())
+			for (auto bit : sigmap(wire))
+				if (bit.wire != nullptr)
+					bits(bit);
+		for (auto cell : cell_list)
+			cells(cell);
+
+		struct Edge {
+			int bit;
+			PortBit pb;
+			bool is_input, is_output;
+		};
+		std::vector<Edge> edges;
+
+		for (auto cell : cell_list)
+			for (auto &conn : cell->connections()) {
+				bool is_input = true, is_output = true;
+				if (celltypes == nullptr) {
+					is_input = cell->input(conn.first);
+					is_output = cell->output(conn.first);
+				} else if (celltypes->cell_known(cell->type)) {
+					is_input = celltypes->cell_input(cell->type, conn.first);
+					is_output = celltypes->cell_output(cell->type, conn.first);
+				}
+				if (!is_input && !is_output)
+					continue;
+				int port = ports(conn.first);
+				RTLIL::SigSpec sig = sigmap(conn.second);
+				for (int i = 0; i < GetSize(sig); i++)
+					if (sig[i].wire != nullptr) {
+						Edge e = { bits(sig[i]), { cells.at(cell), port, i }, is_input, is_output };
+						edges.push_back(e);
+					}
+			}
+
+		driver_start.assign(num_bits() + 1, 0);
+		consumer_start.assign(num_bits() + 1, 0);
+		input_start.assign(num_cells() + 1, 0);
+		output_start.assign(num_cells() + 1, 0);
+
+		for (auto &e : edges) {
+			if (e.is_output)
+				driver_start[e.bit]++, output_start[e.pb.cell]++;
+			if (e.is_input)
+				consumer_start[e.bit]++, input_start[e.pb.cell]++;
+		}
+
+		make_starts(driver_start);
+		make_starts(consumer_start);
+		make_starts(input_start);
+		make_starts(output_start);
+
+		driver_list.resize(driver_start.back());
+		consumer_list.resize(consumer_start.back());
+		input_list.resize(input_start.back());
+		output_list.resize(output_start.back());
+
+		// fill in edge order, using a copy of each index's start as its cursor
+		std::vector<int> driver_pos(driver_start.begin(), driver_start.end() - 1);
+		std::vector<int> consumer_pos(consumer_start.begin(), consumer_start.end() - 1);
+		std::vector<int> input_pos(input_start.begin(), input_start.end() - 1);
+		std::vector<int> output_pos(output_start.begin(), output_start.end() - 1);
+
+		for (auto &e : edges) {
+			if (e.is_output) {
+				driver_list[driver_pos[e.bit]++] = e.pb;
+				output_list[output_pos[e.pb.cell]++] = e.bit;
+			}
+			if (e.is_input) {
+				consumer_list[consumer_pos[e.bit]++] = e.pb;
+				input_list[input_pos[e.pb.cell]++] = e.bit;
+			}
+		}
+
+		port_input.assign(num_bits(), false);
+		port_output.assign(num_bits(), false);
+		for (auto wire : module->wires()) {
+			if (!wire->port_input && !wire->port_output)
+				continue;
+			for (auto bit : sigmap(wire)) {
+				if (bit.wire == nullptr)
+					continue;
+				if (wire->port_input)
+					port_input[bits.at(bit)] = true;
+				if (wire->port_output)
+					port_output[bits.at(bit)] = true;
+			}
+		}
+	}
+};
+
 YOSYS_NAMESPACE_END
 
 #endif
@@ -19,6 +19,7 @@
 
 #include "kernel/yosys.h"
 #include "kernel/satgen.h"
+#include "kernel/threading.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -91,6 +92,7 @@ YOSYS_NAMESPACE_BEGIN
 bool echo_mode = false;
 Pass *first_queued_pass;
 Pass *current_pass;
+PassProfiler *pass_profiler;
 
 std::map<std::string, Frontend*> frontend_register;
 std::map<std::string, Pass*> pass_register;
@@ -170,6 +172,46 @@ void Pass::post_execute(Pass::pre_post_exec_state_t state)
 		current_pass->runtime_ns -= time_ns;
 }
 
+void Pass::run_on_modules(const std::vector<RTLIL::Module*> &modules, const std::function<void(RTLIL::Module*)> &worker)
+{
+	if (!module_local_flag || AutoidxSequence::active()) {
+		for (auto module : modules)
+			worker(module);
+		return;
+	}
+
+	// Each module gets its own sequence of autoidx values for the names of
+	// new objects, so that the names (and the log messages mentioning them)
+	// are the same with and without worker threads.
+	int n = GetSize(modules);
+	int base = autoidx;
+
+	if (yosys_threads <= 1 || n <= 1) {
+		for (int i = 0; i < n; i++) {
+			AutoidxSequence seq(base + i, n);
+			worker(modules[i]);
+		}
+		return;
+	}
+
+	std::vector<LogCapture> captures(n);
+
+	parallel_for(n, [&](int i) {
+		AutoidxSequence seq(base + i, n);
+		LogCaptureGuard guard(&captures[i]);
+		try {
+			worker(modules[i]);
+		} catch (log_capture_error_exception&) {
+		}
+	});
+
+	// Print the messages in module order, so that the log does not depend on
+	// the scheduling of the worker threads. An error is reported only after
+	// the messages of all modules that precede the failing one.
+	for (auto &capture : captures)
+		capture.replay();
+}
+
 void Pass::help()
 {
 	log("\n");
@@ -311,10 +353,36 @@ void Pass::call(RTLIL::Design *design, std::vector<std::string> args)
 	if (pass_register[args[0]]->experimental_flag)
 		log_experimental("%s", args[0].c_str());
 
+	Pass *pass = pass_register[args[0]];
+
+	// ends the profile of the pass also when it throws, so that the
+	// profiler stack stays balanced for callers that catch the error
+	struct ProfileGuard {
+		PassProfiler *profiler;
+		Pass *pass;
+		RTLIL::Design *design;
+		ProfileGuard(PassProfiler *profiler, Pass *pass, const std::vector<std::string> &args, RTLIL::Design *design) :
+				profiler(profiler), pass(pass), design(design) {
+			if (profiler)
+				profiler->pass_begin(pass, args, design);
+		}
+		~ProfileGuard() {
+			if (profiler)
+				profiler->pass_end(pass, design);
+		}
+	} profile_guard(pass_profiler, pass, args, design);
+
 	size_t orig_sel_stack_pos = design->selection_stack.size();
-	auto state = pass_register[args[0]]->pre_execute();
-	pass_register[args[0]]->execute(args, design);
-	pass_register[args[0]]->post_execute(state);
+	auto state = pass->pre_execute();
+	pass->execute(args, design);
+	pass->post_execute(state);
+
+	// cached SigMaps (SigMap::cached()) are shared by the passes of one
+	// command, but are not kept in the design after it
+	if (current_pass == nullptr)
+		for (auto &it : design->modules_)
+			it.second->release_sigmap();
+
 	while (design->selection_stack.size() > orig_sel_stack_pos)
 		design->selection_stack.pop_back();
 }
@@ -37,11 +37,21 @@ struct Pass
 	int call_counter;
 	int64_t runtime_ns;
 	bool experimental_flag = false;
+	bool module_local_flag = false;
 
 	void experimental() {
 		experimental_flag = true;
 	}
 
+	// Declare that the per-module work passed to run_on_modules() only
+	// modifies the module it is given (and its wires and cells), so that it
+	// may run concurrently for different modules when yosys_threads > 1.
+	void module_local() {
+		module_local_flag = true;
+	}
+
+	void run_on_modules(const std::vector<RTLIL::Module*> &modules, const std::function<void(RTLIL::Module*)> &worker);
+
 	struct pre_post_exec_state_t {
 		Pass *parent_pass;
 		int64_t begin_ns;
@@ -124,6 +134,18 @@ struct Backend : Pass
 	static void backend_call(RTLIL::Design *design, std::ostream *f, std::string filename, std::vector<std::string> args);
 };
 
+// Receives a callback before and after every command executed by
+// Pass::call(), including commands run by other commands. Used by the
+// "profile" command (passes/cmds/profile.cc).
+struct PassProfiler
+{
+	virtual ~PassProfiler() { }
+	virtual void pass_begin(Pass *pass, const std::vector<std::string> &args, RTLIL::Design *design) = 0;
+	virtual void pass_end(Pass *pass, RTLIL::Design *design) = 0;
+};
+
+extern PassProfiler *pass_profiler;
+
 // implemented in passes/cmds/select.cc
 extern void handle_extra_select_args(Pass *pass, const std::vector<std::string> &args, size_t argidx, size_t args_size, RTLIL::Design *design);
 extern RTLIL::Selection eval_select_args(const vector<string> &args, RTLIL::Design *design);
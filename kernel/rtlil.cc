@@ -31,23 +31,243 @@
 YOSYS_NAMESPACE_BEGIN
 
 RTLIL::IdString::destruct_guard_t RTLIL::IdString::destruct_guard;
-std::vector<char*> RTLIL::IdString::global_id_storage_;
-dict<char*, int, hash_cstr_ops> RTLIL::IdString::global_id_index_;
+char **RTLIL::IdString::global_id_chunks_[RTLIL::IdString::max_chunks_];
+std::atomic<int> RTLIL::IdString::global_id_count_(0);
+RTLIL::IdString::index_shard_t RTLIL::IdString::global_id_index_[RTLIL::IdString::index_shards_];
+ys_mutex RTLIL::IdString::global_id_alloc_mutex_;
 #ifndef YOSYS_NO_IDS_REFCNT
-std::vector<int> RTLIL::IdString::global_refcount_storage_;
+std::atomic<int> *RTLIL::IdString::global_refcount_chunks_[RTLIL::IdString::max_chunks_];
 std::vector<int> RTLIL::IdString::global_free_idx_list_;
+std::vector<int> RTLIL::IdString::global_deferred_idx_list_;
 #endif
+std::atomic<int> RTLIL::IdString::concurrent_(0);
 #ifdef YOSYS_USE_STICKY_IDS
 int RTLIL::IdString::last_created_idx_[8];
 int RTLIL::IdString::last_created_idx_ptr_;
 #endif
 
+// Only lock the IdString mutexes while worker threads are active.
+struct IdStringLockGuard {
+	ys_mutex *mutex;
+	IdStringLockGuard(ys_mutex &m, bool enable) : mutex(enable ? &m : nullptr) {
+		if (mutex) mutex->lock();
+	}
+	~IdStringLockGuard() {
+		if (mutex) mutex->unlock();
+	}
+};
+
+// Interned names are carved out of large blocks instead of being allocated one
+// by one. Freed names go to a free list per size class, as auto-generated names
+// are created and destroyed all the time. Longer names use plain malloc().
+static const size_t id_arena_block_size = 1 << 16;
+static const size_t id_arena_granule = 8;
+static const size_t id_arena_num_classes = 32;
+static char *id_arena_free_list[id_arena_num_classes];
+static char *id_arena_next, *id_arena_end;
+
+static char *id_arena_strdup(const char *p)
+{
+	size_t size = strlen(p) + 1;
+	size_t size_class = (size - 1) / id_arena_granule;
+
+	if (size_class >= id_arena_num_classes)
+		return strdup(p);
+
+	char *q = id_arena_free_list[size_class];
+	if (q != nullptr) {
+		memcpy(&id_arena_free_list[size_class], q, sizeof(char*));
+	} else {
+		size_t alloc_size = (size_class + 1) * id_arena_granule;
+		if (size_t(id_arena_end - id_arena_next) < alloc_size) {
+			id_arena_next = (char*)malloc(id_arena_block_size);
+			id_arena_end = id_arena_next + id_arena_block_size;
+		}
+		q = id_arena_next;
+		id_arena_next += alloc_size;
+	}
+
+	memcpy(q, p, size);
+	return q;
+}
+
+static void id_arena_free(char *p)
+{
+	size_t size = strlen(p) + 1;
+	size_t size_class = (size - 1) / id_arena_granule;
+
+	if (size_class >= id_arena_num_classes) {
+		free(p);
+		return;
+	}
+
+	memcpy(p, &id_arena_free_list[size_class], sizeof(char*));
+	id_arena_free_list[size_class] = p;
+}
+
+static int id_alloc_index()
+{
+	#ifndef YOSYS_NO_IDS_REFCNT
+	if (!RTLIL::IdString::global_free_idx_list_.empty()) {
+		int idx = RTLIL::IdString::global_free_idx_list_.back();
+		RTLIL::IdString::global_free_idx_list_.pop_back();
+		return idx;
+	}
+	#endif
+
+	int idx = RTLIL::IdString::global_id_count_;
+	log_assert(idx < 0x40000000);
+
+	if ((idx & (RTLIL::IdString::chunk_size_ - 1)) == 0) {
+		int chunk = idx >> RTLIL::IdString::chunk_bits_;
+		RTLIL::IdString::global_id_chunks_[chunk] = new char*[RTLIL::IdString::chunk_size_]();
+	#ifndef YOSYS_NO_IDS_REFCNT
+		std::atomic<int> *refcounts = new std::atomic<int>[RTLIL::IdString::chunk_size_];
+		for (int i = 0; i < RTLIL::IdString::chunk_size_; i++)
+			refcounts[i].store(0, std::memory_order_relaxed);
+		RTLIL::IdString::global_refcount_chunks_[chunk] = refcounts;
+	#endif
+	}
+
+	RTLIL::IdString::global_id_count_ = idx + 1;
+	return idx;
+}
+
+int RTLIL::IdString::get_reference(const char *p)
+{
+	log_assert(destruct_guard.ok);
+
+	if (!p[0])
+		return 0;
+
+	bool concurrent = concurrent_.load(std::memory_order_relaxed) != 0;
+	index_shard_t &shard = global_id_index_[hash_cstr_ops::hash(p) % index_shards_];
+	IdStringLockGuard shard_lock(shard.mutex, concurrent);
+
+	auto it = shard.index.find((char*)p);
+	if (it != shard.index.end()) {
+	#ifndef YOSYS_NO_IDS_REFCNT
+		if (concurrent)
+			global_refcount(it->second).fetch_add(1, std::memory_order_relaxed);
+		else
+			global_refcount(it->second).store(global_refcount(it->second).load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	#endif
+	#ifdef YOSYS_XTRACE_GET_PUT
+		if (yosys_xtrace)
+			log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id_storage(it->second), it->second, global_refcount(it->second).load());
+	#endif
+		return it->second;
+	}
+
+	log_assert(p[0] == '$' || p[0] == '\\');
+	log_assert(p[1] != 0);
+	for (const char *c = p; *c; c++)
+		if ((unsigned)*c <= (unsigned)' ')
+			log_error("Found control character or space (0x%02x) in string '%s' which is not allowed in RTLIL identifiers\n", *c, p);
+
+	int idx;
+	{
+		IdStringLockGuard alloc_lock(global_id_alloc_mutex_, concurrent);
+
+		if (global_id_count_ == 0) {
+			id_alloc_index();
+			global_id_storage(0) = (char*)"";
+		}
+
+		idx = id_alloc_index();
+		global_id_storage(idx) = id_arena_strdup(p);
+	}
+
+	#ifndef YOSYS_NO_IDS_REFCNT
+	global_refcount(idx).store(1, std::memory_order_relaxed);
+	#endif
+	shard.index[global_id_storage(idx)] = idx;
+
+	if (yosys_xtrace) {
+		log("#X# New IdString '%s' with index %d.\n", p, idx);
+		log_backtrace("-X- ", yosys_xtrace-1);
+	}
+
+	#ifdef YOSYS_XTRACE_GET_PUT
+	if (yosys_xtrace)
+		log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id_storage(idx), idx, global_refcount(idx).load());
+	#endif
+
+	#ifdef YOSYS_USE_STICKY_IDS
+	// Avoid Create->Delete->Create pattern
+	if (last_created_idx_[last_created_idx_ptr_])
+		put_reference(last_created_idx_[last_created_idx_ptr_]);
+	last_created_idx_[last_created_idx_ptr_] = idx;
+	get_reference(last_created_idx_[last_created_idx_ptr_]);
+	last_created_idx_ptr_ = (last_created_idx_ptr_ + 1) & 7;
+	#endif
+
+	return idx;
+}
+
+#ifndef YOSYS_NO_IDS_REFCNT
+void RTLIL::IdString::free_reference(int idx)
+{
+	if (yosys_xtrace) {
+		log("#X# Removed IdString '%s' with index %d.\n", global_id_storage(idx), idx);
+		log_backtrace("-X- ", yosys_xtrace-1);
+	}
+
+	char *p = global_id_storage(idx);
+	global_id_index_[hash_cstr_ops::hash(p) % index_shards_].index.erase(p);
+	id_arena_free(p);
+	global_id_storage(idx) = nullptr;
+	global_free_idx_list_.push_back(idx);
+}
+
+void RTLIL::IdString::defer_free_reference(int idx)
+{
+	ys_lock_guard lock(global_id_alloc_mutex_);
+	global_deferred_idx_list_.push_back(idx);
+}
+#endif
+
+void RTLIL::IdString::release_deferred()
+{
+	#ifndef YOSYS_NO_IDS_REFCNT
+	log_assert(concurrent_ == 0);
+
+	// An index can be listed more than once, and names can be picked up again
+	// after their reference count dropped to zero. Only free what is unused now.
+	for (int idx : global_deferred_idx_list_)
+		if (global_id_storage(idx) != nullptr && global_refcount(idx).load(std::memory_order_relaxed) == 0)
+			free_reference(idx);
+	global_deferred_idx_list_.clear();
+	#endif
+}
+
+void RTLIL::IdString::checkpoint()
+{
+	release_deferred();
+
+	#ifdef YOSYS_USE_STICKY_IDS
+	last_created_idx_ptr_ = 0;
+	for (int i = 0; i < 8; i++) {
+		if (last_created_idx_[i])
+			put_reference(last_created_idx_[i]);
+		last_created_idx_[i] = 0;
+	}
+	#endif
+	#ifdef YOSYS_SORT_ID_FREE_LIST
+	std::sort(global_free_idx_list_.begin(), global_free_idx_list_.end(), std::greater<int>());
+	#endif
+}
+
 #define X(_id) IdString RTLIL::ID::_id;
 #include "kernel/constids.inc"
 #undef X
 
 dict<std::string, std::string> RTLIL::constpad;
 
+// Module-local passes call the design monitors from several worker threads,
+// so their notifications are serialized.
+static ys_mutex design_monitor_mutex;
+
 const pool<IdString> &RTLIL::builtin_ff_cell_types() {
 	static const pool<IdString> res = {
 		ID($sr),
@@ -202,11 +422,12 @@ const pool<IdString> &RTLIL::builtin_ff_cell_types() {
 RTLIL::Const::Const(const std::string &str)
 {
 	flags = RTLIL::CONST_FLAG_STRING;
-	bits.reserve(str.size() * 8);
+	packed_width_ = 0;
+	bits_.reserve(str.size() * 8);
 	for (int i = str.size()-1; i >= 0; i--) {
 		unsigned char ch = str[i];
 		for (int j = 0; j < 8; j++) {
-			bits.push_back((ch & 1) != 0 ? State::S1 : State::S0);
+			bits_.push_back((ch & 1) != 0 ? State::S1 : State::S0);
 			ch = ch >> 1;
 		}
 	}
@@ -215,9 +436,10 @@ RTLIL::Const::Const(const std::string &str)
 RTLIL::Const::Const(int val, int width)
 {
 	flags = RTLIL::CONST_FLAG_NONE;
-	bits.reserve(width);
+	packed_width_ = 0;
+	bits_.reserve(width);
 	for (int i = 0; i < width; i++) {
-		bits.push_back((val & 1) != 0 ? State::S1 : State::S0);
+		bits_.push_back((val & 1) != 0 ? State::S1 : State::S0);
 		val = val >> 1;
 	}
 }
@@ -225,65 +447,251 @@ RTLIL::Const::Const(int val, int width)
 RTLIL::Const::Const(RTLIL::State bit, int width)
 {
 	flags = RTLIL::CONST_FLAG_NONE;
-	bits.reserve(width);
+	packed_width_ = 0;
+	bits_.reserve(width);
 	for (int i = 0; i < width; i++)
-		bits.push_back(bit);
+		bits_.push_back(bit);
 }
 
 RTLIL::Const::Const(const std::vector<bool> &bits)
 {
 	flags = RTLIL::CONST_FLAG_NONE;
-	this->bits.reserve(bits.size());
+	packed_width_ = 0;
+	bits_.reserve(bits.size());
 	for (const auto &b : bits)
-		this->bits.emplace_back(b ? State::S1 : State::S0);
+		bits_.emplace_back(b ? State::S1 : State::S0);
+}
+
+// RTLIL::State is a single byte, so the bits of a Const can be processed
+// eight at a time by loading them into a 64-bit word. Byte k of such a word
+// (counting from the least significant byte) always holds bits[i+k].
+static_assert(sizeof(RTLIL::State) == 1, "RTLIL::State must be a single byte");
+
+static const uint64_t state_bytes_s1 = 0x0101010101010101ULL;
+static const uint64_t state_bytes_low7 = 0x7f7f7f7f7f7f7f7fULL;
+
+static inline uint64_t load_state_bytes(const RTLIL::State *p)
+{
+	uint64_t w;
+	memcpy(&w, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	w = __builtin_bswap64(w);
+#endif
+	return w;
+}
+
+static inline void store_state_bytes(RTLIL::State *p, uint64_t w)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	w = __builtin_bswap64(w);
+#endif
+	memcpy(p, &w, 8);
+}
+
+// 0x01 in every byte that holds State::S1, 0x00 in all other bytes
+static inline uint64_t state_bytes_s1_mask(uint64_t w)
+{
+	uint64_t y = w ^ state_bytes_s1;
+	return ~(((y & state_bytes_low7) + state_bytes_low7) | y | state_bytes_low7) >> 7;
+}
+
+// true if every byte holds State::S0 or State::S1
+static inline bool state_bytes_def(uint64_t w)
+{
+	return (w & ~state_bytes_s1) == 0;
+}
+
+// gather the low bits of the eight bytes into an 8-bit value
+static inline uint64_t pack_state_bytes(uint64_t w)
+{
+	return ((w & state_bytes_s1) * 0x0102040810204080ULL) >> 56;
+}
+
+// inverse of pack_state_bytes(): spread an 8-bit value over eight bytes
+static inline uint64_t unpack_state_bytes(uint64_t v)
+{
+	uint64_t w = (v * state_bytes_s1) & 0x8040201008040201ULL;
+	return ((w + state_bytes_low7) & ~state_bytes_low7) >> 7;
+}
+
+// the states of a packed value
+static void unpack_const_bits(const std::vector<RTLIL::State> &packed, int width, std::vector<RTLIL::State> &bits)
+{
+	bits.resize(width);
+	int i = 0;
+	for (; i + 8 <= width; i += 8)
+		store_state_bytes(bits.data() + i, unpack_state_bytes(packed[i / 8]));
+	for (; i < width; i++)
+		bits[i] = RTLIL::State((packed[i / 8] >> (i % 8)) & 1);
+}
+
+void RTLIL::Const::pack()
+{
+	if (packed_width_ != 0 || bits_.empty() || !is_fully_def())
+		return;
+
+	int width = GetSize(bits_);
+	std::vector<RTLIL::State> packed((width + 7) / 8);
+	int i = 0;
+	for (; i + 8 <= width; i += 8)
+		packed[i / 8] = RTLIL::State(pack_state_bytes(load_state_bytes(bits_.data() + i)));
+	for (; i < width; i++)
+		packed[i / 8] = RTLIL::State(packed[i / 8] | (bits_[i] << (i % 8)));
+
+	bits_.swap(packed);
+	packed_width_ = width;
+}
+
+void RTLIL::Const::unpack()
+{
+	std::vector<RTLIL::State> bits;
+	unpack_const_bits(bits_, packed_width_, bits);
+	bits_.swap(bits);
+	packed_width_ = 0;
+}
+
+std::vector<RTLIL::State> RTLIL::Const::to_bits() const
+{
+	if (packed_width_ == 0)
+		return bits_;
+	std::vector<RTLIL::State> bits;
+	unpack_const_bits(bits_, packed_width_, bits);
+	return bits;
+}
+
+// the same as hash() on the unpacked value
+unsigned int RTLIL::Const::hash_packed() const
+{
+	unsigned int h = mkhash_init;
+	int i = 0, n = packed_width_;
+	for (; i + 8 <= n; i += 8) {
+		uint64_t w = unpack_state_bytes(bits_[i / 8]);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		w = __builtin_bswap64(w);
+#endif
+		h = mkhash(mkhash(h, (unsigned int)w), (unsigned int)(w >> 32));
+	}
+	for (; i < n; i++)
+		h = mkhash(h, (*this)[i]);
+	return h;
 }
 
 bool RTLIL::Const::operator <(const RTLIL::Const &other) const
 {
-	if (bits.size() != other.bits.size())
-		return bits.size() < other.bits.size();
-	for (size_t i = 0; i < bits.size(); i++)
-		if (bits[i] != other.bits[i])
-			return bits[i] < other.bits[i];
+	int n = size();
+	if (n != other.size())
+		return n < other.size();
+	if (packed_width_ == 0 && other.packed_width_ == 0)
+		return n != 0 && memcmp(bits_.data(), other.bits_.data(), n) < 0;
+	for (int i = 0; i < n; i++)
+		if ((*this)[i] != other[i])
+			return (*this)[i] < other[i];
 	return false;
 }
 
 bool RTLIL::Const::operator ==(const RTLIL::Const &other) const
 {
-	return bits == other.bits;
+	int n = size();
+	if (n != other.size())
+		return false;
+	// the unused bits of the last byte of a packed value are always zero
+	if ((packed_width_ == 0) == (other.packed_width_ == 0))
+		return bits_.empty() || memcmp(bits_.data(), other.bits_.data(), bits_.size()) == 0;
+	for (int i = 0; i < n; i++)
+		if ((*this)[i] != other[i])
+			return false;
+	return true;
 }
 
 bool RTLIL::Const::operator !=(const RTLIL::Const &other) const
 {
-	return bits != other.bits;
+	return !(*this == other);
 }
 
 bool RTLIL::Const::as_bool() const
 {
-	for (size_t i = 0; i < bits.size(); i++)
-		if (bits[i] == State::S1)
+	if (packed_width_ != 0) {
+		for (auto byte : bits_)
+			if (byte != 0)
+				return true;
+		return false;
+	}
+	size_t i = 0;
+	for (; i + 8 <= bits_.size(); i += 8)
+		if (state_bytes_s1_mask(load_state_bytes(bits_.data() + i)))
+			return true;
+	for (; i < bits_.size(); i++)
+		if (bits_[i] == State::S1)
 			return true;
 	return false;
 }
 
 int RTLIL::Const::as_int(bool is_signed) const
 {
-	int32_t ret = 0;
-	for (size_t i = 0; i < bits.size() && i < 32; i++)
-		if (bits[i] == State::S1)
-			ret |= 1 << i;
-	if (is_signed && bits.back() == State::S1)
-		for (size_t i = bits.size(); i < 32; i++)
-			ret |= 1 << i;
-	return ret;
+	uint32_t ret = 0;
+	int n = size();
+	if (packed_width_ != 0) {
+		for (int i = 0; i < std::min(n, 32); i += 8)
+			ret |= uint32_t(bits_[i / 8]) << i;
+	} else {
+		size_t i = 0, m = std::min(bits_.size(), size_t(32));
+		for (; i + 8 <= m; i += 8)
+			ret |= uint32_t(pack_state_bytes(state_bytes_s1_mask(load_state_bytes(bits_.data() + i)))) << i;
+		for (; i < m; i++)
+			if (bits_[i] == State::S1)
+				ret |= uint32_t(1) << i;
+	}
+	if (is_signed && n != 0 && n < 32 && (*this)[n - 1] == State::S1)
+		ret |= ~uint32_t(0) << n;
+	return int32_t(ret);
+}
+
+bool RTLIL::Const::as_words(std::vector<uint64_t> &words) const
+{
+	if (packed_width_ != 0) {
+		words.assign((packed_width_ + 63) / 64, 0);
+		for (int i = 0; i < GetSize(bits_); i++)
+			words[i / 8] |= uint64_t(bits_[i]) << (8 * (i % 8));
+		return true;
+	}
+
+	size_t i = 0, n = bits_.size();
+	words.assign((n + 63) / 64, 0);
+	for (; i + 8 <= n; i += 8) {
+		uint64_t w = load_state_bytes(bits_.data() + i);
+		if (!state_bytes_def(w))
+			return false;
+		words[i / 64] |= pack_state_bytes(w) << (i % 64);
+	}
+	for (; i < n; i++) {
+		if (bits_[i] == State::S1)
+			words[i / 64] |= uint64_t(1) << (i % 64);
+		else if (bits_[i] != State::S0)
+			return false;
+	}
+	return true;
+}
+
+RTLIL::Const RTLIL::Const::from_words(const std::vector<uint64_t> &words, int width)
+{
+	log_assert(GetSize(words) * 64 >= width);
+
+	RTLIL::Const c;
+	c.bits_.resize(width);
+	int i = 0;
+	for (; i + 8 <= width; i += 8)
+		store_state_bytes(c.bits_.data() + i, unpack_state_bytes((words[i / 64] >> (i % 64)) & 0xff));
+	for (; i < width; i++)
+		c.bits_[i] = (words[i / 64] >> (i % 64)) & 1 ? State::S1 : State::S0;
+	return c;
 }
 
 std::string RTLIL::Const::as_string() const
 {
 	std::string ret;
-	ret.reserve(bits.size());
-	for (size_t i = bits.size(); i > 0; i--)
-		switch (bits[i-1]) {
+	ret.reserve(size());
+	for (int i = size(); i > 0; i--)
+		switch ((*this)[i-1]) {
 			case S0: ret += "0"; break;
 			case S1: ret += "1"; break;
 			case Sx: ret += "x"; break;
@@ -297,27 +705,28 @@ std::string RTLIL::Const::as_string() const
 RTLIL::Const RTLIL::Const::from_string(const std::string &str)
 {
 	Const c;
-	c.bits.reserve(str.size());
+	c.bits_.reserve(str.size());
 	for (auto it = str.rbegin(); it != str.rend(); it++)
 		switch (*it) {
-			case '0': c.bits.push_back(State::S0); break;
-			case '1': c.bits.push_back(State::S1); break;
-			case 'x': c.bits.push_back(State::Sx); break;
-			case 'z': c.bits.push_back(State::Sz); break;
-			case 'm': c.bits.push_back(State::Sm); break;
-			default: c.bits.push_back(State::Sa);
+			case '0': c.bits_.push_back(State::S0); break;
+			case '1': c.bits_.push_back(State::S1); break;
+			case 'x': c.bits_.push_back(State::Sx); break;
+			case 'z': c.bits_.push_back(State::Sz); break;
+			case 'm': c.bits_.push_back(State::Sm); break;
+			default: c.bits_.push_back(State::Sa);
 		}
 	return c;
 }
 
 std::string RTLIL::Const::decode_string() const
 {
+	int n = size();
 	std::string string;
-	string.reserve(GetSize(bits)/8);
-	for (int i = 0; i < GetSize(bits); i += 8) {
+	string.reserve(n/8);
+	for (int i = 0; i < n; i += 8) {
 		char ch = 0;
-		for (int j = 0; j < 8 && i + j < int (bits.size()); j++)
-			if (bits[i + j] == RTLIL::State::S1)
+		for (int j = 0; j < 8 && i + j < n; j++)
+			if ((*this)[i + j] == RTLIL::State::S1)
 				ch |= 1 << j;
 		if (ch != 0)
 			string.append({ch});
@@ -330,8 +739,15 @@ bool RTLIL::Const::is_fully_zero() const
 {
 	cover("kernel.rtlil.const.is_fully_zero");
 
-	for (const auto &bit : bits)
-		if (bit != RTLIL::State::S0)
+	if (packed_width_ != 0)
+		return !as_bool();
+
+	size_t i = 0;
+	for (; i + 8 <= bits_.size(); i += 8)
+		if (load_state_bytes(bits_.data() + i) != 0)
+			return false;
+	for (; i < bits_.size(); i++)
+		if (bits_[i] != RTLIL::State::S0)
 			return false;
 
 	return true;
@@ -341,8 +757,19 @@ bool RTLIL::Const::is_fully_ones() const
 {
 	cover("kernel.rtlil.const.is_fully_ones");
 
-	for (const auto &bit : bits)
-		if (bit != RTLIL::State::S1)
+	if (packed_width_ != 0) {
+		for (int i = 0; i < packed_width_; i += 8)
+			if (bits_[i / 8] != RTLIL::State(0xff >> std::max(0, i + 8 - packed_width_)))
+				return false;
+		return true;
+	}
+
+	size_t i = 0;
+	for (; i + 8 <= bits_.size(); i += 8)
+		if (load_state_bytes(bits_.data() + i) != state_bytes_s1)
+			return false;
+	for (; i < bits_.size(); i++)
+		if (bits_[i] != RTLIL::State::S1)
 			return false;
 
 	return true;
@@ -352,8 +779,15 @@ bool RTLIL::Const::is_fully_def() const
 {
 	cover("kernel.rtlil.const.is_fully_def");
 
-	for (const auto &bit : bits)
-		if (bit != RTLIL::State::S0 && bit != RTLIL::State::S1)
+	if (packed_width_ != 0)
+		return true;
+
+	size_t i = 0;
+	for (; i + 8 <= bits_.size(); i += 8)
+		if (!state_bytes_def(load_state_bytes(bits_.data() + i)))
+			return false;
+	for (; i < bits_.size(); i++)
+		if (bits_[i] != RTLIL::State::S0 && bits_[i] != RTLIL::State::S1)
 			return false;
 
 	return true;
@@ -363,7 +797,10 @@ bool RTLIL::Const::is_fully_undef() const
 {
 	cover("kernel.rtlil.const.is_fully_undef");
 
-	for (const auto &bit : bits)
+	if (packed_width_ != 0)
+		return false;
+
+	for (const auto &bit : bits_)
 		if (bit != RTLIL::State::Sx && bit != RTLIL::State::Sz)
 			return false;
 
@@ -375,8 +812,8 @@ bool RTLIL::Const::is_onehot(int *pos) const
 	cover("kernel.rtlil.const.is_onehot");
 
 	bool found = false;
-	for (int i = 0; i < GetSize(*this); i++) {
-		auto &bit = bits[i];
+	for (int i = 0; i < size(); i++) {
+		RTLIL::State bit = (*this)[i];
 		if (bit != RTLIL::State::S0 && bit != RTLIL::State::S1)
 			return false;
 		if (bit == RTLIL::State::S1) {
@@ -390,6 +827,22 @@ bool RTLIL::Const::is_onehot(int *pos) const
 	return found;
 }
 
+RTLIL::Const RTLIL::Const::extract(int offset, int len, RTLIL::State padding) const
+{
+	RTLIL::Const ret;
+	ret.bits_.reserve(len);
+	int end = std::min(offset + len, size());
+	if (packed_width_ == 0) {
+		if (offset < end)
+			ret.bits_.insert(ret.bits_.end(), bits_.begin() + offset, bits_.begin() + end);
+	} else {
+		for (int i = offset; i < end; i++)
+			ret.bits_.push_back((*this)[i]);
+	}
+	ret.bits_.resize(len, padding);
+	return ret;
+}
+
 bool RTLIL::AttrObject::has_attribute(const RTLIL::IdString &id) const
 {
 	return attributes.count(id);
@@ -608,7 +1061,7 @@ RTLIL::Design::Design()
 RTLIL::Design::~Design()
 {
 	for (auto &pr : modules_)
-		delete pr.second;
+		release(pr.second);
 	for (auto n : bindings_)
 		delete n;
 	for (auto n : verilog_packages)
@@ -630,12 +1083,16 @@ std::map<unsigned int, RTLIL::Design*> *RTLIL::Design::get_all_designs(void)
 
 RTLIL::ObjRange<RTLIL::Module*> RTLIL::Design::modules()
 {
+	for (auto &pr : modules_)
+		if (pr.second->shared_)
+			unshare(pr.second);
 	return RTLIL::ObjRange<RTLIL::Module*>(&modules_, &refcount_modules_);
 }
 
 RTLIL::Module *RTLIL::Design::module(const RTLIL::IdString& name)
 {
-	return modules_.count(name) ? modules_.at(name) : NULL;
+	auto it = modules_.find(name);
+	return it != modules_.end() ? unshare(it->second) : NULL;
 }
 
 const RTLIL::Module *RTLIL::Design::module(const RTLIL::IdString& name) const
@@ -674,6 +1131,106 @@ void RTLIL::Design::add(RTLIL::Module *module)
 	}
 }
 
+// Modules are unshared from worker threads when module-local passes modify
+// them. Copying a module is rare, so a single lock is good enough.
+static ys_mutex unshare_mutex;
+
+void RTLIL::Design::add_shared(RTLIL::Module *module, bool take_ownership)
+{
+	log_assert(modules_.count(module->name) == 0);
+	log_assert(refcount_modules_ == 0);
+	log_assert(module->design != nullptr && module->design != this);
+	modules_[module->name] = module;
+	{
+		ys_lock_guard lock(unshare_mutex);
+		if (take_ownership) {
+			module->shared_designs_.push_back(module->design);
+			module->design = this;
+		} else
+			module->shared_designs_.push_back(this);
+		module->shared_ = true;
+	}
+
+	for (auto mon : monitors)
+		mon->notify_module_add(module);
+}
+
+RTLIL::Module *RTLIL::Design::unshare(RTLIL::Module *module)
+{
+	if (!module->shared_)
+		return module;
+
+	ys_lock_guard lock(unshare_mutex);
+
+	// another thread may have unshared the module since the check above
+	RTLIL::Module *current = modules_.at(module->name);
+	if (current != module || module->shared_designs_.empty())
+		return current;
+
+	log_debug("Copying module %s, which is shared with another design.\n", log_id(module));
+	RTLIL::Module *copy = module->clone();
+
+	if (module->design == this) {
+		// keep the object, so that Module pointers held by the owner stay
+		// valid, and hand the copy to the other designs
+		std::vector<RTLIL::Design*> others;
+		others.swap(module->shared_designs_);
+		module->shared_ = false;
+		copy->design = others.front();
+		copy->shared_designs_.assign(others.begin() + 1, others.end());
+		copy->shared_ = !copy->shared_designs_.empty();
+		for (auto other : others) {
+			other->modules_.at(copy->name) = copy;
+			for (auto mon : other->monitors) {
+				mon->notify_module_del(module);
+				mon->notify_module_add(copy);
+			}
+		}
+		return module;
+	}
+
+	copy->design = this;
+	release_shared(module);
+	modules_.at(copy->name) = copy;
+
+	for (auto mon : monitors) {
+		mon->notify_module_del(module);
+		mon->notify_module_add(copy);
+	}
+
+	return copy;
+}
+
+// Drop this design's reference to a module and delete the module unless
+// other designs still share it.
+void RTLIL::Design::release(RTLIL::Module *module)
+{
+	{
+		ys_lock_guard lock(unshare_mutex);
+		if (!module->shared_designs_.empty()) {
+			release_shared(module);
+			return;
+		}
+	}
+	delete module;
+}
+
+// Like release() for a module that is still shared. Expects the unshare lock
+// to be held.
+
+void RTLIL::Design::release_shared(RTLIL::Module *module)
+{
+	if (module->design == this) {
+		module->design = module->shared_designs_.back();
+		module->shared_designs_.pop_back();
+	} else {
+		auto it = std::find(module->shared_designs_.begin(), module->shared_designs_.end(), this);
+		log_assert(it != module->shared_designs_.end());
+		module->shared_designs_.erase(it);
+	}
+	module->shared_ = !module->shared_designs_.empty();
+}
+
 void RTLIL::Design::add(RTLIL::Binding *binding)
 {
 	log_assert(binding != nullptr);
@@ -780,11 +1337,13 @@ void RTLIL::Design::remove(RTLIL::Module *module)
 	log_assert(modules_.at(module->name) == module);
 	log_assert(refcount_modules_ == 0);
 	modules_.erase(module->name);
-	delete module;
+	release(module);
 }
 
 void RTLIL::Design::rename(RTLIL::Module *module, RTLIL::IdString new_name)
 {
+	log_assert(module->design == this);
+	module->unshare();
 	modules_.erase(module->name);
 	module->name = new_name;
 	add(module);
@@ -794,6 +1353,8 @@ void RTLIL::Design::sort()
 {
 	scratchpad.sort();
 	modules_.sort(sort_by_id_str());
+	// sorting does not change the contents of a module, so shared modules
+	// are sorted in place as well
 	for (auto &it : modules_)
 		it.second->sort();
 }
@@ -802,7 +1363,7 @@ void RTLIL::Design::check()
 {
 #ifndef NDEBUG
 	for (auto &it : modules_) {
-		log_assert(this == it.second->design);
+		log_assert(this == it.second->design || std::count(it.second->shared_designs_.begin(), it.second->shared_designs_.end(), this) == 1);
 		log_assert(it.first == it.second->name);
 		log_assert(!it.first.empty());
 		it.second->check();
@@ -863,7 +1424,7 @@ std::vector<RTLIL::Module*> RTLIL::Design::selected_modules() const
 	result.reserve(modules_.size());
 	for (auto &it : modules_)
 		if (selected_module(it.first) && !it.second->get_blackbox_attribute())
-			result.push_back(it.second);
+			result.push_back(const_cast<RTLIL::Design*>(this)->unshare(it.second));
 	return result;
 }
 
@@ -873,11 +1434,38 @@ std::vector<RTLIL::Module*> RTLIL::Design::selected_whole_modules() const
 	result.reserve(modules_.size());
 	for (auto &it : modules_)
 		if (selected_whole_module(it.first) && !it.second->get_blackbox_attribute())
-			result.push_back(it.second);
+			result.push_back(const_cast<RTLIL::Design*>(this)->unshare(it.second));
 	return result;
 }
 
 std::vector<RTLIL::Module*> RTLIL::Design::selected_whole_modules_warn(bool include_wb) const
+{
+	std::vector<RTLIL::Module*> result = selected_whole_modules_warn_readonly(include_wb);
+	for (auto &module : result)
+		module = const_cast<RTLIL::Design*>(this)->unshare(module);
+	return result;
+}
+
+std::vector<RTLIL::Module*> RTLIL::Design::modules_readonly() const
+{
+	std::vector<RTLIL::Module*> result;
+	result.reserve(modules_.size());
+	for (auto &it : modules_)
+		result.push_back(it.second);
+	return result;
+}
+
+std::vector<RTLIL::Module*> RTLIL::Design::selected_modules_readonly() const
+{
+	std::vector<RTLIL::Module*> result;
+	result.reserve(modules_.size());
+	for (auto &it : modules_)
+		if (selected_module(it.first) && !it.second->get_blackbox_attribute())
+			result.push_back(it.second);
+	return result;
+}
+
+std::vector<RTLIL::Module*> RTLIL::Design::selected_whole_modules_warn_readonly(bool include_wb) const
 {
 	std::vector<RTLIL::Module*> result;
 	result.reserve(modules_.size());
@@ -898,6 +1486,8 @@ RTLIL::Module::Module()
 	hashidx_ = hashidx_count;
 
 	design = nullptr;
+	shared_ = false;
+	sigmap_monitor_ = nullptr;
 	refcount_wires_ = 0;
 	refcount_cells_ = 0;
 
@@ -908,12 +1498,14 @@ RTLIL::Module::Module()
 
 RTLIL::Module::~Module()
 {
+	delete sigmap_monitor_;
+	// the memory is released with wire_arena_ and cell_arena_
 	for (auto &pr : wires_)
-		delete pr.second;
+		pr.second->~Wire();
 	for (auto &pr : memories)
 		delete pr.second;
 	for (auto &pr : cells_)
-		delete pr.second;
+		pr.second->~Cell();
 	for (auto &pr : processes)
 		delete pr.second;
 	for (auto binding : bindings_)
@@ -933,6 +1525,7 @@ std::map<unsigned int, RTLIL::Module*> *RTLIL::Module::get_all_modules(void)
 
 void RTLIL::Module::makeblackbox()
 {
+	unshare();
 	pool<RTLIL::Wire*> delwires;
 
 	for (auto it = wires_.begin(); it != wires_.end(); ++it)
@@ -943,8 +1536,10 @@ void RTLIL::Module::makeblackbox()
 		delete it->second;
 	memories.clear();
 
-	for (auto it = cells_.begin(); it != cells_.end(); ++it)
-		delete it->second;
+	for (auto it = cells_.begin(); it != cells_.end(); ++it) {
+		it->second->~Cell();
+		cell_arena_.deallocate(it->second);
+	}
 	cells_.clear();
 
 	for (auto it = processes.begin(); it != processes.end(); ++it)
@@ -1037,7 +1632,7 @@ namespace {
 		void param_bits(const RTLIL::IdString& name, int width)
 		{
 			param(name);
-			if (GetSize(cell->parameters.at(name).bits) != width)
+			if (GetSize(cell->parameters.at(name).bits()) != width)
 				error(__LINE__);
 		}
 
@@ -2018,6 +2613,7 @@ std::vector<RTLIL::Cell*> RTLIL::Module::selected_cells() const
 
 void RTLIL::Module::add(RTLIL::Wire *wire)
 {
+	unshare();
 	log_assert(!wire->name.empty());
 	log_assert(count_id(wire->name) == 0);
 	log_assert(refcount_wires_ == 0);
@@ -2027,6 +2623,7 @@ void RTLIL::Module::add(RTLIL::Wire *wire)
 
 void RTLIL::Module::add(RTLIL::Cell *cell)
 {
+	unshare();
 	log_assert(!cell->name.empty());
 	log_assert(count_id(cell->name) == 0);
 	log_assert(refcount_cells_ == 0);
@@ -2036,6 +2633,7 @@ void RTLIL::Module::add(RTLIL::Cell *cell)
 
 void RTLIL::Module::add(RTLIL::Process *process)
 {
+	unshare();
 	log_assert(!process->name.empty());
 	log_assert(count_id(process->name) == 0);
 	processes[process->name] = process;
@@ -2050,6 +2648,7 @@ void RTLIL::Module::add(RTLIL::Binding *binding)
 
 void RTLIL::Module::remove(const pool<RTLIL::Wire*> &wires)
 {
+	unshare();
 	log_assert(refcount_wires_ == 0);
 
 	struct DeleteWireWorker
@@ -2061,7 +2660,7 @@ void RTLIL::Module::remove(const pool<RTLIL::Wire*> &wires)
 			sig.pack();
 			for (auto &c : sig.chunks_)
 				if (c.wire != NULL && wires_p->count(c.wire)) {
-					c.wire = module->addWire(stringf("$delete_wire$%d", autoidx++), c.width);
+					c.wire = module->addWire(stringf("$delete_wire$%d", next_autoidx()), c.width);
 					c.offset = 0;
 				}
 		}
@@ -2089,23 +2688,27 @@ void RTLIL::Module::remove(const pool<RTLIL::Wire*> &wires)
 	for (auto &it : wires) {
 		log_assert(wires_.count(it->name) != 0);
 		wires_.erase(it->name);
-		delete it;
+		it->~Wire();
+		wire_arena_.deallocate(it);
 	}
 }
 
 void RTLIL::Module::remove(RTLIL::Cell *cell)
 {
+	unshare();
 	while (!cell->connections_.empty())
 		cell->unsetPort(cell->connections_.begin()->first);
 
 	log_assert(cells_.count(cell->name) != 0);
 	log_assert(refcount_cells_ == 0);
 	cells_.erase(cell->name);
-	delete cell;
+	cell->~Cell();
+	cell_arena_.deallocate(cell);
 }
 
 void RTLIL::Module::remove(RTLIL::Process *process)
 {
+	unshare();
 	log_assert(processes.count(process->name) != 0);
 	processes.erase(process->name);
 	delete process;
@@ -2113,15 +2716,18 @@ void RTLIL::Module::remove(RTLIL::Process *process)
 
 void RTLIL::Module::rename(RTLIL::Wire *wire, RTLIL::IdString new_name)
 {
+	unshare();
 	log_assert(wires_[wire->name] == wire);
 	log_assert(refcount_wires_ == 0);
 	wires_.erase(wire->name);
 	wire->name = new_name;
 	add(wire);
+	invalidate_sigmap();
 }
 
 void RTLIL::Module::rename(RTLIL::Cell *cell, RTLIL::IdString new_name)
 {
+	unshare();
 	log_assert(cells_[cell->name] == cell);
 	log_assert(refcount_wires_ == 0);
 	cells_.erase(cell->name);
@@ -2142,6 +2748,7 @@ void RTLIL::Module::rename(RTLIL::IdString old_name, RTLIL::IdString new_name)
 
 void RTLIL::Module::swap_names(RTLIL::Wire *w1, RTLIL::Wire *w2)
 {
+	unshare();
 	log_assert(wires_[w1->name] == w1);
 	log_assert(wires_[w2->name] == w2);
 	log_assert(refcount_wires_ == 0);
@@ -2150,6 +2757,7 @@ void RTLIL::Module::swap_names(RTLIL::Wire *w1, RTLIL::Wire *w2)
 	wires_.erase(w2->name);
 
 	std::swap(w1->name, w2->name);
+	invalidate_sigmap();
 
 	wires_[w1->name] = w1;
 	wires_[w2->name] = w2;
@@ -2157,6 +2765,7 @@ void RTLIL::Module::swap_names(RTLIL::Wire *w1, RTLIL::Wire *w2)
 
 void RTLIL::Module::swap_names(RTLIL::Cell *c1, RTLIL::Cell *c2)
 {
+	unshare();
 	log_assert(cells_[c1->name] == c1);
 	log_assert(cells_[c2->name] == c2);
 	log_assert(refcount_cells_ == 0);
@@ -2206,12 +2815,15 @@ static bool fixup_ports_compare(const RTLIL::Wire *a, const RTLIL::Wire *b)
 
 void RTLIL::Module::connect(const RTLIL::SigSig &conn)
 {
+	unshare();
 	for (auto mon : monitors)
 		mon->notify_connect(this, conn);
 
-	if (design)
+	if (design && !design->monitors.empty()) {
+		ys_lock_guard lock(design_monitor_mutex);
 		for (auto mon : design->monitors)
 			mon->notify_connect(this, conn);
+	}
 
 	// ignore all attempts to assign constants to other constants
 	if (conn.first.has_const()) {
@@ -2242,12 +2854,15 @@ void RTLIL::Module::connect(const RTLIL::SigSpec &lhs, const RTLIL::SigSpec &rhs
 
 void RTLIL::Module::new_connections(const std::vector<RTLIL::SigSig> &new_conn)
 {
+	unshare();
 	for (auto mon : monitors)
 		mon->notify_connect(this, new_conn);
 
-	if (design)
+	if (design && !design->monitors.empty()) {
+		ys_lock_guard lock(design_monitor_mutex);
 		for (auto mon : design->monitors)
 			mon->notify_connect(this, new_conn);
+	}
 
 	if (yosys_xtrace) {
 		log("#X# New connections vector in %s:\n", log_id(this));
@@ -2264,8 +2879,23 @@ const std::vector<RTLIL::SigSig> &RTLIL::Module::connections() const
 	return connections_;
 }
 
+void RTLIL::Module::invalidate_sigmap()
+{
+	// SigBit hashes depend on wire names, so a rename is just as bad as
+	// a changed connection for the cached map
+	if (sigmap_monitor_ != nullptr)
+		sigmap_monitor_->notify_blackout(this);
+}
+
+void RTLIL::Module::release_sigmap()
+{
+	delete sigmap_monitor_;
+	sigmap_monitor_ = nullptr;
+}
+
 void RTLIL::Module::fixup_ports()
 {
+	unshare();
 	std::vector<RTLIL::Wire*> all_ports;
 
 	for (auto &w : wires_)
@@ -2285,7 +2915,7 @@ void RTLIL::Module::fixup_ports()
 
 RTLIL::Wire *RTLIL::Module::addWire(RTLIL::IdString name, int width)
 {
-	RTLIL::Wire *wire = new RTLIL::Wire;
+	RTLIL::Wire *wire = new (wire_arena_.allocate()) RTLIL::Wire;
 	wire->name = name;
 	wire->width = width;
 	add(wire);
@@ -2308,7 +2938,7 @@ RTLIL::Wire *RTLIL::Module::addWire(RTLIL::IdString name, const RTLIL::Wire *oth
 
 RTLIL::Cell *RTLIL::Module::addCell(RTLIL::IdString name, RTLIL::IdString type)
 {
-	RTLIL::Cell *cell = new RTLIL::Cell;
+	RTLIL::Cell *cell = new (cell_arena_.allocate()) RTLIL::Cell;
 	cell->name = name;
 	cell->type = type;
 	add(cell);
@@ -2326,6 +2956,7 @@ RTLIL::Cell *RTLIL::Module::addCell(RTLIL::IdString name, const RTLIL::Cell *oth
 
 RTLIL::Memory *RTLIL::Module::addMemory(RTLIL::IdString name, const RTLIL::Memory *other)
 {
+	unshare();
 	RTLIL::Memory *mem = new RTLIL::Memory;
 	mem->name = name;
 	mem->width = other->width;
@@ -3186,11 +3817,21 @@ RTLIL::SigSpec RTLIL::Module::Initstate(RTLIL::IdString name, const std::string
 	return sig;
 }
 
+// Wires, cells, memories and processes may be created concurrently by
+// module-local passes running on worker threads (see Pass::module_local()).
+static unsigned int next_hashidx(std::atomic<unsigned int> &hashidx_count)
+{
+	unsigned int old_hashidx = hashidx_count.load(std::memory_order_relaxed), new_hashidx;
+	do {
+		new_hashidx = mkhash_xorshift(old_hashidx);
+	} while (!hashidx_count.compare_exchange_weak(old_hashidx, new_hashidx, std::memory_order_relaxed));
+	return new_hashidx;
+}
+
 RTLIL::Wire::Wire()
 {
-	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	static std::atomic<unsigned int> hashidx_count(123456789);
+	hashidx_ = next_hashidx(hashidx_count);
 
 	module = nullptr;
 	width = 1;
@@ -3223,9 +3864,8 @@ std::map<unsigned int, RTLIL::Wire*> *RTLIL::Wire::get_all_wires(void)
 
 RTLIL::Memory::Memory()
 {
-	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	static std::atomic<unsigned int> hashidx_count(123456789);
+	hashidx_ = next_hashidx(hashidx_count);
 
 	width = 1;
 	start_offset = 0;
@@ -3237,16 +3877,14 @@ RTLIL::Memory::Memory()
 
 RTLIL::Process::Process() : module(nullptr)
 {
-	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	static std::atomic<unsigned int> hashidx_count(123456789);
+	hashidx_ = next_hashidx(hashidx_count);
 }
 
 RTLIL::Cell::Cell() : module(nullptr)
 {
-	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	static std::atomic<unsigned int> hashidx_count(123456789);
+	hashidx_ = next_hashidx(hashidx_count);
 
 	// log("#memtrace# %p\n", this);
 	memhasher();
@@ -3278,6 +3916,8 @@ bool RTLIL::Cell::hasPort(const RTLIL::IdString& portname) const
 
 void RTLIL::Cell::unsetPort(const RTLIL::IdString& portname)
 {
+	if (module)
+		module->unshare();
 	RTLIL::SigSpec signal;
 	auto conn_it = connections_.find(portname);
 
@@ -3286,9 +3926,11 @@ void RTLIL::Cell::unsetPort(const RTLIL::IdString& portname)
 		for (auto mon : module->monitors)
 			mon->notify_connect(this, conn_it->first, conn_it->second, signal);
 
-		if (module->design)
+		if (module->design && !module->design->monitors.empty()) {
+			ys_lock_guard lock(design_monitor_mutex);
 			for (auto mon : module->design->monitors)
 				mon->notify_connect(this, conn_it->first, conn_it->second, signal);
+		}
 
 		if (yosys_xtrace) {
 			log("#X# Unconnect %s.%s.%s\n", log_id(this->module), log_id(this), log_id(portname));
@@ -3301,6 +3943,8 @@ void RTLIL::Cell::unsetPort(const RTLIL::IdString& portname)
 
 void RTLIL::Cell::setPort(const RTLIL::IdString& portname, RTLIL::SigSpec signal)
 {
+	if (module)
+		module->unshare();
 	auto r = connections_.insert(portname);
 	auto conn_it = r.first;
 	if (!r.second && conn_it->second == signal)
@@ -3309,9 +3953,11 @@ void RTLIL::Cell::setPort(const RTLIL::IdString& portname, RTLIL::SigSpec signal
 	for (auto mon : module->monitors)
 		mon->notify_connect(this, conn_it->first, conn_it->second, signal);
 
-	if (module->design)
+	if (module->design && !module->design->monitors.empty()) {
+		ys_lock_guard lock(design_monitor_mutex);
 		for (auto mon : module->design->monitors)
 			mon->notify_connect(this, conn_it->first, conn_it->second, signal);
+	}
 
 	if (yosys_xtrace) {
 		log("#X# Connect %s.%s.%s = %s (%d)\n", log_id(this->module), log_id(this), log_id(portname), log_signal(signal), GetSize(signal));
@@ -3335,18 +3981,18 @@ bool RTLIL::Cell::known() const
 {
 	if (yosys_celltypes.cell_known(type))
 		return true;
-	if (module && module->design && module->design->module(type))
-		return true;
-	return false;
+	const RTLIL::Design *design = module ? module->design : nullptr;
+	return design && design->module(type);
 }
 
 bool RTLIL::Cell::input(const RTLIL::IdString& portname) const
 {
 	if (yosys_celltypes.cell_known(type))
 		return yosys_celltypes.cell_input(type, portname);
-	if (module && module->design) {
-		RTLIL::Module *m = module->design->module(type);
-		RTLIL::Wire *w = m ? m->wire(portname) : nullptr;
+	const RTLIL::Design *design = module ? module->design : nullptr;
+	if (design) {
+		const RTLIL::Module *m = design->module(type);
+		const RTLIL::Wire *w = m ? m->wire(portname) : nullptr;
 		return w && w->port_input;
 	}
 	return false;
@@ -3356,9 +4002,10 @@ bool RTLIL::Cell::output(const RTLIL::IdString& portname) const
 {
 	if (yosys_celltypes.cell_known(type))
 		return yosys_celltypes.cell_output(type, portname);
-	if (module && module->design) {
-		RTLIL::Module *m = module->design->module(type);
-		RTLIL::Wire *w = m ? m->wire(portname) : nullptr;
+	const RTLIL::Design *design = module ? module->design : nullptr;
+	if (design) {
+		const RTLIL::Module *m = design->module(type);
+		const RTLIL::Wire *w = m ? m->wire(portname) : nullptr;
 		return w && w->port_output;
 	}
 	return false;
@@ -3371,11 +4018,15 @@ bool RTLIL::Cell::hasParam(const RTLIL::IdString& paramname) const
 
 void RTLIL::Cell::unsetParam(const RTLIL::IdString& paramname)
 {
+	if (module)
+		module->unshare();
 	parameters.erase(paramname);
 }
 
 void RTLIL::Cell::setParam(const RTLIL::IdString& paramname, RTLIL::Const value)
 {
+	if (module)
+		module->unshare();
 	parameters[paramname] = std::move(value);
 }
 
@@ -3384,8 +4035,9 @@ const RTLIL::Const &RTLIL::Cell::getParam(const RTLIL::IdString& paramname) cons
 	const auto &it = parameters.find(paramname);
 	if (it != parameters.end())
 		return it->second;
-	if (module && module->design) {
-		RTLIL::Module *m = module->design->module(type);
+	const RTLIL::Design *design = module ? module->design : nullptr;
+	if (design) {
+		const RTLIL::Module *m = design->module(type);
 		if (m)
 			return m->parameter_default_values.at(paramname);
 	}
@@ -3489,7 +4141,7 @@ RTLIL::SigChunk::SigChunk(const RTLIL::SigBit &bit)
 	wire = bit.wire;
 	offset = 0;
 	if (wire == NULL)
-		data = RTLIL::Const(bit.data).bits;
+		data = RTLIL::Const(bit.data).bits();
 	else
 		offset = bit.offset;
 	width = 1;
@@ -3754,7 +4406,7 @@ void RTLIL::SigSpec::pack() const
 	cover("kernel.rtlil.sigspec.convert.pack");
 	log_assert(that->chunks_.empty());
 
-	std::vector<RTLIL::SigBit> old_bits;
+	bit_vector old_bits;
 	old_bits.swap(that->bits_);
 
 	RTLIL::SigChunk *last = NULL;
@@ -4123,7 +4775,7 @@ void RTLIL::SigSpec::remove_const()
 	{
 		cover("kernel.rtlil.sigspec.remove_const.packed");
 
-		std::vector<RTLIL::SigChunk> new_chunks;
+		chunk_vector new_chunks;
 		new_chunks.reserve(GetSize(chunks_));
 
 		width_ = 0;
@@ -4145,7 +4797,7 @@ void RTLIL::SigSpec::remove_const()
 	{
 		cover("kernel.rtlil.sigspec.remove_const.unpacked");
 
-		std::vector<RTLIL::SigBit> new_bits;
+		bit_vector new_bits;
 		new_bits.reserve(width_);
 
 		for (auto &bit : bits_)
@@ -4179,7 +4831,11 @@ RTLIL::SigSpec RTLIL::SigSpec::extract(int offset, int length) const
 {
 	unpack();
 	cover("kernel.rtlil.sigspec.extract_pos");
-	return std::vector<RTLIL::SigBit>(bits_.begin() + offset, bits_.begin() + offset + length);
+
+	RTLIL::SigSpec sig;
+	for (int i = offset; i < offset + length; i++)
+		sig.append(bits_[i]);
+	return sig;
 }
 
 void RTLIL::SigSpec::append(const RTLIL::SigSpec &signal)
@@ -4660,6 +5316,30 @@ pool<RTLIL::SigBit> RTLIL::SigSpec::to_sigbit_pool() const
 	return sigbits;
 }
 
+std::pair<int, size_t> RTLIL::SigSpec::heap_usage(bool as_std_vector) const
+{
+	int allocs = 0;
+	size_t bytes = 0;
+
+	if (as_std_vector) {
+		if (!chunks_.empty())
+			allocs++, bytes += chunks_.size() * sizeof(RTLIL::SigChunk);
+		if (!bits_.empty())
+			allocs++, bytes += bits_.size() * sizeof(RTLIL::SigBit);
+	} else {
+		if (!chunks_.is_inline())
+			allocs++, bytes += chunks_.heap_size();
+		if (!bits_.is_inline())
+			allocs++, bytes += bits_.heap_size();
+	}
+
+	for (auto &c : chunks_)
+		if (c.data.capacity())
+			allocs++, bytes += c.data.capacity() * sizeof(RTLIL::State);
+
+	return std::make_pair(allocs, bytes);
+}
+
 std::vector<RTLIL::SigBit> RTLIL::SigSpec::to_sigbit_vector() const
 {
 	cover("kernel.rtlil.sigspec.to_sigbit_vector");
@@ -84,6 +84,15 @@ namespace RTLIL
 		#undef YOSYS_NO_IDS_REFCNT
 
 		// the global id string cache
+		//
+		// The names and reference counts are stored in fixed-size chunks that
+		// never move once allocated, so c_str() and reference counting do not
+		// need any locking. The name-to-index map is split into shards with
+		// one mutex each, so that worker threads (see kernel/threading.h) can
+		// intern names concurrently. While worker threads are active, names
+		// whose reference count drops to zero are only freed at the next call
+		// to release_deferred(), as another thread might pick them up from the
+		// index in the meantime.
 
 		static struct destruct_guard_t {
 			bool ok; // POD, will be initialized to zero
@@ -91,169 +100,115 @@ namespace RTLIL
 			~destruct_guard_t() { ok = false; }
 		} destruct_guard;
 
-		static std::vector<char*> global_id_storage_;
-		static dict<char*, int, hash_cstr_ops> global_id_index_;
+		enum : int {
+			chunk_bits_ = 16,
+			chunk_size_ = 1 << chunk_bits_,
+			max_chunks_ = 0x40000000 >> chunk_bits_,
+			index_shards_ = 64
+		};
+
+		struct index_shard_t {
+			ys_mutex mutex;
+			dict<char*, int, hash_cstr_ops> index;
+		};
+
+		static char **global_id_chunks_[max_chunks_];
+		static std::atomic<int> global_id_count_;
+		static index_shard_t global_id_index_[index_shards_];
+		static ys_mutex global_id_alloc_mutex_;
 	#ifndef YOSYS_NO_IDS_REFCNT
-		static std::vector<int> global_refcount_storage_;
+		static std::atomic<int> *global_refcount_chunks_[max_chunks_];
 		static std::vector<int> global_free_idx_list_;
+		static std::vector<int> global_deferred_idx_list_;
 	#endif
 
+		// number of active parallel sections, see parallel_for()
+		static std::atomic<int> concurrent_;
+
 	#ifdef YOSYS_USE_STICKY_IDS
 		static int last_created_idx_ptr_;
 		static int last_created_idx_[8];
 	#endif
 
+		static inline char *&global_id_storage(int idx) {
+			return global_id_chunks_[idx >> chunk_bits_][idx & (chunk_size_ - 1)];
+		}
+
+	#ifndef YOSYS_NO_IDS_REFCNT
+		static inline std::atomic<int> &global_refcount(int idx) {
+			return global_refcount_chunks_[idx >> chunk_bits_][idx & (chunk_size_ - 1)];
+		}
+	#endif
+
 		static inline void xtrace_db_dump()
 		{
 		#ifdef YOSYS_XTRACE_GET_PUT
-			for (int idx = 0; idx < GetSize(global_id_storage_); idx++)
+			for (int idx = 0; idx < global_id_count_; idx++)
 			{
-				if (global_id_storage_.at(idx) == nullptr)
+				if (global_id_storage(idx) == nullptr)
 					log("#X# DB-DUMP index %d: FREE\n", idx);
 				else
-					log("#X# DB-DUMP index %d: '%s' (ref %d)\n", idx, global_id_storage_.at(idx), global_refcount_storage_.at(idx));
+					log("#X# DB-DUMP index %d: '%s' (ref %d)\n", idx, global_id_storage(idx), global_refcount(idx).load());
 			}
 		#endif
 		}
 
-		static inline void checkpoint()
-		{
-		#ifdef YOSYS_USE_STICKY_IDS
-			last_created_idx_ptr_ = 0;
-			for (int i = 0; i < 8; i++) {
-				if (last_created_idx_[i])
-					put_reference(last_created_idx_[i]);
-				last_created_idx_[i] = 0;
-			}
-		#endif
-		#ifdef YOSYS_SORT_ID_FREE_LIST
-			std::sort(global_free_idx_list_.begin(), global_free_idx_list_.end(), std::greater<int>());
-		#endif
-		}
+		static void checkpoint();
+		static void release_deferred();
 
 		static inline int get_reference(int idx)
 		{
 			if (idx) {
 		#ifndef YOSYS_NO_IDS_REFCNT
-				global_refcount_storage_[idx]++;
+				std::atomic<int> &refcount = global_refcount(idx);
+				if (concurrent_.load(std::memory_order_relaxed))
+					refcount.fetch_add(1, std::memory_order_relaxed);
+				else
+					refcount.store(refcount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 		#endif
 		#ifdef YOSYS_XTRACE_GET_PUT
 				if (yosys_xtrace)
-					log("#X# GET-BY-INDEX '%s' (index %d, refcount %d)\n", global_id_storage_.at(idx), idx, global_refcount_storage_.at(idx));
+					log("#X# GET-BY-INDEX '%s' (index %d, refcount %d)\n", global_id_storage(idx), idx, global_refcount(idx).load());
 		#endif
 			}
 			return idx;
 		}
 
-		static int get_reference(const char *p)
-		{
-			log_assert(destruct_guard.ok);
-
-			if (!p[0])
-				return 0;
-
-			auto it = global_id_index_.find((char*)p);
-			if (it != global_id_index_.end()) {
-		#ifndef YOSYS_NO_IDS_REFCNT
-				global_refcount_storage_.at(it->second)++;
-		#endif
-		#ifdef YOSYS_XTRACE_GET_PUT
-				if (yosys_xtrace)
-					log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id_storage_.at(it->second), it->second, global_refcount_storage_.at(it->second));
-		#endif
-				return it->second;
-			}
-
-			log_assert(p[0] == '$' || p[0] == '\\');
-			log_assert(p[1] != 0);
-			for (const char *c = p; *c; c++)
-				if ((unsigned)*c <= (unsigned)' ')
-					log_error("Found control character or space (0x%02x) in string '%s' which is not allowed in RTLIL identifiers\n", *c, p);
-
-		#ifndef YOSYS_NO_IDS_REFCNT
-			if (global_free_idx_list_.empty()) {
-				if (global_id_storage_.empty()) {
-					global_refcount_storage_.push_back(0);
-					global_id_storage_.push_back((char*)"");
-					global_id_index_[global_id_storage_.back()] = 0;
-				}
-				log_assert(global_id_storage_.size() < 0x40000000);
-				global_free_idx_list_.push_back(global_id_storage_.size());
-				global_id_storage_.push_back(nullptr);
-				global_refcount_storage_.push_back(0);
-			}
-
-			int idx = global_free_idx_list_.back();
-			global_free_idx_list_.pop_back();
-			global_id_storage_.at(idx) = strdup(p);
-			global_id_index_[global_id_storage_.at(idx)] = idx;
-			global_refcount_storage_.at(idx)++;
-		#else
-			if (global_id_storage_.empty()) {
-				global_id_storage_.push_back((char*)"");
-				global_id_index_[global_id_storage_.back()] = 0;
-			}
-			int idx = global_id_storage_.size();
-			global_id_storage_.push_back(strdup(p));
-			global_id_index_[global_id_storage_.back()] = idx;
-		#endif
-
-			if (yosys_xtrace) {
-				log("#X# New IdString '%s' with index %d.\n", p, idx);
-				log_backtrace("-X- ", yosys_xtrace-1);
-			}
-
-		#ifdef YOSYS_XTRACE_GET_PUT
-			if (yosys_xtrace)
-				log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id_storage_.at(idx), idx, global_refcount_storage_.at(idx));
-		#endif
-
-		#ifdef YOSYS_USE_STICKY_IDS
-			// Avoid Create->Delete->Create pattern
-			if (last_created_idx_[last_created_idx_ptr_])
-				put_reference(last_created_idx_[last_created_idx_ptr_]);
-			last_created_idx_[last_created_idx_ptr_] = idx;
-			get_reference(last_created_idx_[last_created_idx_ptr_]);
-			last_created_idx_ptr_ = (last_created_idx_ptr_ + 1) & 7;
-		#endif
-
-			return idx;
-		}
+		static int get_reference(const char *p);
 
 	#ifndef YOSYS_NO_IDS_REFCNT
 		static inline void put_reference(int idx)
 		{
 			// put_reference() may be called from destructors after the destructor of
-			// global_refcount_storage_ has been run. in this case we simply do nothing.
+			// destruct_guard has been run. in this case we simply do nothing.
 			if (!destruct_guard.ok || !idx)
 				return;
 
 		#ifdef YOSYS_XTRACE_GET_PUT
 			if (yosys_xtrace) {
-				log("#X# PUT '%s' (index %d, refcount %d)\n", global_id_storage_.at(idx), idx, global_refcount_storage_.at(idx));
+				log("#X# PUT '%s' (index %d, refcount %d)\n", global_id_storage(idx), idx, global_refcount(idx).load());
 			}
 		#endif
 
-			int &refcount = global_refcount_storage_[idx];
+			std::atomic<int> &refcount = global_refcount(idx);
 
-			if (--refcount > 0)
+			if (concurrent_.load(std::memory_order_relaxed)) {
+				if (refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					defer_free_reference(idx);
 				return;
-
-			log_assert(refcount == 0);
-			free_reference(idx);
-		}
-		static inline void free_reference(int idx)
-		{
-			if (yosys_xtrace) {
-				log("#X# Removed IdString '%s' with index %d.\n", global_id_storage_.at(idx), idx);
-				log_backtrace("-X- ", yosys_xtrace-1);
 			}
 
-			global_id_index_.erase(global_id_storage_.at(idx));
-			free(global_id_storage_.at(idx));
-			global_id_storage_.at(idx) = nullptr;
-			global_free_idx_list_.push_back(idx);
+			int count = refcount.load(std::memory_order_relaxed) - 1;
+			refcount.store(count, std::memory_order_relaxed);
+
+			if (count > 0)
+				return;
+
+			log_assert(count == 0);
+			free_reference(idx);
 		}
+		static void free_reference(int idx);
+		static void defer_free_reference(int idx);
 	#else
 		static inline void put_reference(int) { }
 	#endif
@@ -285,11 +240,11 @@ namespace RTLIL
 		}
 
 		inline const char *c_str() const {
-			return global_id_storage_.at(index_);
+			return global_id_storage(index_);
 		}
 
 		inline std::string str() const {
-			return std::string(global_id_storage_.at(index_));
+			return std::string(global_id_storage(index_));
 		}
 
 		inline bool operator<(const IdString &rhs) const {
@@ -456,6 +411,11 @@ namespace RTLIL
 	}
 
 	// see calc.cc for the implementation of this functions
+
+	// Enables the word-parallel evaluation of fully defined operands in the
+	// const_* functions (default). "bench -calc" clears it for comparison.
+	extern bool const_word_ops;
+
 	RTLIL::Const const_not         (const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len);
 	RTLIL::Const const_and         (const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len);
 	RTLIL::Const const_or          (const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len);
@@ -650,13 +610,24 @@ namespace RTLIL
 struct RTLIL::Const
 {
 	int flags;
-	std::vector<RTLIL::State> bits;
 
-	Const() : flags(RTLIL::CONST_FLAG_NONE) {}
+private:
+	// Fully defined values can be stored packed, with one bit instead of one
+	// byte per state (see pack()). While a value is packed, packed_width_ is
+	// its width and bits_ holds bit i of the value in bit i%8 of byte i/8.
+	int packed_width_;
+	std::vector<RTLIL::State> bits_;
+
+	void unpack();
+	unsigned int hash_packed() const;
+
+public:
+	Const() : flags(RTLIL::CONST_FLAG_NONE), packed_width_(0) {}
 	Const(const std::string &str);
 	Const(int val, int width = 32);
 	Const(RTLIL::State bit, int width = 1);
-	Const(const std::vector<RTLIL::State> &bits) : bits(bits) { flags = CONST_FLAG_NONE; }
+	Const(const std::vector<RTLIL::State> &bits) : flags(CONST_FLAG_NONE), packed_width_(0), bits_(bits) {}
+	Const(std::vector<RTLIL::State> &&bits) : flags(CONST_FLAG_NONE), packed_width_(0), bits_(std::move(bits)) {}
 	Const(const std::vector<bool> &bits);
 	Const(const RTLIL::Const &c) = default;
 	RTLIL::Const &operator =(const RTLIL::Const &other) = default;
@@ -665,6 +636,22 @@ struct RTLIL::Const
 	bool operator ==(const RTLIL::Const &other) const;
 	bool operator !=(const RTLIL::Const &other) const;
 
+	// The states of the value, for code that modifies them or needs them as a
+	// vector. This unpacks a packed value, so code that only reads the states
+	// should use size(), operator[] and the iterators on a const Const, which
+	// work on both representations, or to_bits() for a copy.
+	std::vector<RTLIL::State> &bits() {
+		if (packed_width_ != 0)
+			unpack();
+		return bits_;
+	}
+	std::vector<RTLIL::State> to_bits() const;
+
+	// Pack the value if it is fully defined. This is used for large values
+	// that are rarely modified, such as the initialization data of memories.
+	void pack();
+	bool is_packed() const { return packed_width_ != 0; }
+
 	bool as_bool() const;
 	int as_int(bool is_signed = false) const;
 	std::string as_string() const;
@@ -672,12 +659,47 @@ struct RTLIL::Const
 
 	std::string decode_string() const;
 
-	inline int size() const { return bits.size(); }
-	inline bool empty() const { return bits.empty(); }
-	inline RTLIL::State &operator[](int index) { return bits.at(index); }
-	inline const RTLIL::State &operator[](int index) const { return bits.at(index); }
-	inline decltype(bits)::iterator begin() { return bits.begin(); }
-	inline decltype(bits)::iterator end() { return bits.end(); }
+	// Fully defined values can be packed into 64-bit words, with bit i of the
+	// value in bit i%64 of words[i/64], for word-parallel evaluation. as_words()
+	// returns false if the value contains any bits other than 0 and 1.
+	bool as_words(std::vector<uint64_t> &words) const;
+	static Const from_words(const std::vector<uint64_t> &words, int width);
+
+	inline int size() const { return packed_width_ != 0 ? packed_width_ : GetSize(bits_); }
+	inline bool empty() const { return size() == 0; }
+	inline RTLIL::State &operator[](int index) { return bits().at(index); }
+	inline RTLIL::State operator[](int index) const {
+		if (packed_width_ == 0)
+			return bits_.at(index);
+		log_assert(index >= 0 && index < packed_width_);
+		return RTLIL::State((bits_[index >> 3] >> (index & 7)) & 1);
+	}
+	inline RTLIL::State back() const { return (*this)[size() - 1]; }
+	inline std::vector<RTLIL::State>::iterator begin() { return bits().begin(); }
+	inline std::vector<RTLIL::State>::iterator end() { return bits().end(); }
+
+	struct const_iterator {
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef RTLIL::State value_type;
+		typedef ptrdiff_t difference_type;
+		typedef const RTLIL::State *pointer;
+		typedef RTLIL::State reference;
+
+		const RTLIL::Const *parent;
+		int index;
+
+		const_iterator(const RTLIL::Const *parent, int index) : parent(parent), index(index) {}
+		inline RTLIL::State operator*() const { return (*parent)[index]; }
+		inline const_iterator &operator++() { index++; return *this; }
+		inline const_iterator &operator--() { index--; return *this; }
+		inline const_iterator operator++(int) { const_iterator it = *this; index++; return it; }
+		inline const_iterator operator--(int) { const_iterator it = *this; index--; return it; }
+		inline bool operator==(const const_iterator &other) const { return index == other.index; }
+		inline bool operator!=(const const_iterator &other) const { return index != other.index; }
+	};
+
+	inline const_iterator begin() const { return const_iterator(this, 0); }
+	inline const_iterator end() const { return const_iterator(this, size()); }
 
 	bool is_fully_zero() const;
 	bool is_fully_ones() const;
@@ -685,26 +707,30 @@ struct RTLIL::Const
 	bool is_fully_undef() const;
 	bool is_onehot(int *pos = nullptr) const;
 
-	inline RTLIL::Const extract(int offset, int len = 1, RTLIL::State padding = RTLIL::State::S0) const {
-		RTLIL::Const ret;
-		ret.bits.reserve(len);
-		for (int i = offset; i < offset + len; i++)
-			ret.bits.push_back(i < GetSize(bits) ? bits[i] : padding);
-		return ret;
-	}
+	RTLIL::Const extract(int offset, int len = 1, RTLIL::State padding = RTLIL::State::S0) const;
 
 	void extu(int width) {
-		bits.resize(width, RTLIL::State::S0);
+		bits().resize(width, RTLIL::State::S0);
 	}
 
 	void exts(int width) {
-		bits.resize(width, bits.empty() ? RTLIL::State::Sx : bits.back());
+		std::vector<RTLIL::State> &b = bits();
+		b.resize(width, b.empty() ? RTLIL::State::Sx : b.back());
 	}
 
 	inline unsigned int hash() const {
+		if (packed_width_ != 0)
+			return hash_packed();
+		// RTLIL::State is a single byte, so hash eight bits at a time
 		unsigned int h = mkhash_init;
-		for (auto b : bits)
-			mkhash(h, b);
+		size_t i = 0, n = bits_.size();
+		for (; i + 8 <= n; i += 8) {
+			uint64_t w;
+			memcpy(&w, bits_.data() + i, 8);
+			h = mkhash(mkhash(h, (unsigned int)w), (unsigned int)(w >> 32));
+		}
+		for (; i < n; i++)
+			h = mkhash(h, bits_[i]);
 		return h;
 	}
 };
@@ -750,8 +776,8 @@ struct RTLIL::SigChunk
 	int width, offset;
 
 	SigChunk() : wire(nullptr), width(0), offset(0) {}
-	SigChunk(const RTLIL::Const &value) : wire(nullptr), data(value.bits), width(GetSize(data)), offset(0) {}
-	SigChunk(RTLIL::Const &&value) : wire(nullptr), data(std::move(value.bits)), width(GetSize(data)), offset(0) {}
+	SigChunk(const RTLIL::Const &value) : wire(nullptr), data(value.to_bits()), width(GetSize(data)), offset(0) {}
+	SigChunk(RTLIL::Const &&value) : wire(nullptr), data(std::move(value.bits())), width(GetSize(data)), offset(0) {}
 	SigChunk(RTLIL::Wire *wire) : wire(wire), width(GetSize(wire)), offset(0) {}
 	SigChunk(RTLIL::Wire *wire, int offset, int width = 1) : wire(wire), width(width), offset(offset) {}
 	SigChunk(const std::string &str) : SigChunk(RTLIL::Const(str)) {}
@@ -822,8 +848,15 @@ struct RTLIL::SigSpec
 private:
 	int width_;
 	unsigned long hash_;
-	std::vector<RTLIL::SigChunk> chunks_; // LSB at index 0
-	std::vector<RTLIL::SigBit> bits_; // LSB at index 0
+public:
+	// Most signals on fine-grained cells are a single chunk or bit, which
+	// these keep inline without allocating.
+	typedef small_vector<RTLIL::SigChunk, 1> chunk_vector;
+	typedef small_vector<RTLIL::SigBit, 1> bit_vector;
+
+private:
+	chunk_vector chunks_; // LSB at index 0
+	bit_vector bits_; // LSB at index 0
 
 	void pack() const;
 	void unpack() const;
@@ -867,8 +900,8 @@ public:
 		return hash_;
 	}
 
-	inline const std::vector<RTLIL::SigChunk> &chunks() const { pack(); return chunks_; }
-	inline const std::vector<RTLIL::SigBit> &bits() const { inline_unpack(); return bits_; }
+	inline const chunk_vector &chunks() const { pack(); return chunks_; }
+	inline const bit_vector &bits() const { inline_unpack(); return bits_; }
 
 	inline int size() const { return width_; }
 	inline bool empty() const { return width_ == 0; }
@@ -967,6 +1000,11 @@ public:
 
 	operator std::vector<RTLIL::SigChunk>() const { return chunks(); }
 	operator std::vector<RTLIL::SigBit>() const { return bits(); }
+
+	// Number of heap allocations and bytes used by the chunk and bit storage
+	// (including constant chunk data). With as_std_vector set, estimate them
+	// for plain std::vector storage instead of the inline storage.
+	std::pair<int, size_t> heap_usage(bool as_std_vector = false) const;
 	const RTLIL::SigBit &at(int offset, const RTLIL::SigBit &defval) { return offset < width_ ? (*this)[offset] : defval; }
 
 	unsigned int hash() const { if (!hash_) updhash(); return hash_; };
@@ -1008,6 +1046,13 @@ struct RTLIL::Selection
 	}
 };
 
+// Monitors in Module::monitors are notified on the thread that works on that
+// module. Design monitors can be notified from the worker threads of
+// module-local passes (see Pass::run_on_modules()). These notifications are
+// serialized, but they can come from any thread and for modules in any
+// order, so a design monitor must be thread-safe with respect to any state it
+// shares with the passes. Do not add or remove design monitors while a pass
+// is running on modules in parallel.
 struct RTLIL::Monitor
 {
 	unsigned int hashidx_;
@@ -1069,6 +1114,19 @@ struct RTLIL::Design
 	void remove(RTLIL::Module *module);
 	void rename(RTLIL::Module *module, RTLIL::IdString new_name);
 
+	// Copy-on-write module sharing, used by "design -save" and friends. A
+	// module of another design is added without copying it. module->design
+	// is the design that owns the object, the others are listed in
+	// module->shared_designs_. Passes write module, wire and cell fields
+	// directly, so all non-const accessors (module(), modules(),
+	// selected_*modules()) unshare a module before handing it out. Read-only
+	// code should use the const accessors or the *_readonly() variants. When the
+	// owner unshares a module it keeps the object and the other designs get
+	// a copy, so Module pointers held by the owner stay valid. The Module
+	// and Cell methods that modify a module unshare it as well.
+	void add_shared(RTLIL::Module *module, bool take_ownership = false);
+	RTLIL::Module *unshare(RTLIL::Module *module);
+
 	void scratchpad_unset(const std::string &varname);
 
 	void scratchpad_set_int(const std::string &varname, int value);
@@ -1128,9 +1186,20 @@ struct RTLIL::Design
 	std::vector<RTLIL::Module*> selected_modules() const;
 	std::vector<RTLIL::Module*> selected_whole_modules() const;
 	std::vector<RTLIL::Module*> selected_whole_modules_warn(bool include_wb = false) const;
+
+	// Like modules() and selected_*modules(), but without unsharing the
+	// modules (see add_shared()). For code that only reads the modules, such
+	// as backends and "stat".
+	std::vector<RTLIL::Module*> modules_readonly() const;
+	std::vector<RTLIL::Module*> selected_modules_readonly() const;
+	std::vector<RTLIL::Module*> selected_whole_modules_warn_readonly(bool include_wb = false) const;
 #ifdef WITH_PYTHON
 	static std::map<unsigned int, RTLIL::Design*> *get_all_designs(void);
 #endif
+
+private:
+	void release(RTLIL::Module *module);
+	void release_shared(RTLIL::Module *module);
 };
 
 struct RTLIL::Module : public RTLIL::AttrObject
@@ -1147,9 +1216,28 @@ public:
 	RTLIL::Design *design;
 	pool<RTLIL::Monitor*> monitors;
 
+	// designs other than 'design' that share this module (see Design::add_shared()),
+	// only changed with the unshare lock held. 'shared_' is set while the list
+	// is not empty, for the unlocked check in unshare().
+	std::vector<RTLIL::Design*> shared_designs_;
+	std::atomic<bool> shared_;
+
+	// copy the module for the other designs before it is modified
+	void unshare() {
+		if (shared_)
+			design->unshare(this);
+	}
+
+	// incrementally maintained SigMap, see SigMap::cached() in kernel/sigtools.h
+	RTLIL::Monitor *sigmap_monitor_;
+
 	int refcount_wires_;
 	int refcount_cells_;
 
+	// storage for the module's wires and cells, released with the module
+	object_arena<RTLIL::Wire> wire_arena_;
+	object_arena<RTLIL::Cell> cell_arena_;
+
 	dict<RTLIL::IdString, RTLIL::Wire*> wires_;
 	dict<RTLIL::IdString, RTLIL::Cell*> cells_;
 
@@ -1180,6 +1268,11 @@ public:
 	void new_connections(const std::vector<RTLIL::SigSig> &new_conn);
 	const std::vector<RTLIL::SigSig> &connections() const;
 
+	// must be called after modifying connections_ or wire names in place
+	void invalidate_sigmap();
+	// delete the cached SigMap, done by Pass::call() when a command ends
+	void release_sigmap();
+
 	std::vector<RTLIL::IdString> ports;
 	void fixup_ports();
 
@@ -1550,8 +1643,8 @@ public:
 	void fixup_parameters(bool set_a_signed = false, bool set_b_signed = false);
 
 	bool has_keep_attr() const {
-		return get_bool_attribute(ID::keep) || (module && module->design && module->design->module(type) &&
-				module->design->module(type)->get_bool_attribute(ID::keep));
+		const RTLIL::Design *design = module ? module->design : nullptr;
+		return get_bool_attribute(ID::keep) || (design && design->module(type) && design->module(type)->get_bool_attribute(ID::keep));
 	}
 
 	template<typename T> void rewrite_sigspecs(T &functor);
@@ -1684,6 +1777,7 @@ inline RTLIL::SigBit::SigBit(const RTLIL::SigSpec &sig) {
 template<typename T>
 void RTLIL::Module::rewrite_sigspecs(T &functor)
 {
+	invalidate_sigmap();
 	for (auto &it : cells_)
 		it.second->rewrite_sigspecs(functor);
 	for (auto &it : processes)
@@ -1697,6 +1791,7 @@ void RTLIL::Module::rewrite_sigspecs(T &functor)
 template<typename T>
 void RTLIL::Module::rewrite_sigspecs2(T &functor)
 {
+	invalidate_sigmap();
 	for (auto &it : cells_)
 		it.second->rewrite_sigspecs2(functor);
 	for (auto &it : processes)
@@ -231,7 +231,7 @@ class SigSet<T, sort_by_name_id_guard<T>> : public SigSet<T, RTLIL::sort_by_name
 
 struct SigMap
 {
-	mfp<SigBit> database;
+	mfp<SigBit, hash_ops<SigBit>, flat_pool<SigBit>> database;
 
 	SigMap(RTLIL::Module *module = NULL)
 	{
@@ -340,8 +340,72 @@ struct SigMap
 				sig.append(bit);
 		return sig;
 	}
+
+	// Returns the SigMap for the module's current connections without
+	// re-scanning them on every call: the map is kept by a SigMapMonitor
+	// attached to the module and follows Module::connect() as it happens.
+	// Passes that add() to their map locally need to take a copy. The map is
+	// only rebuilt by the next cached() call, so a held reference is stale
+	// after new_connections(), renames or invalidate_sigmap(): call cached()
+	// again after changing the module instead of keeping the reference. The
+	// map is released when the top-level command ends.
+	static const SigMap &cached(RTLIL::Module *module);
 };
 
+// Keeps a module's SigMap up to date with the connections added through
+// Module::connect(). Replacing the connections vector, or changes signalled
+// with Module::invalidate_sigmap(), mark it for a rebuild on next use.
+struct SigMapMonitor : public RTLIL::Monitor
+{
+	RTLIL::Module *module;
+	SigMap sigmap;
+	bool dirty;
+
+	SigMapMonitor(RTLIL::Module *module) : module(module), sigmap(module), dirty(false)
+	{
+		module->monitors.insert(this);
+	}
+
+	~SigMapMonitor()
+	{
+		module->monitors.erase(this);
+	}
+
+	void notify_connect(RTLIL::Module*, const RTLIL::SigSig &sigsig) override
+	{
+		// connections with constant bits on the left hand side are
+		// filtered by Module::connect() and notified again
+		if (!dirty && !sigsig.first.has_const())
+			sigmap.add(sigsig.first, sigsig.second);
+	}
+
+	void notify_connect(RTLIL::Module*, const std::vector<RTLIL::SigSig>&) override
+	{
+		dirty = true;
+	}
+
+	void notify_blackout(RTLIL::Module*) override
+	{
+		dirty = true;
+	}
+
+	const SigMap &get()
+	{
+		if (dirty) {
+			sigmap.set(module);
+			dirty = false;
+		}
+		return sigmap;
+	}
+};
+
+inline const SigMap &SigMap::cached(RTLIL::Module *module)
+{
+	if (module->sigmap_monitor_ == nullptr)
+		module->sigmap_monitor_ = new SigMapMonitor(module);
+	return static_cast<SigMapMonitor*>(module->sigmap_monitor_)->get();
+}
+
 YOSYS_NAMESPACE_END
 
 #endif /* SIGTOOLS_H */
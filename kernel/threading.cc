@@ -0,0 +1,213 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/threading.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+int yosys_threads = 1;
+
+int hardware_threads()
+{
+#ifndef YOSYS_DISABLE_THREADS
+	int n = std::thread::hardware_concurrency();
+	if (n > 0)
+		return n;
+#endif
+	return 1;
+}
+
+#ifndef YOSYS_DISABLE_THREADS
+
+static thread_local bool in_worker_thread = false;
+
+ThreadPool::ThreadPool(int num_threads) : queues(num_threads)
+{
+	log_assert(num_threads > 0);
+	current_task = nullptr;
+	generation = 0;
+	pending_tasks = 0;
+	active_workers = 0;
+	shutdown = false;
+
+	for (int i = 0; i < num_threads; i++)
+		workers.push_back(std::thread(&ThreadPool::worker_main, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		shutdown = true;
+	}
+	work_cv.notify_all();
+
+	for (auto &thread : workers)
+		thread.join();
+}
+
+bool ThreadPool::take_task(int worker_idx, int &task_idx)
+{
+	int num_queues = GetSize(queues);
+
+	for (int i = 0; i < num_queues; i++)
+	{
+		worker_queue_t &queue = queues[(worker_idx + i) % num_queues];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+
+		if (queue.tasks.empty())
+			continue;
+
+		if (i == 0) {
+			task_idx = queue.tasks.back();
+			queue.tasks.pop_back();
+		} else {
+			task_idx = queue.tasks.front();
+			queue.tasks.pop_front();
+		}
+		return true;
+	}
+
+	return false;
+}
+
+void ThreadPool::worker_main(int worker_idx)
+{
+	in_worker_thread = true;
+	unsigned int seen_generation = 0;
+
+	while (1)
+	{
+		const std::function<void(int)> *task;
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			work_cv.wait(lock, [&]() { return shutdown || generation != seen_generation; });
+			if (shutdown)
+				return;
+			seen_generation = generation;
+			task = current_task;
+			active_workers++;
+		}
+
+		int task_idx, finished = 0;
+		while (task != nullptr && take_task(worker_idx, task_idx))
+		{
+			try {
+				(*task)(task_idx);
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(mutex);
+				if (!first_exception)
+					first_exception = std::current_exception();
+			}
+			finished++;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			pending_tasks -= finished;
+			active_workers--;
+			if (active_workers == 0)
+				done_cv.notify_all();
+		}
+	}
+}
+
+void ThreadPool::run(int num_tasks, const std::function<void(int)> &task)
+{
+	if (num_tasks <= 0)
+		return;
+
+	std::exception_ptr exception;
+
+	// Switch IdString reference counting to thread-safe mode while the
+	// workers are busy (see RTLIL::IdString::concurrent_).
+	RTLIL::IdString::concurrent_++;
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		// Workers that woke up late for the previous run() may still be
+		// scanning the queues. Wait for them before handing out new tasks.
+		done_cv.wait(lock, [&]() { return active_workers == 0; });
+
+		for (int i = 0; i < num_tasks; i++) {
+			worker_queue_t &queue = queues[i % GetSize(queues)];
+			std::lock_guard<std::mutex> queue_lock(queue.mutex);
+			queue.tasks.push_back(i);
+		}
+
+		current_task = &task;
+		pending_tasks = num_tasks;
+		first_exception = nullptr;
+		generation++;
+		work_cv.notify_all();
+
+		done_cv.wait(lock, [&]() { return pending_tasks == 0 && active_workers == 0; });
+		current_task = nullptr;
+		std::swap(exception, first_exception);
+	}
+
+	if (--RTLIL::IdString::concurrent_ == 0)
+		RTLIL::IdString::release_deferred();
+
+	if (exception)
+		std::rethrow_exception(exception);
+}
+
+static ThreadPool *global_thread_pool = nullptr;
+
+void parallel_for(int num_tasks, const std::function<void(int)> &task)
+{
+	if (yosys_threads <= 1 || num_tasks <= 1 || in_worker_thread) {
+		for (int i = 0; i < num_tasks; i++)
+			task(i);
+		return;
+	}
+
+	if (global_thread_pool != nullptr && global_thread_pool->size() != yosys_threads)
+		parallel_shutdown();
+
+	if (global_thread_pool == nullptr)
+		global_thread_pool = new ThreadPool(yosys_threads);
+
+	global_thread_pool->run(num_tasks, task);
+}
+
+void parallel_shutdown()
+{
+	delete global_thread_pool;
+	global_thread_pool = nullptr;
+}
+
+#else
+
+void parallel_for(int num_tasks, const std::function<void(int)> &task)
+{
+	for (int i = 0; i < num_tasks; i++)
+		task(i);
+}
+
+void parallel_shutdown()
+{
+}
+
+#endif
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1 @@
+namespace Yosys { extern const char *yosys_version_str; const char *yosys_version_str="Yosys 0.22+72 (git sha1 092cb6860, gcc 12.2.0-14+deb12u1 -fPIC -Os)"; }
@@ -19,6 +19,7 @@
 
 #include "kernel/yosys.h"
 #include "kernel/celltypes.h"
+#include "kernel/threading.h"
 
 #ifdef YOSYS_ENABLE_READLINE
 #  include <readline/readline.h>
@@ -75,7 +76,8 @@
 
 YOSYS_NAMESPACE_BEGIN
 
-int autoidx = 1;
+std::atomic<int> autoidx(1);
+static thread_local int autoidx_seq_next = 0, autoidx_seq_stride = 0;
 int yosys_xtrace = 0;
 RTLIL::Design *yosys_design = NULL;
 CellTypes yosys_celltypes;
@@ -576,6 +578,7 @@ void yosys_shutdown()
 	log_pop();
 
 	Pass::done_register();
+	parallel_shutdown();
 
 	delete yosys_design;
 	yosys_design = NULL;
@@ -626,7 +629,7 @@ RTLIL::IdString new_id(std::string file, int line, std::string func)
 	if (pos != std::string::npos)
 		func = func.substr(pos+1);
 
-	return stringf("$auto$%s:%d:%s$%d", file.c_str(), line, func.c_str(), autoidx++);
+	return stringf("$auto$%s:%d:%s$%d", file.c_str(), line, func.c_str(), next_autoidx());
 }
 
 RTLIL::IdString new_id_suffix(std::string file, int line, std::string func, std::string suffix)
@@ -643,7 +646,36 @@ RTLIL::IdString new_id_suffix(std::string file, int line, std::string func, std:
 	if (pos != std::string::npos)
 		func = func.substr(pos+1);
 
-	return stringf("$auto$%s:%d:%s$%s$%d", file.c_str(), line, func.c_str(), suffix.c_str(), autoidx++);
+	return stringf("$auto$%s:%d:%s$%s$%d", file.c_str(), line, func.c_str(), suffix.c_str(), next_autoidx());
+}
+
+int next_autoidx()
+{
+	if (autoidx_seq_stride == 0)
+		return autoidx++;
+	int idx = autoidx_seq_next;
+	autoidx_seq_next += autoidx_seq_stride;
+	return idx;
+}
+
+AutoidxSequence::AutoidxSequence(int start, int stride) : saved_next(autoidx_seq_next), saved_stride(autoidx_seq_stride)
+{
+	log_assert(stride > 0);
+	autoidx_seq_next = start;
+	autoidx_seq_stride = stride;
+}
+
+AutoidxSequence::~AutoidxSequence()
+{
+	int idx = autoidx;
+	while (idx < autoidx_seq_next && !autoidx.compare_exchange_weak(idx, autoidx_seq_next)) { }
+	autoidx_seq_next = saved_next;
+	autoidx_seq_stride = saved_stride;
+}
+
+bool AutoidxSequence::active()
+{
+	return autoidx_seq_stride != 0;
 }
 
 RTLIL::Design *yosys_get_design()
@@ -51,9 +51,14 @@
 #include <initializer_list>
 #include <stdexcept>
 #include <memory>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 
+#ifndef YOSYS_DISABLE_THREADS
+#  include <mutex>
+#endif
+
 #include <sstream>
 #include <fstream>
 #include <istream>
@@ -163,6 +168,10 @@ extern Tcl_Obj *Tcl_ObjSetVar2(Tcl_Interp *interp, Tcl_Obj *part1Ptr, Tcl_Obj *p
 #  define YS_FALLTHROUGH
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#endif
+
 YOSYS_NAMESPACE_BEGIN
 
 // Note: All headers included in hashlib.h must be included
@@ -186,6 +195,25 @@ using std::get;
 using std::min;
 using std::max;
 
+// Mutex for state that is shared with worker threads (see kernel/threading.h).
+// Locking it is a no-op when Yosys is built without thread support.
+#ifdef YOSYS_DISABLE_THREADS
+struct ys_mutex {
+	void lock() { }
+	void unlock() { }
+};
+#else
+typedef std::mutex ys_mutex;
+#endif
+
+struct ys_lock_guard {
+	ys_mutex &mutex;
+	ys_lock_guard(ys_mutex &mutex) : mutex(mutex) { mutex.lock(); }
+	~ys_lock_guard() { mutex.unlock(); }
+	ys_lock_guard(const ys_lock_guard&) = delete;
+	ys_lock_guard &operator=(const ys_lock_guard&) = delete;
+};
+
 // A primitive shared string implementation that does not
 // move its .c_str() when the object is copied or moved.
 struct shared_str {
@@ -211,6 +239,8 @@ using hashlib::dict;
 using hashlib::idict;
 using hashlib::pool;
 using hashlib::mfp;
+using hashlib::flat_dict;
+using hashlib::flat_pool;
 
 namespace RTLIL {
 	struct IdString;
@@ -289,12 +319,34 @@ std::string escape_filename_spaces(const std::string& filename);
 template<typename T> int GetSize(const T &obj) { return obj.size(); }
 inline int GetSize(RTLIL::Wire *wire);
 
-extern int autoidx;
+extern std::atomic<int> autoidx;
+
+// Returns a new value of autoidx for the name of a new object. Within an
+// AutoidxSequence the values come from that sequence instead, so that the
+// names do not depend on the scheduling of concurrent work.
+int next_autoidx();
+
+// Makes next_autoidx() on this thread return start, start + stride,
+// start + 2*stride, ... until the object is destroyed, which then raises
+// autoidx past the values used. Pass::run_on_modules() gives the i-th of n
+// modules the sequence starting at autoidx + i with stride n, so that the
+// names created for each module do not depend on which thread runs it.
+struct AutoidxSequence
+{
+	int saved_next, saved_stride;
+
+	AutoidxSequence(int start, int stride);
+	~AutoidxSequence();
+
+	static bool active();
+};
 extern int yosys_xtrace;
 
 YOSYS_NAMESPACE_END
 
 #include "kernel/log.h"
+#include "kernel/small_vector.h"
+#include "kernel/arena.h"
 #include "kernel/rtlil.h"
 #include "kernel/register.h"
 
@@ -154,7 +154,7 @@ struct CheckPass : public Pass {
 
 			for (auto cell : module->cells())
 			{
-				if (mapped && cell->type.begins_with("$") && design->module(cell->type) == nullptr) {
+				if (mapped && cell->type.begins_with("$") && !design->has(cell->type)) {
 					if (allow_tbuf && cell->type == ID($_TBUF_)) goto cell_allowed;
 					log_warning("Cell %s.%s is an unmapped internal cell of type %s.\n", log_id(module), log_id(cell), log_id(cell->type));
 					counter++;
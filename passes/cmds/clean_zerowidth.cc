@@ -62,8 +62,16 @@ struct CleanZeroWidthPass : public Pass {
 		CellTypes ct;
 		ct.setup();
 
-		for (auto module : design->selected_modules())
+		// The cells and connections are only changed through the Module and
+		// Cell methods, which unshare the module (see Design::add_shared()).
+		// Processes and memories are rewritten in place, so a module with any
+		// of them is unshared first.
+		for (auto module : design->selected_modules_readonly())
 		{
+			std::vector<Mem> mems = Mem::get_selected_memories(module);
+			if (!module->processes.empty() || !mems.empty())
+				module->unshare();
+
 			for (auto cell : module->selected_cells())
 			{
 				if (!ct.cell_known(cell->type)) {
@@ -160,7 +168,7 @@ struct CleanZeroWidthPass : public Pass {
 							memwr.address = State::S0;
 						Const priority_mask;
 						for (auto x : swizzle) {
-							priority_mask.bits.push_back(memwr.priority_mask.bits[x]);
+							priority_mask.bits().push_back(memwr.priority_mask.bits()[x]);
 						}
 						memwr.priority_mask = priority_mask;
 						swizzle.push_back(i);
@@ -175,7 +183,7 @@ struct CleanZeroWidthPass : public Pass {
 				}
 			}
 
-			for (auto &mem : Mem::get_selected_memories(module)) {
+			for (auto &mem : mems) {
 				if (mem.width == 0) {
 					mem.remove();
 					continue;
@@ -202,7 +210,8 @@ struct CleanZeroWidthPass : public Pass {
 			for (auto &conn : module->connections())
 				if (GetSize(conn.first) != 0)
 					new_conns.push_back(conn);
-			module->new_connections(new_conns);
+			if (GetSize(new_conns) != GetSize(module->connections()))
+				module->new_connections(new_conns);
 		}
 	}
 } CleanZeroWidthPass;
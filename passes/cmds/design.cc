@@ -218,7 +218,8 @@ struct DesignPass : public Pass {
 				argidx = args.size();
 			}
 
-			for (auto mod : copy_from_design->modules()) {
+			for (auto &it : copy_from_design->modules_) {
+				RTLIL::Module *mod = it.second;
 				if (sel.selected_whole_module(mod->name)) {
 					copy_src_modules.push_back(mod);
 					continue;
@@ -288,7 +289,7 @@ struct DesignPass : public Pass {
 				for (auto mod : old_queue)
 				for (auto cell : mod->cells())
 				{
-					Module *fmod = copy_from_design->module(cell->type);
+					const Module *fmod = static_cast<const RTLIL::Design*>(copy_from_design)->module(cell->type);
 
 					if (fmod == nullptr)
 						continue;
@@ -340,8 +341,9 @@ struct DesignPass : public Pass {
 		{
 			RTLIL::Design *design_copy = new RTLIL::Design;
 
-			for (auto mod : design->modules())
-				design_copy->add(mod->clone());
+			// modules are only copied once one of the designs modifies them
+			for (auto &it : design->modules_)
+				design_copy->add_shared(it.second);
 
 			design_copy->selection_stack = design->selection_stack;
 			design_copy->selection_vars = design->selection_vars;
@@ -358,7 +360,10 @@ struct DesignPass : public Pass {
 
 		if (reset_mode || !load_name.empty() || push_mode || pop_mode)
 		{
-			for (auto mod : design->modules().to_vector())
+			std::vector<RTLIL::Module*> modules;
+			for (auto &it : design->modules_)
+				modules.push_back(it.second);
+			for (auto mod : modules)
 				design->remove(mod);
 
 			design->selection_stack.clear();
@@ -385,8 +390,10 @@ struct DesignPass : public Pass {
 		{
 			RTLIL::Design *saved_design = pop_mode ? pushed_designs.back() : saved_designs.at(load_name);
 
-			for (auto mod : saved_design->modules())
-				design->add(mod->clone());
+			// the current design takes over the modules, so that it keeps
+			// them when they are modified
+			for (auto &it : saved_design->modules_)
+				design->add_shared(it.second, true);
 
 			design->selection_stack = saved_design->selection_stack;
 			design->selection_vars = saved_design->selection_vars;
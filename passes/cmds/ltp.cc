@@ -20,6 +20,7 @@
 #include "kernel/yosys.h"
 #include "kernel/celltypes.h"
 #include "kernel/sigtools.h"
+#include "kernel/modtools.h"
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
@@ -28,17 +29,19 @@ struct LtpWorker
 {
 	RTLIL::Design *design;
 	RTLIL::Module *module;
-	SigMap sigmap;
+	ModGraph graph;
 
-	dict<SigBit, tuple<int, SigBit, Cell*>> bits;
-	dict<SigBit, dict<SigBit, Cell*>> bit2bits;
-	dict<SigBit, tuple<SigBit, Cell*>> bit2ff;
+	// per bit id: level, previous bit id and the cell in between
+	std::vector<int> level, from;
+	std::vector<RTLIL::Cell*> via;
+	std::vector<bool> is_ff, busy;
+	dict<int, tuple<SigBit, Cell*>> bit2ff;
+	std::vector<int> start_bits;
 
 	int maxlvl;
-	SigBit maxbit;
-	pool<SigBit> busy;
+	int maxbit;
 
-	LtpWorker(RTLIL::Module *module, bool noff) : design(module->design), module(module), sigmap(module)
+	LtpWorker(RTLIL::Module *module, bool noff) : design(module->design), module(module), graph(module, module->selected_cells())
 	{
 		CellTypes ff_celltypes;
 
@@ -47,86 +50,75 @@ struct LtpWorker
 			ff_celltypes.setup_stdcells_mem();
 		}
 
-		for (auto wire : module->selected_wires())
-			for (auto bit : sigmap(wire))
-				bits[bit] = tuple<int, SigBit, Cell*>(-1, State::Sx, nullptr);
-
-		for (auto cell : module->selected_cells())
-		{
-			pool<SigBit> src_bits, dst_bits;
-
-			for (auto &conn : cell->connections())
-				for (auto bit : sigmap(conn.second)) {
-					if (cell->input(conn.first))
-						src_bits.insert(bit);
-					if (cell->output(conn.first))
-						dst_bits.insert(bit);
-				}
+		level.assign(graph.num_bits(), -1);
+		from.assign(graph.num_bits(), -1);
+		via.assign(graph.num_bits(), nullptr);
+		busy.assign(graph.num_bits(), false);
 
+		is_ff.assign(graph.num_cells(), false);
+		for (int c = 0; c < graph.num_cells(); c++) {
+			Cell *cell = graph.cell(c);
 			if (noff && ff_celltypes.cell_known(cell->type)) {
-				for (auto s : src_bits)
-					for (auto d : dst_bits) {
-						bit2ff[s] = tuple<SigBit, Cell*>(d, cell);
-						break;
-					}
-				continue;
+				is_ff[c] = true;
+				if (!graph.outputs(c).empty())
+					for (auto s : graph.inputs(c))
+						bit2ff[s] = tuple<SigBit, Cell*>(graph.bit(graph.outputs(c)[0]), cell);
 			}
-
-			for (auto s : src_bits)
-				for (auto d : dst_bits)
-					bit2bits[s][d] = cell;
 		}
 
+		pool<int> selected_bits;
+		for (auto wire : module->selected_wires())
+			for (auto bit : graph.sigmap(wire))
+				if (bit.wire != nullptr && selected_bits.insert(graph.bit_id(bit)).second)
+					start_bits.push_back(graph.bit_id(bit));
+
 		maxlvl = -1;
-		maxbit = State::Sx;
+		maxbit = -1;
 	}
 
-	void runner(SigBit bit, int level, SigBit from, Cell *via)
+	void runner(int bit, int lvl, int from_bit, Cell *via_cell)
 	{
-		auto &bitinfo = bits.at(bit);
-
-		if (get<0>(bitinfo) >= level)
+		if (level[bit] >= lvl)
 			return;
 
-		if (busy.count(bit) > 0) {
-			log_warning("Detected loop at %s in %s\n", log_signal(bit), log_id(module));
+		if (busy[bit]) {
+			log_warning("Detected loop at %s in %s\n", log_signal(graph.bit(bit)), log_id(module));
 			return;
 		}
 
-		busy.insert(bit);
-		get<0>(bitinfo) = level;
-		get<1>(bitinfo) = from;
-		get<2>(bitinfo) = via;
+		busy[bit] = true;
+		level[bit] = lvl;
+		from[bit] = from_bit;
+		via[bit] = via_cell;
 
-		if (level > maxlvl) {
-			maxlvl = level;
+		if (lvl > maxlvl) {
+			maxlvl = lvl;
 			maxbit = bit;
 		}
 
-		if (bit2bits.count(bit)) {
-			for (auto &it : bit2bits.at(bit))
-				runner(it.first, level+1, bit, it.second);
-		}
+		for (auto &pb : graph.consumers(bit))
+			if (!is_ff[pb.cell])
+				for (auto d : graph.outputs(pb.cell))
+					runner(d, lvl+1, bit, graph.cell(pb));
 
-		busy.erase(bit);
+		busy[bit] = false;
 	}
 
-	void printpath(SigBit bit)
+	void printpath(int bit)
 	{
-		auto &bitinfo = bits.at(bit);
-		if (get<2>(bitinfo)) {
-			printpath(get<1>(bitinfo));
-			log("%5d: %s (via %s)\n", get<0>(bitinfo), log_signal(bit), log_id(get<2>(bitinfo)));
+		if (via[bit]) {
+			printpath(from[bit]);
+			log("%5d: %s (via %s)\n", level[bit], log_signal(graph.bit(bit)), log_id(via[bit]));
 		} else {
-			log("%5d: %s\n", get<0>(bitinfo), log_signal(bit));
+			log("%5d: %s\n", level[bit], log_signal(graph.bit(bit)));
 		}
 	}
 
 	void run()
 	{
-		for (auto &it : bits)
-			if (get<0>(it.second) < 0)
-				runner(it.first, 0, State::Sx, nullptr);
+		for (auto it = start_bits.rbegin(); it != start_bits.rend(); ++it)
+			if (level[*it] < 0)
+				runner(*it, 0, -1, nullptr);
 
 		log("\n");
 		log("Longest topological path in %s (length=%d):\n", log_id(module), maxlvl);
@@ -0,0 +1,323 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+#include <chrono>
+#include <inttypes.h>
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+struct ProfileNode
+{
+	std::string command;
+	int parent, depth;
+	std::vector<int> children;
+
+	int64_t begin_ns, end_ns;
+	int64_t cpu_begin_ns, cpu_end_ns;
+	int64_t rss_begin_kb, rss_end_kb;
+	int cells_before, cells_after;
+	int wires_before, wires_after;
+};
+
+static int64_t wall_time_ns()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int64_t peak_rss_kb()
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+	struct rusage rusage;
+	if (getrusage(RUSAGE_SELF, &rusage) == 0)
+		return rusage.ru_maxrss;
+#elif defined(__APPLE__)
+	struct rusage rusage;
+	if (getrusage(RUSAGE_SELF, &rusage) == 0)
+		return rusage.ru_maxrss / 1024;
+#endif
+	return 0;
+}
+
+static void count_design(RTLIL::Design *design, int &cells, int &wires)
+{
+	cells = 0;
+	wires = 0;
+
+	// modules_ instead of modules(): don't unshare modules of saved designs
+	for (auto &it : design->modules_) {
+		cells += GetSize(it.second->cells_);
+		wires += GetSize(it.second->wires_);
+	}
+}
+
+static std::string json_string(const std::string &str)
+{
+	std::string result = "\"";
+	for (char c : str) {
+		if (c == '"' || c == '\\')
+			result += stringf("\\%c", c);
+		else if ((unsigned char)c < 0x20)
+			result += stringf("\\u%04x", c);
+		else
+			result += c;
+	}
+	return result + "\"";
+}
+
+struct Profiler : PassProfiler
+{
+	std::vector<ProfileNode> nodes;
+	std::vector<int> stack;
+	int64_t start_ns;
+
+	Profiler() : start_ns(wall_time_ns()) { }
+
+	void pass_begin(Pass*, const std::vector<std::string> &args, RTLIL::Design *design) override
+	{
+		ProfileNode node;
+		node.command = join(args);
+		node.parent = stack.empty() ? -1 : stack.back();
+		node.depth = GetSize(stack);
+		node.begin_ns = wall_time_ns() - start_ns;
+		node.cpu_begin_ns = PerformanceTimer::query();
+		node.rss_begin_kb = peak_rss_kb();
+		count_design(design, node.cells_before, node.wires_before);
+
+		if (node.parent >= 0)
+			nodes[node.parent].children.push_back(GetSize(nodes));
+		stack.push_back(GetSize(nodes));
+		nodes.push_back(node);
+	}
+
+	void pass_end(Pass*, RTLIL::Design *design) override
+	{
+		log_assert(!stack.empty());
+		ProfileNode &node = nodes[stack.back()];
+		stack.pop_back();
+
+		node.end_ns = wall_time_ns() - start_ns;
+		node.cpu_end_ns = PerformanceTimer::query();
+		node.rss_end_kb = peak_rss_kb();
+		count_design(design, node.cells_after, node.wires_after);
+	}
+
+	static std::string join(const std::vector<std::string> &args)
+	{
+		std::string str;
+		for (auto &arg : args)
+			str += (str.empty() ? "" : " ") + arg;
+		return str;
+	}
+
+	void log_report(int max_depth)
+	{
+		log("\n");
+		log("      wall        cpu   peak RSS         cells          wires   command\n");
+		for (auto &node : nodes) {
+			if (max_depth >= 0 && node.depth > max_depth)
+				continue;
+			std::string command = node.command;
+			if (GetSize(command) > 60)
+				command = command.substr(0, 57) + "...";
+			log("%8.3f s %8.3f s %+7.1f MB %6d %+7d %6d %+7d   %*s%s\n",
+					(node.end_ns - node.begin_ns) * 1e-9, (node.cpu_end_ns - node.cpu_begin_ns) * 1e-9,
+					(node.rss_end_kb - node.rss_begin_kb) / 1024.0,
+					node.cells_after, node.cells_after - node.cells_before,
+					node.wires_after, node.wires_after - node.wires_before,
+					2 * node.depth, "", command.c_str());
+		}
+	}
+
+	void write_json_node(FILE *f, int idx, int indent)
+	{
+		const ProfileNode &node = nodes[idx];
+		std::string pad(indent, ' ');
+
+		fprintf(f, "%s{\n", pad.c_str());
+		fprintf(f, "%s  \"command\": %s,\n", pad.c_str(), json_string(node.command).c_str());
+		fprintf(f, "%s  \"begin_ns\": %" PRId64 ",\n", pad.c_str(), node.begin_ns);
+		fprintf(f, "%s  \"wall_ns\": %" PRId64 ",\n", pad.c_str(), node.end_ns - node.begin_ns);
+		fprintf(f, "%s  \"cpu_ns\": %" PRId64 ",\n", pad.c_str(), node.cpu_end_ns - node.cpu_begin_ns);
+		fprintf(f, "%s  \"peak_rss_kb\": %" PRId64 ",\n", pad.c_str(), node.rss_end_kb);
+		fprintf(f, "%s  \"peak_rss_delta_kb\": %" PRId64 ",\n", pad.c_str(), node.rss_end_kb - node.rss_begin_kb);
+		fprintf(f, "%s  \"cells_before\": %d,\n", pad.c_str(), node.cells_before);
+		fprintf(f, "%s  \"cells_after\": %d,\n", pad.c_str(), node.cells_after);
+		fprintf(f, "%s  \"wires_before\": %d,\n", pad.c_str(), node.wires_before);
+		fprintf(f, "%s  \"wires_after\": %d,\n", pad.c_str(), node.wires_after);
+		fprintf(f, "%s  \"children\": [", pad.c_str());
+		for (int i = 0; i < GetSize(node.children); i++) {
+			fprintf(f, "%s\n", i ? "," : "");
+			write_json_node(f, node.children[i], indent + 4);
+		}
+		fprintf(f, "%s]\n", node.children.empty() ? "" : ("\n" + pad + "  ").c_str());
+		fprintf(f, "%s}", pad.c_str());
+	}
+
+	void write_json(FILE *f)
+	{
+		fprintf(f, "{\n");
+		fprintf(f, "  \"generator\": %s,\n", json_string(yosys_version_str).c_str());
+		fprintf(f, "  \"profile\": [");
+		bool first = true;
+		for (int i = 0; i < GetSize(nodes); i++) {
+			if (nodes[i].parent >= 0)
+				continue;
+			fprintf(f, "%s\n", first ? "" : ",");
+			write_json_node(f, i, 4);
+			first = false;
+		}
+		fprintf(f, "\n  ]\n}\n");
+	}
+
+	// Chrome trace event format, as understood by chrome://tracing and
+	// https://ui.perfetto.dev. Nesting follows from the "X" event times.
+	void write_trace(FILE *f)
+	{
+		fprintf(f, "{\n");
+		fprintf(f, "  \"displayTimeUnit\": \"ms\",\n");
+		fprintf(f, "  \"otherData\": { \"generator\": %s },\n", json_string(yosys_version_str).c_str());
+		fprintf(f, "  \"traceEvents\": [");
+		for (int i = 0; i < GetSize(nodes); i++) {
+			const ProfileNode &node = nodes[i];
+			std::string name = node.command.substr(0, node.command.find(' '));
+			fprintf(f, "%s\n    { \"name\": %s, \"cat\": \"pass\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, "
+					"\"ts\": %.3f, \"dur\": %.3f, \"args\": { \"command\": %s, \"cpu_ms\": %.3f, "
+					"\"peak_rss_delta_kb\": %" PRId64 ", \"cells_before\": %d, \"cells_after\": %d, "
+					"\"wires_before\": %d, \"wires_after\": %d } }",
+					i ? "," : "", json_string(name).c_str(), node.begin_ns * 1e-3, (node.end_ns - node.begin_ns) * 1e-3,
+					json_string(node.command).c_str(), (node.cpu_end_ns - node.cpu_begin_ns) * 1e-6,
+					node.rss_end_kb - node.rss_begin_kb, node.cells_before, node.cells_after,
+					node.wires_before, node.wires_after);
+		}
+		fprintf(f, "\n  ]\n}\n");
+	}
+};
+
+static FILE *open_output(const std::string &filename)
+{
+	FILE *f = fopen(filename.c_str(), "w");
+	if (f == nullptr)
+		log_error("Can't open file `%s' for writing: %s\n", filename.c_str(), strerror(errno));
+	yosys_output_files.insert(filename);
+	log("Writing profile to `%s'.\n", filename.c_str());
+	return f;
+}
+
+struct ProfilePass : public Pass {
+	ProfilePass() : Pass("profile", "record a profile of a command and its sub-commands") { }
+	void help() override
+	{
+		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
+		log("\n");
+		log("    profile [options] cmd\n");
+		log("\n");
+		log("Execute the specified command and record the tree of all commands it runs,\n");
+		log("including the nested calls made by script commands such as 'synth' (e.g.\n");
+		log("synth -> opt -> opt_expr). For each of them the following is recorded:\n");
+		log("\n");
+		log("  - wall time\n");
+		log("  - CPU time, including child processes such as ABC\n");
+		log("  - increase of the peak resident set size of the yosys process\n");
+		log("  - number of cells and wires in the design before and after the command\n");
+		log("\n");
+		log("The profile is printed to the log as an indented tree.\n");
+		log("\n");
+		log("    -json <filename>\n");
+		log("        write the call tree in JSON format to the specified file\n");
+		log("\n");
+		log("    -trace <filename>\n");
+		log("        write the profile in Chrome trace event format to the specified\n");
+		log("        file, which can be viewed with chrome://tracing or Perfetto\n");
+		log("\n");
+		log("    -depth <N>\n");
+		log("        only print commands up to the given nesting depth to the log (the\n");
+		log("        command itself has depth 0). the output files are not affected.\n");
+		log("\n");
+		log("    -q\n");
+		log("        do not print the profile to the log\n");
+		log("\n");
+	}
+	void execute(std::vector<std::string> args, RTLIL::Design *design) override
+	{
+		std::string json_file, trace_file;
+		int max_depth = -1;
+		bool quiet = false;
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++)
+		{
+			if (args[argidx] == "-json" && argidx+1 < args.size()) {
+				json_file = args[++argidx];
+				continue;
+			}
+			if (args[argidx] == "-trace" && argidx+1 < args.size()) {
+				trace_file = args[++argidx];
+				continue;
+			}
+			if (args[argidx] == "-depth" && argidx+1 < args.size()) {
+				max_depth = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-q") {
+				quiet = true;
+				continue;
+			}
+			break;
+		}
+
+		if (argidx == args.size())
+			log_cmd_error("Missing command to profile.\n");
+		if (pass_profiler != nullptr)
+			log_cmd_error("The profile command cannot be nested.\n");
+
+		Profiler profiler;
+		pass_profiler = &profiler;
+
+		try {
+			std::vector<std::string> new_args(args.begin() + argidx, args.end());
+			Pass::call(design, new_args);
+		} catch (...) {
+			pass_profiler = nullptr;
+			throw;
+		}
+
+		pass_profiler = nullptr;
+
+		log_header(design, "Profile of `%s'.\n", Profiler::join(std::vector<std::string>(args.begin() + argidx, args.end())).c_str());
+
+		if (!quiet)
+			profiler.log_report(max_depth);
+
+		if (!json_file.empty()) {
+			FILE *f = open_output(json_file);
+			profiler.write_json(f);
+			fclose(f);
+		}
+
+		if (!trace_file.empty()) {
+			FILE *f = open_output(trace_file);
+			profiler.write_trace(f);
+			fclose(f);
+		}
+	}
+} ProfilePass;
+
+PRIVATE_NAMESPACE_END
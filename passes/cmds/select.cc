@@ -28,6 +28,15 @@ PRIVATE_NAMESPACE_BEGIN
 
 using RTLIL::id2cstr;
 
+// select, cd and ls only read the design. They look up modules without the
+// non-const Design accessors, which would copy modules that are shared with
+// saved designs (see Design::add_shared()).
+static RTLIL::Module *read_module(const RTLIL::Design *design, const RTLIL::IdString &name)
+{
+	auto it = design->modules_.find(name);
+	return it != design->modules_.end() ? it->second : nullptr;
+}
+
 static std::vector<RTLIL::Selection> work_stack;
 
 static bool match_ids(RTLIL::IdString id, const std::string &pattern)
@@ -157,7 +166,7 @@ static void select_op_neg(RTLIL::Design *design, RTLIL::Selection &lhs)
 
 	RTLIL::Selection new_sel(false);
 
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (lhs.selected_whole_module(mod->name))
 			continue;
@@ -196,7 +205,7 @@ static void select_op_random(RTLIL::Design *design, RTLIL::Selection &lhs, int c
 {
 	vector<pair<IdString, IdString>> objects;
 
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (!lhs.selected_module(mod->name))
 			continue;
@@ -227,13 +236,13 @@ static void select_op_random(RTLIL::Design *design, RTLIL::Selection &lhs, int c
 
 static void select_op_submod(RTLIL::Design *design, RTLIL::Selection &lhs)
 {
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (lhs.selected_whole_module(mod->name))
 		{
 			for (auto cell : mod->cells())
 			{
-				if (design->module(cell->type) == nullptr)
+				if (read_module(design, cell->type) == nullptr)
 					continue;
 				lhs.selected_modules.insert(cell->type);
 			}
@@ -244,10 +253,10 @@ static void select_op_submod(RTLIL::Design *design, RTLIL::Selection &lhs)
 static void select_op_cells_to_modules(RTLIL::Design *design, RTLIL::Selection &lhs)
 {
 	RTLIL::Selection new_sel(false);
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 		if (lhs.selected_module(mod->name))
 			for (auto cell : mod->cells())
-				if (lhs.selected_member(mod->name, cell->name) && (design->module(cell->type) != nullptr))
+				if (lhs.selected_member(mod->name, cell->name) && (read_module(design, cell->type) != nullptr))
 					new_sel.selected_modules.insert(cell->type);
 	lhs = new_sel;
 }
@@ -255,9 +264,9 @@ static void select_op_cells_to_modules(RTLIL::Design *design, RTLIL::Selection &
 static void select_op_module_to_cells(RTLIL::Design *design, RTLIL::Selection &lhs)
 {
 	RTLIL::Selection new_sel(false);
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 		for (auto cell : mod->cells())
-			if ((design->module(cell->type) != nullptr) && lhs.selected_whole_module(cell->type))
+			if ((read_module(design, cell->type) != nullptr) && lhs.selected_whole_module(cell->type))
 				new_sel.selected_members[mod->name].insert(cell->name);
 	lhs = new_sel;
 }
@@ -272,7 +281,7 @@ static void select_op_fullmod(RTLIL::Design *design, RTLIL::Selection &lhs)
 
 static void select_op_alias(RTLIL::Design *design, RTLIL::Selection &lhs)
 {
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (lhs.selected_whole_module(mod->name))
 			continue;
@@ -327,7 +336,7 @@ static void select_op_diff(RTLIL::Design *design, RTLIL::Selection &lhs, const R
 		if (!rhs.full_selection && rhs.selected_modules.size() == 0 && rhs.selected_members.size() == 0)
 			return;
 		lhs.full_selection = false;
-		for (auto mod : design->modules())
+		for (auto mod : design->modules_readonly())
 			lhs.selected_modules.insert(mod->name);
 	}
 
@@ -338,10 +347,10 @@ static void select_op_diff(RTLIL::Design *design, RTLIL::Selection &lhs, const R
 
 	for (auto &it : rhs.selected_members)
 	{
-		if (design->module(it.first) == nullptr)
+		if (read_module(design, it.first) == nullptr)
 			continue;
 
-		RTLIL::Module *mod = design->module(it.first);
+		RTLIL::Module *mod = read_module(design, it.first);
 
 		if (lhs.selected_modules.count(mod->name) > 0)
 		{
@@ -371,7 +380,7 @@ static void select_op_intersect(RTLIL::Design *design, RTLIL::Selection &lhs, co
 
 	if (lhs.full_selection) {
 		lhs.full_selection = false;
-		for (auto mod : design->modules())
+		for (auto mod : design->modules_readonly())
 			lhs.selected_modules.insert(mod->name);
 	}
 
@@ -435,7 +444,7 @@ static int select_op_expand(RTLIL::Design *design, RTLIL::Selection &lhs, std::v
 {
 	int sel_objects = 0;
 	bool is_input, is_output;
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (lhs.selected_whole_module(mod->name) || !lhs.selected_module(mod->name))
 			continue;
@@ -805,7 +814,7 @@ static void select_stmt(RTLIL::Design *design, std::string arg, bool disable_emp
 	}
 
 	sel.full_selection = false;
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (!select_blackboxes && mod->get_blackbox_attribute())
 			continue;
@@ -947,7 +956,7 @@ static void select_stmt(RTLIL::Design *design, std::string arg, bool disable_emp
 static std::string describe_selection_for_assert(RTLIL::Design *design, RTLIL::Selection *sel, bool whole_modules = false)
 {
 	std::string desc = "Selection contains:\n";
-	for (auto mod : design->modules())
+	for (auto mod : design->modules_readonly())
 	{
 		if (sel->selected_module(mod->name)) {
 			if (whole_modules && sel->selected_whole_module(mod->name))
@@ -1329,7 +1338,7 @@ struct SelectPass : public Pass {
 			}
 			if (arg == "-module" && argidx+1 < args.size()) {
 				RTLIL::IdString mod_name = RTLIL::escape_id(args[++argidx]);
-				if (design->module(mod_name) == nullptr)
+				if (read_module(design, mod_name) == nullptr)
 					log_cmd_error("No such module: %s\n", id2cstr(mod_name));
 				design->selected_active_module = mod_name.str();
 				got_module = true;
@@ -1436,7 +1445,7 @@ struct SelectPass : public Pass {
 			if (work_stack.size() > 0)
 				sel = &work_stack.back();
 			sel->optimize(design);
-			for (auto mod : design->modules())
+			for (auto mod : design->modules_readonly())
 			{
 				if (sel->selected_whole_module(mod->name) && list_mode)
 					log("%s\n", id2cstr(mod->name));
@@ -1521,7 +1530,7 @@ struct SelectPass : public Pass {
 				log_cmd_error("No selection to check.\n");
 			RTLIL::Selection *sel = &work_stack.back();
 			sel->optimize(design);
-			for (auto mod : design->modules())
+			for (auto mod : design->modules_readonly())
 				if (sel->selected_module(mod->name)) {
 					for (auto wire : mod->wires())
 						if (sel->selected_member(mod->name, wire->name))
@@ -1644,7 +1653,7 @@ struct CdPass : public Pass {
 					break;
 
 				modname = modname.substr(0, pos);
-				Module *mod = design->module(modname);
+				Module *mod = read_module(design, modname);
 
 				if (mod == nullptr)
 					continue;
@@ -1661,13 +1670,13 @@ struct CdPass : public Pass {
 
 		std::string modname = RTLIL::escape_id(args[1]);
 
-		if (design->module(modname) == nullptr && !design->selected_active_module.empty()) {
-			RTLIL::Module *module = design->module(design->selected_active_module);
+		if (read_module(design, modname) == nullptr && !design->selected_active_module.empty()) {
+			RTLIL::Module *module = read_module(design, design->selected_active_module);
 			if (module != nullptr && module->cell(modname) != nullptr)
 				modname = module->cell(modname)->type.str();
 		}
 
-		if (design->module(modname) != nullptr) {
+		if (read_module(design, modname) != nullptr) {
 			design->selected_active_module = modname;
 			design->selection_stack.back() = RTLIL::Selection();
 			select_filter_active_mod(design, design->selection_stack.back());
@@ -1718,20 +1727,21 @@ struct LsPass : public Pass {
 		{
 			std::vector<IdString> matches;
 
-			for (auto mod : design->selected_modules())
-				matches.push_back(mod->name);
+			for (auto mod : design->modules_readonly())
+				if (design->selected_module(mod->name) && !mod->get_blackbox_attribute())
+					matches.push_back(mod->name);
 
 			if (!matches.empty()) {
 				log("\n%d %s:\n", int(matches.size()), "modules");
 				std::sort(matches.begin(), matches.end(), RTLIL::sort_by_id_str());
 				for (auto id : matches)
-					log("  %s%s\n", log_id(id), design->selected_whole_module(design->module(id)) ? "" : "*");
+					log("  %s%s\n", log_id(id), design->selected_whole_module(read_module(design, id)) ? "" : "*");
 			}
 		}
 		else
-		if (design->module(design->selected_active_module) != nullptr)
+		if (read_module(design, design->selected_active_module) != nullptr)
 		{
-			RTLIL::Module *module = design->module(design->selected_active_module);
+			RTLIL::Module *module = read_module(design, design->selected_active_module);
 			log_matches("wires", module, module->wires_);
 			log_matches("memories", module, module->memories);
 			log_matches("cells", module, module->cells_);
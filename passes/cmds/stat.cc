@@ -322,6 +322,28 @@ statdata_t hierarchy_worker(std::map<RTLIL::IdString, statdata_t> &mod_stat, RTL
 	return mod_data;
 }
 
+void log_mem_data(RTLIL::Module *mod)
+{
+	int num_objects = mod->cell_arena_.num_objects() + mod->wire_arena_.num_objects();
+	int num_slabs = mod->cell_arena_.num_slabs() + mod->wire_arena_.num_slabs();
+	size_t slab_bytes = mod->cell_arena_.slab_bytes() + mod->wire_arena_.slab_bytes();
+	size_t object_bytes = mod->cell_arena_.num_objects() * sizeof(RTLIL::Cell) + mod->wire_arena_.num_objects() * sizeof(RTLIL::Wire);
+
+	// a non-empty hashlib dict has one allocation each for its entries and its hashtable
+	int num_dict_allocs = 0;
+	for (auto cell : mod->cells())
+		num_dict_allocs += 2 * (!cell->parameters.empty() + !cell->attributes.empty() + !cell->connections().empty());
+	for (auto wire : mod->wires())
+		num_dict_allocs += 2 * !wire->attributes.empty();
+
+	log("\n");
+	log("   Cell and wire objects:       %6d\n", num_objects);
+	log("   Heap allocations (arena):    %6d\n", num_slabs);
+	log("   Heap allocations (no arena): %6d\n", num_objects);
+	log("   Arena memory:                %6zu kB (%zu kB in use)\n", slab_bytes / 1024, object_bytes / 1024);
+	log("   Cell/wire dict allocations:  %6d\n", num_dict_allocs);
+}
+
 void read_liberty_cellarea(dict<IdString, double> &cell_area, string liberty_file)
 {
 	std::ifstream f;
@@ -370,6 +392,12 @@ struct StatPass : public Pass {
 		log("        annotate internal cell types with their word width.\n");
 		log("        e.g. $add_8 for an 8 bit wide $add cell.\n");
 		log("\n");
+		log("    -mem\n");
+		log("        also print the number of heap allocations used for the cells and wires\n");
+		log("        of each module, with the per-module arena and as it would be with one\n");
+		log("        allocation per object, and the allocations of their attribute,\n");
+		log("        parameter and connection dicts. Always covers the whole module.\n");
+		log("\n");
 		log("    -json\n");
 		log("        output the statistics in a machine-readable JSON format.\n");
 		log("        this is output to the console; use \"tee\" to output to a file.\n");
@@ -377,8 +405,8 @@ struct StatPass : public Pass {
 	}
 	void execute(std::vector<std::string> args, RTLIL::Design *design) override
 	{
-		bool width_mode = false, json_mode = false;
-		RTLIL::Module *top_mod = nullptr;
+		bool width_mode = false, json_mode = false, mem_mode = false;
+		const RTLIL::Module *top_mod = nullptr;
 		std::map<RTLIL::IdString, statdata_t> mod_stat;
 		dict<IdString, double> cell_area;
 		string techname;
@@ -401,9 +429,13 @@ struct StatPass : public Pass {
 				continue;
 			}
 			if (args[argidx] == "-top" && argidx+1 < args.size()) {
-				if (design->module(RTLIL::escape_id(args[argidx+1])) == nullptr)
-					log_cmd_error("Can't find module %s.\n", args[argidx+1].c_str());
-				top_mod = design->module(RTLIL::escape_id(args[++argidx]));
+				top_mod = static_cast<const RTLIL::Design*>(design)->module(RTLIL::escape_id(args[++argidx]));
+				if (top_mod == nullptr)
+					log_cmd_error("Can't find module %s.\n", args[argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-mem") {
+				mem_mode = true;
 				continue;
 			}
 			if (args[argidx] == "-json") {
@@ -430,7 +462,7 @@ struct StatPass : public Pass {
 		}
 
 		bool first_module = true;
-		for (auto mod : design->selected_modules())
+		for (auto mod : design->selected_modules_readonly())
 		{
 			if (!top_mod && design->full_selection())
 				if (mod->get_bool_attribute(ID::top))
@@ -447,6 +479,8 @@ struct StatPass : public Pass {
 				log("=== %s%s ===\n", log_id(mod->name), design->selected_whole_module(mod->name) ? "" : " (partially selected)");
 				log("\n");
 				data.log_data(mod->name, false);
+				if (mem_mode)
+					log_mem_data(mod);
 			}
 		}
 
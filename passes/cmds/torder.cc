@@ -20,6 +20,7 @@
 #include "kernel/yosys.h"
 #include "kernel/celltypes.h"
 #include "kernel/sigtools.h"
+#include "kernel/modtools.h"
 #include "kernel/utils.h"
 
 USING_YOSYS_NAMESPACE
@@ -70,39 +71,41 @@ struct TorderPass : public Pass {
 		{
 			log("module %s\n", log_id(module));
 
-			SigMap sigmap(module);
-			dict<SigBit, pool<IdString>> bit_drivers, bit_users;
+			ModGraph graph(module, module->selected_cells());
 			TopoSort<IdString, RTLIL::sort_by_id_str> toposort;
 
-			for (auto cell : module->selected_cells())
-			for (auto conn : cell->connections())
-			{
-				if (stop_db.count(cell->type) && stop_db.at(cell->type).count(conn.first))
-					continue;
-
+			auto stopped = [&](Cell *cell, IdString port) {
+				if (stop_db.count(cell->type) && stop_db.at(cell->type).count(port))
+					return true;
 				if (!noautostop && yosys_celltypes.cell_known(cell->type)) {
-					if (conn.first.in(ID::Q, ID::CTRL_OUT, ID::RD_DATA))
-						continue;
-					if (cell->type.in(ID($memrd), ID($memrd_v2)) && conn.first == ID::DATA)
-						continue;
+					if (port.in(ID::Q, ID::CTRL_OUT, ID::RD_DATA))
+						return true;
+					if (cell->type.in(ID($memrd), ID($memrd_v2)) && port == ID::DATA)
+						return true;
 				}
-
-				if (cell->input(conn.first))
-					for (auto bit : sigmap(conn.second))
-						bit_users[bit].insert(cell->name);
-
-				if (cell->output(conn.first))
-					for (auto bit : sigmap(conn.second))
-						bit_drivers[bit].insert(cell->name);
-
-				toposort.node(cell->name);
+				return false;
+			};
+
+			for (int c = 0; c < graph.num_cells(); c++) {
+				Cell *cell = graph.cell(c);
+				for (auto &conn : cell->connections())
+					if (!stopped(cell, conn.first)) {
+						toposort.node(cell->name);
+						break;
+					}
 			}
 
-			for (auto &it : bit_users)
-				if (bit_drivers.count(it.first))
-					for (auto driver_cell : bit_drivers.at(it.first))
-					for (auto user_cell : it.second)
-						toposort.edge(driver_cell, user_cell);
+			for (int bit = 0; bit < graph.num_bits(); bit++)
+				for (auto &driver : graph.drivers(bit)) {
+					Cell *driver_cell = graph.cell(driver);
+					if (stopped(driver_cell, graph.port(driver)))
+						continue;
+					for (auto &user : graph.consumers(bit)) {
+						Cell *user_cell = graph.cell(user);
+						if (!stopped(user_cell, graph.port(user)))
+							toposort.edge(driver_cell->name, user_cell->name);
+					}
+				}
 
 			toposort.analyze_loops = true;
 			toposort.sort();
@@ -19,6 +19,8 @@
  */
 
 #include "kernel/yosys.h"
+#include "kernel/threading.h"
+#include "frontends/ast/ast.h"
 #include "frontends/verific/verific.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -28,6 +30,12 @@
 #  include <unistd.h>
 #endif
 
+#if !defined(_WIN32) && !defined(__wasm) && !defined(YOSYS_DISABLE_SPAWN)
+#  define HIERARCHY_FORK
+#  include <fcntl.h>
+#  include <sys/wait.h>
+#endif
+
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
@@ -599,6 +607,90 @@ bool expand_module(RTLIL::Design *design, RTLIL::Module *module, bool flag_check
 	return did_something;
 }
 
+// Derive the AST modules that the cells of the given modules still need in up
+// to num_jobs worker processes. Each worker derives one module from a copy of
+// the current design and stores it in the derive cache, from where
+// expand_module() loads it afterwards, in the usual order. The cache entry
+// includes the messages and warnings of the elaboration, which are printed
+// when the module is loaded. Workers only communicate through the cache, so
+// failed or uncacheable derivations simply happen again in expand_module(),
+// which also reports any errors.
+void prederive_modules(RTLIL::Design *design, const std::set<RTLIL::Module*, IdString::compare_ptr_by_name<Module>> &used_modules, int num_jobs)
+{
+	std::vector<std::pair<RTLIL::Module*, dict<RTLIL::IdString, RTLIL::Const>>> pending;
+	pool<std::pair<RTLIL::IdString, dict<RTLIL::IdString, RTLIL::Const>>> seen;
+
+	for (auto module : used_modules)
+	for (auto cell : module->cells())
+	{
+		if (cell->type.begins_with("$array:"))
+			continue;
+		RTLIL::Module *mod = design->module(cell->type);
+		if (mod == nullptr)
+			mod = design->module("$abstract" + cell->type.str());
+		else if (cell->parameters.empty())
+			continue;
+		if (mod == nullptr || dynamic_cast<AST::AstModule*>(mod) == nullptr || mod->get_blackbox_attribute())
+			continue;
+		if (seen.insert(std::make_pair(mod->name, cell->parameters)).second)
+			pending.emplace_back(mod, cell->parameters);
+	}
+
+	if (pending.empty())
+		return;
+
+#ifdef HIERARCHY_FORK
+	log("Deriving %d module%s in up to %d worker processes.\n", GetSize(pending), GetSize(pending) == 1 ? "" : "s", num_jobs);
+
+	fflush(stdout);
+	fflush(stderr);
+	for (auto f : log_files)
+		fflush(f);
+	for (auto s : log_streams)
+		s->flush();
+
+	int next = 0, running = 0, failed = 0;
+	while (next < GetSize(pending) || running > 0)
+	{
+		if (next < GetSize(pending) && running < num_jobs) {
+			pid_t pid = fork();
+			if (pid == 0) {
+				int null_fd = open("/dev/null", O_WRONLY);
+				dup2(null_fd, 1);
+				dup2(null_fd, 2);
+				log_files.clear();
+				log_streams.clear();
+				log_errfile = nullptr;
+				log_error_atexit = nullptr;
+				yosys_threads = 1;
+				try {
+					pending[next].first->derive(design, pending[next].second, true);
+				} catch (...) {
+					_exit(1);
+				}
+				_exit(0);
+			}
+			if (pid < 0)
+				log_error("Can't fork worker process: %s\n", strerror(errno));
+			next++, running++;
+			continue;
+		}
+
+		int status;
+		if (wait(&status) < 0)
+			log_error("Can't wait for worker process: %s\n", strerror(errno));
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			failed++;
+		running--;
+	}
+
+	if (failed > 0)
+		log("%d worker process%s failed, deriving these modules again.\n", failed, failed == 1 ? "" : "es");
+#else
+	log("Worker processes are not supported on this platform, deriving modules serially.\n");
+#endif
+}
+
 void hierarchy_worker(RTLIL::Design *design, std::set<RTLIL::Module*, IdString::compare_ptr_by_name<Module>> &used, RTLIL::Module *mod, int indent)
 {
 	if (used.count(mod) > 0)
@@ -750,6 +842,27 @@ struct HierarchyPass : public Pass {
 		log("        for unknown modules and automatically run read_verilog for each\n");
 		log("        unknown module.\n");
 		log("\n");
+		log("    -derive_cache <directory>\n");
+		log("        store modules derived from Verilog modules with new parameter values\n");
+		log("        in the specified directory, and load them from there instead of\n");
+		log("        elaborating them again in later runs. This sets the scratchpad\n");
+		log("        variable 'ast.derive_cache' of the design, so later derivations use\n");
+		log("        the cache too. Modules that read files during elaboration\n");
+		log("        ($readmemh/$readmemb), use DPI functions, or depend on the ports or\n");
+		log("        parameters of the modules they instantiate are not cached.\n");
+		log("        The messages and warnings of the elaboration are stored with each\n");
+		log("        module and repeated when it is loaded from the cache.\n");
+		log("\n");
+		log("    -j <N>\n");
+		log("        before expanding the modules of each level of the hierarchy, derive\n");
+		log("        all parametric Verilog modules they need in up to <N> worker\n");
+		log("        processes. The results are passed on through the derive cache (see\n");
+		log("        -derive_cache, a temporary directory is used if it is not set) and\n");
+		log("        added to the design in the usual order, together with the messages\n");
+		log("        and warnings of their elaboration. with <N> = 0 the number of\n");
+		log("        hardware threads is used. with <N> = 1 the modules are derived in\n");
+		log("        the Yosys process, as without -j.\n");
+		log("\n");
 		log("    -keep_positionals\n");
 		log("        per default this pass also converts positional arguments in cells\n");
 		log("        to arguments using port names. This option disables this behavior.\n");
@@ -812,6 +925,7 @@ struct HierarchyPass : public Pass {
 		RTLIL::Module *top_mod = NULL;
 		std::string load_top_mod;
 		std::vector<std::string> libdirs;
+		int num_jobs = -1;
 
 		bool auto_top_mode = false;
 		bool generate_mode = false;
@@ -901,6 +1015,14 @@ struct HierarchyPass : public Pass {
 				libdirs.push_back(args[++argidx]);
 				continue;
 			}
+			if (args[argidx] == "-j" && argidx+1 < args.size()) {
+				num_jobs = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-derive_cache" && argidx+1 < args.size()) {
+				design->scratchpad_set_string("ast.derive_cache", args[++argidx]);
+				continue;
+			}
 			if (args[argidx] == "-top") {
 				if (++argidx >= args.size())
 					log_cmd_error("Option -top requires an additional argument!\n");
@@ -925,6 +1047,13 @@ struct HierarchyPass : public Pass {
 		}
 		extra_args(args, argidx, design, false);
 
+		if (num_jobs == 0)
+			num_jobs = hardware_threads();
+
+		// a single worker process would only add the cost of forking
+		if (num_jobs == 1)
+			num_jobs = -1;
+
 		if (!load_top_mod.empty())
 		{
 			IdString top_name = RTLIL::escape_id(load_top_mod);
@@ -1033,6 +1162,25 @@ struct HierarchyPass : public Pass {
 					mod->attributes.erase(ID::initial_top);
 		}
 
+		// worker processes pass their results on through the derive cache,
+		// a temporary one is removed again also when an error is thrown
+		struct TmpCacheGuard {
+			RTLIL::Design *design;
+			std::string dir;
+			~TmpCacheGuard() {
+				if (!dir.empty()) {
+					design->scratchpad_unset("ast.derive_cache");
+					design->scratchpad_unset("ast.derive_cache_tmp");
+					remove_directory(dir);
+				}
+			}
+		} tmp_cache{design, std::string()};
+		if (num_jobs >= 1 && design->scratchpad_get_string("ast.derive_cache").empty()) {
+			tmp_cache.dir = make_temp_dir(get_base_tmpdir() + "/yosys-derive-XXXXXX");
+			design->scratchpad_set_string("ast.derive_cache", tmp_cache.dir);
+			design->scratchpad_set_bool("ast.derive_cache_tmp", true);
+		}
+
 		bool did_something = true;
 		while (did_something)
 		{
@@ -1047,6 +1195,9 @@ struct HierarchyPass : public Pass {
 					used_modules.insert(mod);
 			}
 
+			if (num_jobs >= 1)
+				prederive_modules(design, used_modules, num_jobs);
+
 			for (auto module : used_modules) {
 				if (expand_module(design, module, flag_check, flag_simcheck, flag_smtcheck, libdirs))
 					did_something = true;
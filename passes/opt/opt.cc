@@ -18,6 +18,7 @@
  */
 
 #include "kernel/register.h"
+#include "kernel/sigtools.h"
 #include "kernel/log.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -25,6 +26,190 @@
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
+// Records the nets changed by the opt_* passes, so that "opt -incremental"
+// only needs to revisit the cells on them in the next iteration. Bits are
+// recorded by wire name, as the passes may delete the wires in the meantime.
+struct OptChangeMonitor : public RTLIL::Monitor
+{
+	typedef std::pair<RTLIL::IdString, int> bit_t;
+
+	struct ModuleChanges
+	{
+		bool all = false;
+		pool<bit_t> bits;
+		// connections dropped by new_connections(), until they are added
+		// back by connect()
+		dict<std::string, std::pair<int, std::vector<bit_t>>> dropped;
+	};
+
+	RTLIL::Design *design;
+	dict<RTLIL::IdString, ModuleChanges> changes;
+	ys_mutex mutex;
+
+	OptChangeMonitor(RTLIL::Design *design) : design(design)
+	{
+		design->monitors.insert(this);
+	}
+
+	~OptChangeMonitor()
+	{
+		design->monitors.erase(this);
+	}
+
+	static void get_bits(std::vector<bit_t> &bits, const RTLIL::SigSpec &sig)
+	{
+		for (auto &chunk : sig.chunks())
+			if (chunk.wire != nullptr)
+				for (int i = 0; i < chunk.width; i++)
+					bits.push_back(bit_t(chunk.wire->name, chunk.offset + i));
+	}
+
+	static std::string conn_key(const RTLIL::SigSig &conn)
+	{
+		std::string key;
+		for (auto sig : {&conn.first, &conn.second}) {
+			for (auto &chunk : sig->chunks())
+				if (chunk.wire != nullptr)
+					key += stringf("%d:%d:%d ", chunk.wire->name.index_, chunk.offset, chunk.width);
+				else
+					key += RTLIL::Const(chunk.data).as_string() + " ";
+			key += "=";
+		}
+		return key;
+	}
+
+	void add_sig(ModuleChanges &c, const RTLIL::SigSpec &sig)
+	{
+		std::vector<bit_t> bits;
+		get_bits(bits, sig);
+		c.bits.insert(bits.begin(), bits.end());
+	}
+
+	void notify_module_add(RTLIL::Module *module) override
+	{
+		ys_lock_guard lock(mutex);
+		changes[module->name].all = true;
+	}
+
+	void notify_connect(RTLIL::Cell *cell, const RTLIL::IdString&, const RTLIL::SigSpec &old_sig, const RTLIL::SigSpec &sig) override
+	{
+		ys_lock_guard lock(mutex);
+		ModuleChanges &c = changes[cell->module->name];
+		add_sig(c, old_sig);
+		add_sig(c, sig);
+	}
+
+	void notify_connect(RTLIL::Module *module, const RTLIL::SigSig &sigsig) override
+	{
+		ys_lock_guard lock(mutex);
+		ModuleChanges &c = changes[module->name];
+		auto it = c.dropped.find(conn_key(sigsig));
+		if (it != c.dropped.end() && it->second.first > 0) {
+			it->second.first--;
+			return;
+		}
+		add_sig(c, sigsig.first);
+		add_sig(c, sigsig.second);
+	}
+
+	void notify_connect(RTLIL::Module *module, const std::vector<RTLIL::SigSig> &new_conn) override
+	{
+		ys_lock_guard lock(mutex);
+		ModuleChanges &c = changes[module->name];
+
+		dict<std::string, int> new_keys;
+		for (auto &conn : new_conn)
+			new_keys[conn_key(conn)]++;
+
+		for (auto &conn : module->connections()) {
+			std::string key = conn_key(conn);
+			auto it = new_keys.find(key);
+			if (it != new_keys.end() && it->second > 0) {
+				it->second--;
+				continue;
+			}
+			auto &entry = c.dropped[key];
+			if (entry.first++ == 0 && entry.second.empty()) {
+				get_bits(entry.second, conn.first);
+				get_bits(entry.second, conn.second);
+			}
+		}
+
+		for (auto &conn : new_conn) {
+			auto it = new_keys.find(conn_key(conn));
+			if (it->second > 0) {
+				it->second--;
+				add_sig(c, conn.first);
+				add_sig(c, conn.second);
+			}
+		}
+	}
+
+	void notify_blackout(RTLIL::Module *module) override
+	{
+		ys_lock_guard lock(mutex);
+		changes[module->name].all = true;
+	}
+
+	// Selects the cells on the nets changed since the changes were last
+	// cleared in 'cells_sel', and the modules containing them in
+	// 'modules_sel' for the passes that only work on whole modules. Returns
+	// the number of selected cells.
+	int select_changes(RTLIL::Selection &cells_sel, RTLIL::Selection &modules_sel)
+	{
+		dict<RTLIL::IdString, ModuleChanges> last_changes;
+		last_changes.swap(changes);
+
+		cells_sel = RTLIL::Selection(false);
+		modules_sel = RTLIL::Selection(false);
+		int count = 0;
+
+		for (auto module : design->selected_modules())
+		{
+			auto it = last_changes.find(module->name);
+			if (it == last_changes.end())
+				continue;
+
+			ModuleChanges &c = it->second;
+			for (auto &dropped : c.dropped)
+				if (dropped.second.first > 0)
+					c.bits.insert(dropped.second.second.begin(), dropped.second.second.end());
+			if (!c.all && c.bits.empty())
+				continue;
+
+			if (design->selected_whole_module(module->name))
+				modules_sel.select(module);
+
+			const SigMap &sigmap = SigMap::cached(module);
+			pool<RTLIL::SigBit> nets;
+			for (auto &bit : c.bits) {
+				RTLIL::Wire *wire = module->wire(bit.first);
+				if (wire != nullptr && bit.second < wire->width)
+					nets.insert(sigmap(RTLIL::SigBit(wire, bit.second)));
+			}
+
+			for (auto cell : module->selected_cells()) {
+				bool selected = c.all;
+				for (auto &conn : cell->connections()) {
+					for (auto bit : sigmap(conn.second))
+						if (bit.wire != nullptr && nets.count(bit)) {
+							selected = true;
+							break;
+						}
+					if (selected)
+						break;
+				}
+				if (selected) {
+					cells_sel.select(module, cell);
+					count++;
+				}
+			}
+		}
+
+		return count;
+	}
+};
+
 struct OptPass : public Pass {
 	OptPass() : Pass("opt", "perform simple optimizations") { }
 	void help() override
@@ -50,6 +235,12 @@ struct OptPass : public Pass {
 		log("        opt_expr [-mux_undef] [-mux_bool] [-undriven] [-noclkinv] [-fine] [-full] [-keepdc]\n");
 		log("    while <changed design>\n");
 		log("\n");
+		log("When called with -incremental (and without -fast), the passes in the loop\n");
+		log("above only revisit the cells on nets that were changed in the previous\n");
+		log("iteration (and the modules containing them for opt_muxtree and opt_clean).\n");
+		log("Once that does not change the design anymore, the loop is run once more on\n");
+		log("the whole selection to make sure that nothing was missed.\n");
+		log("\n");
 		log("When called with -fast the following script is used instead:\n");
 		log("\n");
 		log("    do\n");
@@ -74,6 +265,7 @@ struct OptPass : public Pass {
 		bool opt_share = false;
 		bool fast_mode = false;
 		bool noff_mode = false;
+		bool incremental = false;
 
 		log_header(design, "Executing OPT pass (performing simple optimizations).\n");
 		log_push();
@@ -141,6 +333,10 @@ struct OptPass : public Pass {
 				noff_mode = true;
 				continue;
 			}
+			if (args[argidx] == "-incremental") {
+				incremental = true;
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
@@ -164,20 +360,49 @@ struct OptPass : public Pass {
 		{
 			Pass::call(design, "opt_expr" + opt_expr_args);
 			Pass::call(design, "opt_merge -nomux" + opt_merge_args);
+
+			std::unique_ptr<OptChangeMonitor> monitor;
+			if (incremental)
+				monitor.reset(new OptChangeMonitor(design));
+
+			// in incremental mode, the cells on changed nets and the modules
+			// containing them, selected for the next iteration
+			RTLIL::Selection cells_sel, modules_sel;
+			bool whole_design = true;
+
+			auto call = [&](const std::string &command, const RTLIL::Selection &sel) {
+				if (whole_design)
+					Pass::call(design, command);
+				else
+					Pass::call_on_selection(design, sel, command);
+			};
+
 			while (1) {
 				design->scratchpad_unset("opt.did_something");
-				Pass::call(design, "opt_muxtree");
-				Pass::call(design, "opt_reduce" + opt_reduce_args);
-				Pass::call(design, "opt_merge" + opt_merge_args);
+				if (monitor)
+					monitor->changes.clear();
+				call("opt_muxtree", modules_sel);
+				call("opt_reduce" + opt_reduce_args, cells_sel);
+				call("opt_merge" + opt_merge_args, cells_sel);
 				if (opt_share)
-					Pass::call(design, "opt_share");
+					call("opt_share", cells_sel);
 				if (!noff_mode)
-					Pass::call(design, "opt_dff" + opt_dff_args);
-				Pass::call(design, "opt_clean" + opt_clean_args);
-				Pass::call(design, "opt_expr" + opt_expr_args);
-				if (design->scratchpad_get_bool("opt.did_something") == false)
-					break;
-				log_header(design, "Rerunning OPT passes. (Maybe there is more to do..)\n");
+					call("opt_dff" + opt_dff_args, cells_sel);
+				call("opt_clean" + opt_clean_args, modules_sel);
+				call("opt_expr" + opt_expr_args, cells_sel);
+				if (design->scratchpad_get_bool("opt.did_something") == false) {
+					if (whole_design)
+						break;
+					whole_design = true;
+					log_header(design, "Rerunning OPT passes on the whole selection. (Checking that there is nothing left to do..)\n");
+					continue;
+				}
+				if (monitor) {
+					int count = monitor->select_changes(cells_sel, modules_sel);
+					whole_design = false;
+					log_header(design, "Rerunning OPT passes on %d changed cells. (Maybe there is more to do..)\n", count);
+				} else
+					log_header(design, "Rerunning OPT passes. (Maybe there is more to do..)\n");
 			}
 		}
 
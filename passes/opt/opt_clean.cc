@@ -22,6 +22,7 @@
 #include "kernel/log.h"
 #include "kernel/celltypes.h"
 #include "kernel/ffinit.h"
+#include "kernel/modtools.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <set>
@@ -31,47 +32,78 @@ PRIVATE_NAMESPACE_BEGIN
 
 using RTLIL::id2cstr;
 
+// Caches for each module whether it contains anything that must be kept.
+// Keep attributes can be edited from anywhere (passes, scripts, the API)
+// without any notification, so the cache only lives for a single opt_clean
+// call and is dropped by finish(). A cache kept across calls would need a
+// Monitor notification for every attribute change, which RTLIL does not have.
+//
+// setup() computes the entries for all modules up front and freezes the
+// cache, so that query() is read-only while modules are cleaned in parallel.
+// opt_clean's own changes never affect the result, since it only removes
+// cells that are not kept.
 struct keep_cache_t
 {
-	Design *design;
-	dict<Module*, bool> cache;
+	Design *design = nullptr;
+	bool frozen = false;
+	dict<const Module*, bool> cache;
 
-	void reset(Design *design = nullptr)
+	void setup(Design *design)
 	{
+		cache.clear();
 		this->design = design;
+		frozen = false;
+
+		for (auto &it : design->modules_)
+			query(it.second);
+		frozen = true;
+	}
+
+	void finish()
+	{
 		cache.clear();
+		design = nullptr;
+		frozen = false;
+	}
+
+	const Module *type_module(const Cell *cell) const
+	{
+		auto it = design->modules_.find(cell->type);
+		return it != design->modules_.end() ? it->second : nullptr;
 	}
 
-	bool query(Module *module)
+	bool query(const Module *module)
 	{
 		log_assert(design != nullptr);
 
 		if (module == nullptr)
 			return false;
 
-		if (cache.count(module))
-			return cache.at(module);
+		auto it = cache.find(module);
+		if (it != cache.end())
+			return it->second;
 
+		log_assert(!frozen);
 		cache[module] = true;
-		if (!module->get_bool_attribute(ID::keep)) {
-		    bool found_keep = false;
-		    for (auto cell : module->cells())
-			if (query(cell, true /* ignore_specify */)) {
-			    found_keep = true;
-			    break;
-			}
-		    for (auto wire : module->wires())
-			if (wire->get_bool_attribute(ID::keep)) {
-			    found_keep = true;
-			    break;
+		bool found_keep = module->get_bool_attribute(ID::keep);
+		for (auto &it : module->cells_) {
+			if (query(it.second, true /* ignore_specify */)) {
+				found_keep = true;
+				break;
 			}
-		    cache[module] = found_keep;
 		}
+		if (!found_keep)
+			for (auto &it : module->wires_)
+				if (it.second->get_bool_attribute(ID::keep)) {
+					found_keep = true;
+					break;
+				}
+		cache[module] = found_keep;
 
-		return cache[module];
+		return found_keep;
 	}
 
-	bool query(Cell *cell, bool ignore_specify = false)
+	bool query(const Cell *cell, bool ignore_specify = false)
 	{
 		if (cell->type.in(ID($assert), ID($assume), ID($live), ID($fair), ID($cover)))
 			return true;
@@ -79,30 +111,35 @@ struct keep_cache_t
 		if (!ignore_specify && cell->type.in(ID($specify2), ID($specify3), ID($specrule)))
 			return true;
 
-		if (cell->has_keep_attr())
+		if (cell->get_bool_attribute(ID::keep))
 			return true;
 
-		if (cell->module && cell->module->design)
-			return query(cell->module->design->module(cell->type));
-
-		return false;
+		return query(type_module(cell));
 	}
 };
 
 keep_cache_t keep_cache;
 CellTypes ct_reg, ct_all;
-int count_rm_cells, count_rm_wires;
+std::atomic<int> count_rm_cells, count_rm_wires;
+std::atomic<bool> opt_did_something;
 
 void rmunused_module_cells(Module *module, bool verbose)
 {
-	SigMap sigmap(module);
-	dict<IdString, pool<Cell*>> mem2cells;
+	const SigMap &sigmap = SigMap::cached(module);
+	FfInitVals ffinit(&sigmap, module);
+
+	// The mark phase works on the dense bit and cell ids of a ModGraph, with
+	// bit vectors instead of pools. Ports of cell types that ct_all does not
+	// know count as both driving and reading their signals.
+	std::vector<Cell*> cells;
+	cells.reserve(GetSize(module->cells_));
+	for (auto &it : module->cells_)
+		cells.push_back(it.second);
+	ModGraph graph(module, cells, ct_all);
+
+	dict<IdString, std::vector<int>> mem2cells;
 	pool<IdString> mem_unused;
-	pool<Cell*> queue, unused;
-	pool<SigBit> used_raw_bits;
-	dict<SigBit, pool<Cell*>> wire2driver;
 	dict<SigBit, vector<string>> driver_driver_logs;
-	FfInitVals ffinit(&sigmap, module);
 
 	SigMap raw_sigmap;
 	for (auto &it : module->connections_) {
@@ -116,85 +153,84 @@ void rmunused_module_cells(Module *module, bool verbose)
 		mem_unused.insert(it.first);
 	}
 
-	for (Cell *cell : module->cells()) {
+	for (int cell_idx = 0; cell_idx < GetSize(cells); cell_idx++) {
+		Cell *cell = cells[cell_idx];
+		if (ct_all.cell_known(cell->type))
+			for (auto &it2 : cell->connections()) {
+				if (!ct_all.cell_output(cell->type, it2.first))
+					continue;
+				for (auto raw_bit : it2.second) {
+					if (raw_bit.wire == nullptr)
+						continue;
+					auto bit = sigmap(raw_bit);
+					if (bit.wire == nullptr)
+						driver_driver_logs[raw_sigmap(raw_bit)].push_back(stringf("Driver-driver conflict "
+								"for %s between cell %s.%s and constant %s in %s: Resolved using constant.",
+								log_signal(raw_bit), log_id(cell), log_id(it2.first), log_signal(bit), log_id(module)));
+				}
+			}
 		if (cell->type.in(ID($memwr), ID($memwr_v2), ID($meminit), ID($meminit_v2))) {
 			IdString mem_id = cell->getParam(ID::MEMID).decode_string();
-			mem2cells[mem_id].insert(cell);
+			mem2cells[mem_id].push_back(cell_idx);
 		}
 	}
 
-	for (auto &it : module->cells_) {
-		Cell *cell = it.second;
-		for (auto &it2 : cell->connections()) {
-			if (ct_all.cell_known(cell->type) && !ct_all.cell_output(cell->type, it2.first))
-				continue;
-			for (auto raw_bit : it2.second) {
-				if (raw_bit.wire == nullptr)
-					continue;
-				auto bit = sigmap(raw_bit);
-				if (bit.wire == nullptr && ct_all.cell_known(cell->type))
-					driver_driver_logs[raw_sigmap(raw_bit)].push_back(stringf("Driver-driver conflict "
-							"for %s between cell %s.%s and constant %s in %s: Resolved using constant.",
-							log_signal(raw_bit), log_id(cell), log_id(it2.first), log_signal(bit), log_id(module)));
-				if (bit.wire != nullptr)
-					wire2driver[bit].insert(cell);
-			}
+	std::vector<bool> cell_used(graph.num_cells()), bit_used(graph.num_bits());
+	std::vector<int> queue;
+
+	auto mark_cell = [&](int cell_idx) {
+		if (!cell_used[cell_idx]) {
+			cell_used[cell_idx] = true;
+			queue.push_back(cell_idx);
 		}
-		if (keep_cache.query(cell))
-			queue.insert(cell);
-		else
-			unused.insert(cell);
-	}
+	};
+
+	auto mark_bit = [&](int bit_idx) {
+		if (bit_idx < 0 || bit_used[bit_idx])
+			return;
+		bit_used[bit_idx] = true;
+		for (auto &driver : graph.drivers(bit_idx))
+			mark_cell(driver.cell);
+	};
+
+	for (int i = 0; i < GetSize(cells); i++)
+		if (keep_cache.query(cells[i]))
+			mark_cell(i);
 
 	for (auto &it : module->wires_) {
 		Wire *wire = it.second;
-		if (wire->port_output || wire->get_bool_attribute(ID::keep)) {
-			for (auto bit : sigmap(wire))
-			for (auto c : wire2driver[bit])
-				queue.insert(c), unused.erase(c);
-			for (auto raw_bit : SigSpec(wire))
-				used_raw_bits.insert(raw_sigmap(raw_bit));
-		}
+		if (wire->port_output || wire->get_bool_attribute(ID::keep))
+			for (int i = 0; i < wire->width; i++)
+				mark_bit(graph.bit_id(SigBit(wire, i)));
 	}
 
 	while (!queue.empty())
 	{
-		pool<SigBit> bits;
-		pool<IdString> mems;
-		for (auto cell : queue) {
-			for (auto &it : cell->connections())
-				if (!ct_all.cell_known(cell->type) || ct_all.cell_input(cell->type, it.first))
-					for (auto bit : sigmap(it.second))
-						bits.insert(bit);
-
-			if (cell->type.in(ID($memrd), ID($memrd_v2))) {
-				IdString mem_id = cell->getParam(ID::MEMID).decode_string();
-				if (mem_unused.count(mem_id)) {
-					mem_unused.erase(mem_id);
-					mems.insert(mem_id);
-				}
-			}
-		}
-
-		queue.clear();
+		int cell_idx = queue.back();
+		Cell *cell = cells[cell_idx];
+		queue.pop_back();
 
-		for (auto bit : bits)
-		for (auto c : wire2driver[bit])
-			if (unused.count(c))
-				queue.insert(c), unused.erase(c);
+		for (int bit_idx : graph.inputs(cell_idx))
+			mark_bit(bit_idx);
 
-		for (auto mem : mems)
-		for (auto c : mem2cells[mem])
-			if (unused.count(c))
-				queue.insert(c), unused.erase(c);
+		if (cell->type.in(ID($memrd), ID($memrd_v2))) {
+			IdString mem_id = cell->getParam(ID::MEMID).decode_string();
+			if (mem_unused.erase(mem_id) && mem2cells.count(mem_id))
+				for (int i : mem2cells.at(mem_id))
+					mark_cell(i);
+		}
 	}
 
-	unused.sort(RTLIL::sort_by_name_id<RTLIL::Cell>());
+	std::vector<Cell*> unused;
+	for (int i = 0; i < GetSize(cells); i++)
+		if (!cell_used[i])
+			unused.push_back(cells[i]);
+	std::sort(unused.begin(), unused.end(), RTLIL::sort_by_name_id<RTLIL::Cell>());
 
 	for (auto cell : unused) {
 		if (verbose)
 			log_debug("  removing unused `%s' cell `%s'.\n", cell->type.c_str(), cell->name.c_str());
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		opt_did_something = true;
 		if (RTLIL::builtin_ff_cell_types().count(cell->type))
 			ffinit.remove_init(cell->getPort(ID::Q));
 		module->remove(cell);
@@ -209,6 +245,17 @@ void rmunused_module_cells(Module *module, bool verbose)
 		module->memories.erase(it);
 	}
 
+	if (driver_driver_logs.empty())
+		return;
+
+	pool<SigBit> used_raw_bits;
+	for (auto &it : module->wires_) {
+		Wire *wire = it.second;
+		if (wire->port_output || wire->get_bool_attribute(ID::keep))
+			for (auto raw_bit : SigSpec(wire))
+				used_raw_bits.insert(raw_sigmap(raw_bit));
+	}
+
 	for (auto &it : module->cells_) {
 		Cell *cell = it.second;
 		for (auto &it2 : cell->connections()) {
@@ -300,7 +347,7 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 				connected_signals.add(it2.second);
 		}
 
-	SigMap assign_map(module);
+	SigMap assign_map = SigMap::cached(module);
 	pool<RTLIL::SigSpec> direct_sigs;
 	pool<RTLIL::Wire*> direct_wires;
 	for (auto &it : module->cells_) {
@@ -324,7 +371,7 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		}
 	}
 
-	module->connections_.clear();
+	module->new_connections(std::vector<RTLIL::SigSig>());
 
 	SigPool used_signals;
 	SigPool raw_used_signals;
@@ -360,8 +407,8 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 			RTLIL::Const &val = it2->second;
 			SigSpec sig = assign_map(wire);
 			for (int i = 0; i < GetSize(val) && i < GetSize(sig); i++)
-				if (val.bits[i] != State::Sx)
-					init_bits[sig[i]] = val.bits[i];
+				if (val.bits()[i] != State::Sx)
+					init_bits[sig[i]] = val.bits()[i];
 			wire->attributes.erase(it2);
 		}
 	}
@@ -372,7 +419,7 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		for (int i = 0; i < wire->width; i++) {
 			auto it = init_bits.find(RTLIL::SigBit(wire, i));
 			if (it != init_bits.end()) {
-				val.bits[i] = it->second;
+				val.bits()[i] = it->second;
 				found = true;
 			}
 		}
@@ -390,7 +437,7 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		if (wire->attributes.count(ID::init))
 			initval = wire->attributes.at(ID::init);
 		if (GetSize(initval) != GetSize(wire))
-			initval.bits.resize(GetSize(wire), State::Sx);
+			initval.bits().resize(GetSize(wire), State::Sx);
 		if (initval.is_fully_undef())
 			wire->attributes.erase(ID::init);
 
@@ -477,7 +524,7 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		log_debug("  removed %d unused temporary wires.\n", del_temp_wires_count);
 
 	if (!del_wires_queue.empty())
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		opt_did_something = true;
 
 	return !del_wires_queue.empty();
 }
@@ -488,7 +535,7 @@ bool rmunused_module_init(RTLIL::Module *module, bool verbose)
 	CellTypes fftypes;
 	fftypes.setup_internals_mem();
 
-	SigMap sigmap(module);
+	SigMap sigmap = SigMap::cached(module);
 	dict<SigBit, State> qbits;
 
 	for (auto cell : module->cells())
@@ -558,7 +605,7 @@ bool rmunused_module_init(RTLIL::Module *module, bool verbose)
 	}
 
 	if (did_something)
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		opt_did_something = true;
 
 	return did_something;
 }
@@ -585,7 +632,7 @@ void rmunused_module(RTLIL::Module *module, bool purge_mode, bool verbose, bool
 		module->remove(cell);
 	}
 	if (!delcells.empty())
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		opt_did_something = true;
 
 	rmunused_module_cells(module, verbose);
 	while (rmunused_module_signals(module, purge_mode, verbose)) { }
@@ -595,7 +642,7 @@ void rmunused_module(RTLIL::Module *module, bool purge_mode, bool verbose, bool
 }
 
 struct OptCleanPass : public Pass {
-	OptCleanPass() : Pass("opt_clean", "remove unused cells and wires") { }
+	OptCleanPass() : Pass("opt_clean", "remove unused cells and wires") { module_local(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -630,7 +677,8 @@ struct OptCleanPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
-		keep_cache.reset(design);
+		std::vector<RTLIL::Module*> modules = design->selected_whole_modules_warn();
+		keep_cache.setup(design);
 
 		ct_reg.setup_internals_mem();
 		ct_reg.setup_internals_anyinit();
@@ -640,21 +688,23 @@ struct OptCleanPass : public Pass {
 
 		count_rm_cells = 0;
 		count_rm_wires = 0;
+		opt_did_something = false;
 
-		for (auto module : design->selected_whole_modules_warn()) {
-			if (module->has_processes_warn())
-				continue;
-			rmunused_module(module, purge_mode, true, true);
-		}
+		run_on_modules(modules, [&](RTLIL::Module *module) {
+			if (!module->has_processes_warn())
+				rmunused_module(module, purge_mode, true, true);
+		});
 
+		if (opt_did_something)
+			design->scratchpad_set_bool("opt.did_something", true);
 		if (count_rm_cells > 0 || count_rm_wires > 0)
-			log("Removed %d unused cells and %d unused wires.\n", count_rm_cells, count_rm_wires);
+			log("Removed %d unused cells and %d unused wires.\n", count_rm_cells.load(), count_rm_wires.load());
 
 		design->optimize();
 		design->sort();
 		design->check();
 
-		keep_cache.reset();
+		keep_cache.finish();
 		ct_reg.clear();
 		ct_all.clear();
 		log_pop();
@@ -662,7 +712,7 @@ struct OptCleanPass : public Pass {
 } OptCleanPass;
 
 struct CleanPass : public Pass {
-	CleanPass() : Pass("clean", "remove unused cells and wires") { }
+	CleanPass() : Pass("clean", "remove unused cells and wires") { module_local(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -692,7 +742,8 @@ struct CleanPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
-		keep_cache.reset(design);
+		std::vector<RTLIL::Module*> modules = design->selected_whole_modules();
+		keep_cache.setup(design);
 
 		ct_reg.setup_internals_mem();
 		ct_reg.setup_internals_anyinit();
@@ -702,22 +753,24 @@ struct CleanPass : public Pass {
 
 		count_rm_cells = 0;
 		count_rm_wires = 0;
+		opt_did_something = false;
 
-		for (auto module : design->selected_whole_modules()) {
-			if (module->has_processes())
-				continue;
-			rmunused_module(module, purge_mode, ys_debug(), true);
-		}
+		run_on_modules(modules, [&](RTLIL::Module *module) {
+			if (!module->has_processes())
+				rmunused_module(module, purge_mode, ys_debug(), true);
+		});
 
+		if (opt_did_something)
+			design->scratchpad_set_bool("opt.did_something", true);
 		log_suppressed();
 		if (count_rm_cells > 0 || count_rm_wires > 0)
-			log("Removed %d unused cells and %d unused wires.\n", count_rm_cells, count_rm_wires);
+			log("Removed %d unused cells and %d unused wires.\n", count_rm_cells.load(), count_rm_wires.load());
 
 		design->optimize();
 		design->sort();
 		design->check();
 
-		keep_cache.reset();
+		keep_cache.finish();
 		ct_reg.clear();
 		ct_all.clear();
 	}
@@ -29,11 +29,13 @@
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
-bool did_something;
+// thread-local, as modules may be optimized concurrently (see Pass::module_local())
+thread_local bool did_something;
 
 void replace_undriven(RTLIL::Module *module, const CellTypes &ct)
 {
-	SigMap sigmap(module);
+	// copy, the connections added below must not affect the lookups
+	SigMap sigmap = SigMap::cached(module);
 	SigPool driven_signals;
 	SigPool used_signals;
 	SigPool all_signals;
@@ -94,7 +96,7 @@ void replace_undriven(RTLIL::Module *module, const CellTypes &ct)
 
 	if (!revisit_initwires.empty())
 	{
-		SigMap sm2(module);
+		const SigMap &sm2 = SigMap::cached(module);
 
 		for (auto wire : revisit_initwires) {
 			SigSpec sig = sm2(wire);
@@ -351,21 +353,21 @@ bool is_one_or_minus_one(const Const &value, bool is_signed, bool &is_negative)
 	bool all_bits_one = true;
 	bool last_bit_one = true;
 
-	if (GetSize(value.bits) < 1)
+	if (GetSize(value) < 1)
 		return false;
 
-	if (GetSize(value.bits) == 1) {
-		if (value.bits[0] != State::S1)
+	if (GetSize(value) == 1) {
+		if (value[0] != State::S1)
 			return false;
 		if (is_signed)
 			is_negative = true;
 		return true;
 	}
 
-	for (int i = 0; i < GetSize(value.bits); i++) {
-		if (value.bits[i] != State::S1)
+	for (int i = 0; i < GetSize(value); i++) {
+		if (value[i] != State::S1)
 			all_bits_one = false;
-		if (value.bits[i] != (i ? State::S0 : State::S1))
+		if (value[i] != (i ? State::S0 : State::S1))
 			last_bit_one = false;
 	}
 
@@ -399,7 +401,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 	ct_combinational.setup_internals();
 	ct_combinational.setup_stdcells();
 
-	SigMap assign_map(module);
+	SigMap assign_map = SigMap::cached(module);
 	dict<RTLIL::SigSpec, RTLIL::SigSpec> invert_map;
 
 	TopoSort<RTLIL::Cell*, RTLIL::IdString::compare_ptr_by_name<RTLIL::Cell>> cells;
@@ -2015,7 +2017,7 @@ skip_alu_split:
 }
 
 void replace_const_connections(RTLIL::Module *module) {
-	SigMap assign_map(module);
+	const SigMap &assign_map = SigMap::cached(module);
 	for (auto cell : module->selected_cells())
 	{
 		std::vector<std::pair<RTLIL::IdString, SigSpec>> changes;
@@ -2032,7 +2034,7 @@ void replace_const_connections(RTLIL::Module *module) {
 }
 
 struct OptExprPass : public Pass {
-	OptExprPass() : Pass("opt_expr", "perform const folding and simple expression rewriting") { }
+	OptExprPass() : Pass("opt_expr", "perform const folding and simple expression rewriting") { module_local(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -2117,7 +2119,8 @@ struct OptExprPass : public Pass {
 		extra_args(args, argidx, design);
 
 		CellTypes ct(design);
-		for (auto module : design->selected_modules())
+		std::atomic<bool> any_did_something(false);
+		run_on_modules(design->selected_modules(), [&](RTLIL::Module *module)
 		{
 			log("Optimizing module %s.\n", log_id(module));
 
@@ -2125,7 +2128,7 @@ struct OptExprPass : public Pass {
 				did_something = false;
 				replace_undriven(module, ct);
 				if (did_something)
-					design->scratchpad_set_bool("opt.did_something", true);
+					any_did_something = true;
 			}
 
 			do {
@@ -2133,21 +2136,24 @@ struct OptExprPass : public Pass {
 					did_something = false;
 					replace_const_cells(design, module, false /* consume_x */, mux_undef, mux_bool, do_fine, keepdc, noclkinv);
 					if (did_something)
-						design->scratchpad_set_bool("opt.did_something", true);
+						any_did_something = true;
 				} while (did_something);
 				if (!keepdc)
 					replace_const_cells(design, module, true /* consume_x */, mux_undef, mux_bool, do_fine, keepdc, noclkinv);
 				if (did_something)
-					design->scratchpad_set_bool("opt.did_something", true);
+					any_did_something = true;
 			} while (did_something);
 
 			did_something = false;
 			replace_const_connections(module);
 			if (did_something)
-				design->scratchpad_set_bool("opt.did_something", true);
+				any_did_something = true;
 
 			log_suppressed();
-		}
+		});
+
+		if (any_did_something)
+			design->scratchpad_set_bool("opt.did_something", true);
 
 		log_pop();
 	}
@@ -87,7 +87,7 @@ struct OptMemPass : public Pass {
 				}
 				for (auto &init : mem.inits) {
 					for (int i = 0; i < GetSize(init.data); i++) {
-						State bit = init.data.bits[i];
+						State bit = init.data.bits()[i];
 						int lane = i % mem.width;
 						if (bit != State::Sx && bit != State::S0) {
 							always_0[lane] = false;
@@ -179,9 +179,9 @@ struct OptMemPass : public Pass {
 							for (auto i: swizzle) {
 								int bidx = sub * mem.width + i;
 								new_data.append(port.data[bidx]);
-								new_init.bits.push_back(port.init_value.bits[bidx]);
-								new_arst.bits.push_back(port.arst_value.bits[bidx]);
-								new_srst.bits.push_back(port.srst_value.bits[bidx]);
+								new_init.bits().push_back(port.init_value.bits()[bidx]);
+								new_arst.bits().push_back(port.arst_value.bits()[bidx]);
+								new_srst.bits().push_back(port.srst_value.bits()[bidx]);
 							}
 						}
 						port.data = new_data;
@@ -194,11 +194,11 @@ struct OptMemPass : public Pass {
 						Const new_en;
 						for (int s = 0; s < GetSize(init.data); s += mem.width) {
 							for (auto i: swizzle) {
-								new_data.bits.push_back(init.data.bits[s + i]);
+								new_data.bits().push_back(init.data.bits()[s + i]);
 							}
 						}
 						for (auto i: swizzle) {
-							new_en.bits.push_back(init.en.bits[i]);
+							new_en.bits().push_back(init.en.bits()[i]);
 						}
 						init.data = new_data;
 						init.en = new_en;
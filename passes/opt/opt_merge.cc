@@ -22,7 +22,6 @@
 #include "kernel/sigtools.h"
 #include "kernel/log.h"
 #include "kernel/celltypes.h"
-#include "libs/sha1/sha1.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <set>
@@ -35,13 +34,12 @@ struct OptMergeWorker
 {
 	RTLIL::Design *design;
 	RTLIL::Module *module;
-	SigMap assign_map;
+	const SigMap &assign_map;
 	FfInitVals initvals;
 	bool mode_share_all;
 
 	CellTypes ct;
 	int total_count;
-	SHA1 checksum;
 
 	static void sort_pmux_conn(dict<RTLIL::IdString, RTLIL::SigSpec> &conn)
 	{
@@ -66,34 +64,24 @@ struct OptMergeWorker
 		}
 	}
 
-	std::string int_to_hash_string(unsigned int v)
+	unsigned int hash_sig(unsigned int h, const RTLIL::SigSpec &sig)
 	{
-		if (v == 0)
-			return "0";
-		std::string str = "";
-		while (v > 0) {
-			str += 'a' + (v & 15);
-			v = v >> 4;
-		}
-		return str;
+		for (auto &chunk : sig.chunks())
+			for (int i = 0; i < chunk.width; i++)
+				h = mkhash(h, assign_map(RTLIL::SigBit(chunk, i)).hash());
+		return h;
 	}
 
-	std::string hash_cell_parameters_and_connections(const RTLIL::Cell *cell)
+	unsigned int hash_cell_parameters_and_connections(const RTLIL::Cell *cell)
 	{
-		vector<string> hash_conn_strings;
-		std::string hash_string = cell->type.str() + "\n";
-
 		const dict<RTLIL::IdString, RTLIL::SigSpec> *conn = &cell->connections();
 		dict<RTLIL::IdString, RTLIL::SigSpec> alt_conn;
+		bool commutative = false;
 
 		if (cell->type.in(ID($and), ID($or), ID($xor), ID($xnor), ID($add), ID($mul),
 				ID($logic_and), ID($logic_or), ID($_AND_), ID($_OR_), ID($_XOR_))) {
-			alt_conn = *conn;
-			if (assign_map(alt_conn.at(ID::A)) < assign_map(alt_conn.at(ID::B))) {
-				alt_conn[ID::A] = conn->at(ID::B);
-				alt_conn[ID::B] = conn->at(ID::A);
-			}
-			conn = &alt_conn;
+			// hashed independent of the order of A and B below
+			commutative = true;
 		} else
 		if (cell->type.in(ID($reduce_xor), ID($reduce_xnor))) {
 			alt_conn = *conn;
@@ -116,41 +104,36 @@ struct OptMergeWorker
 			conn = &alt_conn;
 		}
 
+		// Connections and parameters are summed up, so that the hash does not
+		// depend on the order in which they were added to the cell.
+		unsigned int conn_hash = 0, commutative_hash = 0;
 		for (auto &it : *conn) {
-			RTLIL::SigSpec sig;
+			unsigned int h;
 			if (cell->output(it.first)) {
 				if (it.first == ID::Q && RTLIL::builtin_ff_cell_types().count(cell->type)) {
 					// For the 'Q' output of state elements,
 					//   use its (* init *) attribute value
-					sig = initvals(it.second);
+					h = initvals(it.second).hash();
 				}
 				else
 					continue;
 			}
 			else
-				sig = assign_map(it.second);
-			string s = "C " + it.first.str() + "=";
-			for (auto &chunk : sig.chunks()) {
-				if (chunk.wire)
-					s += "{" + chunk.wire->name.str() + " " +
-							int_to_hash_string(chunk.offset) + " " +
-							int_to_hash_string(chunk.width) + "}";
-				else
-					s += RTLIL::Const(chunk.data).as_string();
-			}
-			hash_conn_strings.push_back(s + "\n");
+				h = hash_sig(mkhash_init, it.second);
+			if (commutative && (it.first == ID::A || it.first == ID::B))
+				commutative_hash += h;
+			else
+				conn_hash += mkhash(it.first.hash(), h);
 		}
 
+		unsigned int param_hash = 0;
 		for (auto &it : cell->parameters)
-			hash_conn_strings.push_back("P " + it.first.str() + "=" + it.second.as_string() + "\n");
-
-		std::sort(hash_conn_strings.begin(), hash_conn_strings.end());
-
-		for (auto it : hash_conn_strings)
-			hash_string += it;
+			param_hash += mkhash(it.first.hash(), it.second.hash());
 
-		checksum.update(hash_string);
-		return checksum.final();
+		unsigned int h = mkhash(mkhash_init, cell->type.hash());
+		h = mkhash(h, conn_hash);
+		h = mkhash(h, commutative_hash);
+		return mkhash(h, param_hash);
 	}
 
 	bool compare_cell_parameters_and_connections(const RTLIL::Cell *cell1, const RTLIL::Cell *cell2)
@@ -228,7 +211,7 @@ struct OptMergeWorker
 	}
 
 	OptMergeWorker(RTLIL::Design *design, RTLIL::Module *module, bool mode_nomux, bool mode_share_all, bool mode_keepdc) :
-		design(design), module(module), assign_map(module), mode_share_all(mode_share_all)
+		design(design), module(module), assign_map(SigMap::cached(module)), mode_share_all(mode_share_all)
 	{
 		total_count = 0;
 		ct.setup_internals();
@@ -249,8 +232,6 @@ struct OptMergeWorker
 		ct.cell_types.erase(ID($allconst));
 
 		log("Finding identical cells in module `%s'.\n", module->name.c_str());
-		assign_map.set(module);
-
 		initvals.set(&assign_map, module);
 
 		bool did_something = true;
@@ -268,43 +249,58 @@ struct OptMergeWorker
 			}
 
 			did_something = false;
-			dict<std::string, RTLIL::Cell*> sharemap;
+
+			// Cells by structural hash. Cells with the same hash that are not
+			// identical are chained through bucket_next.
+			dict<int, int> buckets;
+			std::vector<RTLIL::Cell*> bucket_cells;
+			std::vector<int> bucket_next;
+			buckets.reserve(GetSize(cells));
+			bucket_cells.reserve(GetSize(cells));
+			bucket_next.reserve(GetSize(cells));
+
 			for (auto cell : cells)
 			{
 				if ((!mode_share_all && !ct.cell_known(cell->type)) || !cell->known())
 					continue;
 
-				auto hash = hash_cell_parameters_and_connections(cell);
-				auto r = sharemap.insert(std::make_pair(hash, cell));
-				if (!r.second) {
-					if (compare_cell_parameters_and_connections(cell, r.first->second)) {
-						if (cell->has_keep_attr()) {
-							if (r.first->second->has_keep_attr())
-								continue;
-							std::swap(r.first->second, cell);
-						}
-
-
-						did_something = true;
-						log_debug("  Cell `%s' is identical to cell `%s'.\n", cell->name.c_str(), r.first->second->name.c_str());
-						for (auto &it : cell->connections()) {
-							if (cell->output(it.first)) {
-								RTLIL::SigSpec other_sig = r.first->second->getPort(it.first);
-								log_debug("    Redirecting output %s: %s = %s\n", it.first.c_str(),
-										log_signal(it.second), log_signal(other_sig));
-								Const init = initvals(other_sig);
-								initvals.remove_init(it.second);
-								initvals.remove_init(other_sig);
-								module->connect(RTLIL::SigSig(it.second, other_sig));
-								assign_map.add(it.second, other_sig);
-								initvals.set_init(other_sig, init);
-							}
-						}
-						log_debug("    Removing %s cell `%s' from module `%s'.\n", cell->type.c_str(), cell->name.c_str(), module->name.c_str());
-						module->remove(cell);
-						total_count++;
+				unsigned int hash = hash_cell_parameters_and_connections(cell);
+				auto r = buckets.insert(std::make_pair(int(hash), -1));
+				int idx = r.first->second;
+				while (idx >= 0 && !compare_cell_parameters_and_connections(cell, bucket_cells[idx]))
+					idx = bucket_next[idx];
+
+				if (idx < 0) {
+					bucket_next.push_back(r.first->second);
+					r.first->second = GetSize(bucket_cells);
+					bucket_cells.push_back(cell);
+					continue;
+				}
+
+				RTLIL::Cell *&other = bucket_cells[idx];
+				if (cell->has_keep_attr()) {
+					if (other->has_keep_attr())
+						continue;
+					std::swap(other, cell);
+				}
+
+				did_something = true;
+				log_debug("  Cell `%s' is identical to cell `%s'.\n", cell->name.c_str(), other->name.c_str());
+				for (auto &it : cell->connections()) {
+					if (cell->output(it.first)) {
+						RTLIL::SigSpec other_sig = other->getPort(it.first);
+						log_debug("    Redirecting output %s: %s = %s\n", it.first.c_str(),
+								log_signal(it.second), log_signal(other_sig));
+						Const init = initvals(other_sig);
+						initvals.remove_init(it.second);
+						initvals.remove_init(other_sig);
+						module->connect(RTLIL::SigSig(it.second, other_sig));
+						initvals.set_init(other_sig, init);
 					}
 				}
+				log_debug("    Removing %s cell `%s' from module `%s'.\n", cell->type.c_str(), cell->name.c_str(), module->name.c_str());
+				module->remove(cell);
+				total_count++;
 			}
 		}
 
@@ -313,7 +309,7 @@ struct OptMergeWorker
 };
 
 struct OptMergePass : public Pass {
-	OptMergePass() : Pass("opt_merge", "consolidate identical cells") { }
+	OptMergePass() : Pass("opt_merge", "consolidate identical cells") { module_local(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -360,15 +356,15 @@ struct OptMergePass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
-		int total_count = 0;
-		for (auto module : design->selected_modules()) {
+		std::atomic<int> total_count(0);
+		run_on_modules(design->selected_modules(), [&](RTLIL::Module *module) {
 			OptMergeWorker worker(design, module, mode_nomux, mode_share_all, mode_keepdc);
 			total_count += worker.total_count;
-		}
+		});
 
 		if (total_count)
 			design->scratchpad_set_bool("opt.did_something", true);
-		log("Removed a total of %d cells.\n", total_count);
+		log("Removed a total of %d cells.\n", total_count.load());
 	}
 } OptMergePass;
 
@@ -339,11 +339,11 @@ void xilinx_dsp_pack(xilinx_dsp_pm &pm)
 
 		if (st.overflow->type == ID($ge)) {
 			Const B = st.overflow->getPort(ID::B).as_const();
-			log_assert(std::count(B.bits.begin(), B.bits.end(), State::S1) == 1);
+			log_assert(std::count(B.bits().begin(), B.bits().end(), State::S1) == 1);
 			// Since B is an exact power of 2, subtract 1
 			//   by inverting all bits up until hitting
 			//   that one hi bit
-			for (auto &b : B.bits)
+			for (auto &b : B.bits())
 				if (b == State::S0) b = State::S1;
 				else if (b == State::S1) {
 					b = State::S0;
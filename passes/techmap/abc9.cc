@@ -26,6 +26,7 @@
 #include "kernel/celltypes.h"
 #include "kernel/rtlil.h"
 #include "kernel/log.h"
+#include "kernel/threading.h"
 
 // abc9_exe.cc
 std::string fold_abc9_cmd(std::string str);
@@ -171,6 +172,14 @@ struct Abc9Pass : public ScriptPass
 		log("    -box <file>\n");
 		log("        pass this file with box library to ABC.\n");
 		log("\n");
+		log("    -j <N>\n");
+		log("        write the XAIGER files of all selected modules first, then run up to\n");
+		log("        <N> ABC processes in parallel and re-integrate their results in module\n");
+		log("        order. the wall time of each ABC run is reported. with <N> = 0 the\n");
+		log("        number of hardware threads is used. (default: 1, which maps one\n");
+		log("        module at a time.) can also be set with the abc9.j scratchpad\n");
+		log("        variable, e.g. for synth_* passes that call abc9.\n");
+		log("\n");
 		log("Note that this is a logic optimization pass within Yosys that is calling ABC\n");
 		log("internally. This is not going to \"run ABC on your design\". It will instead run\n");
 		log("ABC on logic snippets extracted from your design. You will not get any useful\n");
@@ -188,6 +197,7 @@ struct Abc9Pass : public ScriptPass
 	bool dff_mode, cleanup;
 	bool lut_mode;
 	int maxlut;
+	int num_jobs;
 	std::string box_file;
 
 	void clear_flags() override
@@ -198,6 +208,7 @@ struct Abc9Pass : public ScriptPass
 		cleanup = true;
 		lut_mode = false;
 		maxlut = 0;
+		num_jobs = 1;
 		box_file = "";
 	}
 
@@ -209,6 +220,7 @@ struct Abc9Pass : public ScriptPass
 		// get arguments from scratchpad first, then override by command arguments
 		dff_mode = design->scratchpad_get_bool("abc9.dff", dff_mode);
 		cleanup = !design->scratchpad_get_bool("abc9.nocleanup", !cleanup);
+		num_jobs = design->scratchpad_get_int("abc9.j", num_jobs);
 
 		if (design->scratchpad_get_bool("abc9.debug")) {
 			cleanup = false;
@@ -249,6 +261,10 @@ struct Abc9Pass : public ScriptPass
 				maxlut = atoi(args[++argidx].c_str());
 				continue;
 			}
+			if (arg == "-j" && argidx+1 < args.size()) {
+				num_jobs = atoi(args[++argidx].c_str());
+				continue;
+			}
 			if (arg == "-run" && argidx+1 < args.size()) {
 				size_t pos = args[argidx+1].find(':');
 				if (pos == std::string::npos)
@@ -264,6 +280,9 @@ struct Abc9Pass : public ScriptPass
 		if (maxlut && lut_mode)
 			log_cmd_error("abc9 '-maxlut' option only applicable without '-lut' nor '-luts'.\n");
 
+		if (num_jobs <= 0)
+			num_jobs = hardware_threads();
+
 		log_assert(design);
 		if (design->selected_modules().empty()) {
 			log_warning("No modules selected for ABC9 techmapping.\n");
@@ -392,6 +411,12 @@ struct Abc9Pass : public ScriptPass
 				auto selected_modules = active_design->selected_modules();
 				active_design->selection_stack.emplace_back(false);
 
+				// with -j: modules and temp dirs of deferred ABC runs, jobs left
+				// over by an aborted call are dropped first
+				std::vector<std::pair<RTLIL::Module*, std::string>> deferred;
+				if (num_jobs > 1)
+					run_nocheck("abc9_exe -clear_deferred");
+
 				for (auto mod : selected_modules) {
 					if (mod->processes.size() > 0) {
 						log("Skipping module %s as it contains processes.\n", log_id(mod));
@@ -435,6 +460,13 @@ struct Abc9Pass : public ScriptPass
 							abc9_exe_cmd += stringf(" -box %s/input.box", tempdir_name.c_str());
 						else
 							abc9_exe_cmd += stringf(" -box %s", box_file.c_str());
+						if (num_jobs > 1) {
+							run_nocheck(abc9_exe_cmd + " -defer");
+							deferred.push_back(std::make_pair(mod, tempdir_name));
+							active_design->selection().selected_modules.clear();
+							log_pop();
+							continue;
+						}
 						run_nocheck(abc9_exe_cmd);
 						run_nocheck(stringf("read_aiger -xaiger -wideports -module_name %s$abc9 -map %s/input.sym %s/output.aig", log_id(mod), tempdir_name.c_str(), tempdir_name.c_str()));
 						run_nocheck(stringf("abc9_ops -reintegrate %s", dff_mode ? "-dff" : ""));
@@ -451,6 +483,30 @@ struct Abc9Pass : public ScriptPass
 					log_pop();
 				}
 
+				if (!deferred.empty())
+				{
+					run_nocheck(stringf("abc9_exe -run_deferred %d", num_jobs));
+
+					for (auto &it : deferred) {
+						RTLIL::Module *mod = it.first;
+						const std::string &tempdir_name = it.second;
+
+						log_push();
+						active_design->selection().select(mod);
+
+						run_nocheck(stringf("read_aiger -xaiger -wideports -module_name %s$abc9 -map %s/input.sym %s/output.aig", log_id(mod), tempdir_name.c_str(), tempdir_name.c_str()));
+						run_nocheck(stringf("abc9_ops -reintegrate %s", dff_mode ? "-dff" : ""));
+
+						if (cleanup) {
+							log("Removing temp directory.\n");
+							remove_directory(tempdir_name);
+						}
+						mod->check();
+						active_design->selection().selected_modules.clear();
+						log_pop();
+					}
+				}
+
 				active_design->selection_stack.pop_back();
 			}
 		}
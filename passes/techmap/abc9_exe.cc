@@ -24,6 +24,8 @@
 
 #include "kernel/register.h"
 #include "kernel/log.h"
+#include "kernel/threading.h"
+#include <chrono>
 
 #ifndef _WIN32
 #  include <unistd.h>
@@ -164,10 +166,102 @@ struct abc9_output_filter
 	}
 };
 
+// An ABC run that has been prepared with "abc9_exe -defer"
+struct abc9_job_t
+{
+	std::string exe_file, tempdir_name;
+	bool show_tempdir;
+	LogCapture log;
+	double seconds = 0;
+};
+
+std::vector<abc9_job_t> deferred_jobs;
+
+void abc9_run(std::string exe_file, std::string tempdir_name, bool show_tempdir)
+{
+	std::string buffer = stringf("\"%s\" -s -f %s/abc.script 2>&1", exe_file.c_str(), tempdir_name.c_str());
+	log("Running ABC command: %s\n", replace_tempdir(buffer, tempdir_name, show_tempdir).c_str());
+
+#ifndef YOSYS_LINK_ABC
+	abc9_output_filter filt(tempdir_name, show_tempdir);
+	int ret = run_command(buffer, std::bind(&abc9_output_filter::next_line, filt, std::placeholders::_1));
+#else
+	// These needs to be mutable, supposedly due to getopt
+	char *abc9_argv[5];
+	string tmp_script_name = stringf("%s/abc.script", tempdir_name.c_str());
+	abc9_argv[0] = strdup(exe_file.c_str());
+	abc9_argv[1] = strdup("-s");
+	abc9_argv[2] = strdup("-f");
+	abc9_argv[3] = strdup(tmp_script_name.c_str());
+	abc9_argv[4] = 0;
+	int ret = abc::Abc_RealMain(4, abc9_argv);
+	free(abc9_argv[0]);
+	free(abc9_argv[1]);
+	free(abc9_argv[2]);
+	free(abc9_argv[3]);
+#endif
+	if (ret != 0) {
+		if (check_file_exists(stringf("%s/output.aig", tempdir_name.c_str())))
+			log_warning("ABC: execution of command \"%s\" failed: return code %d.\n", buffer.c_str(), ret);
+		else
+			log_error("ABC: execution of command \"%s\" failed: return code %d.\n", buffer.c_str(), ret);
+	}
+}
+
+void abc9_run_deferred(RTLIL::Design *design, int num_threads)
+{
+	std::vector<abc9_job_t> jobs;
+	jobs.swap(deferred_jobs);
+
+#ifdef YOSYS_LINK_ABC
+	// the linked-in ABC is not reentrant
+	num_threads = 1;
+#endif
+	num_threads = std::max(1, std::min(num_threads, GetSize(jobs)));
+
+	log_header(design, "Executing ABC9 on %d netlists (%d at a time).\n", GetSize(jobs), num_threads);
+
+	auto task = [&](int i) {
+		abc9_job_t &job = jobs[i];
+		auto start = std::chrono::steady_clock::now();
+		{
+			LogCaptureGuard guard(&job.log);
+			try {
+				abc9_run(job.exe_file, job.tempdir_name, job.show_tempdir);
+			} catch (log_capture_error_exception&) {
+			}
+		}
+		job.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	auto start = std::chrono::steady_clock::now();
+#ifndef YOSYS_DISABLE_THREADS
+	if (num_threads > 1) {
+		ThreadPool pool(num_threads);
+		pool.run(GetSize(jobs), task);
+	} else
+#endif
+	for (int i = 0; i < GetSize(jobs); i++)
+		task(i);
+	double total_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// print the output of the jobs in the order in which they were deferred
+	double job_seconds = 0;
+	for (int i = 0; i < GetSize(jobs); i++) {
+		log("\nABC9 job %d:\n", i+1);
+		jobs[i].log.replay();
+		log("ABC9 job %d finished after %.2f seconds (wall time).\n", i+1, jobs[i].seconds);
+		job_seconds += jobs[i].seconds;
+	}
+
+	log("\nFinished %d ABC9 jobs after %.2f seconds (wall time, %.2f seconds summed over all jobs).\n",
+			GetSize(jobs), total_seconds, job_seconds);
+}
+
 void abc9_module(RTLIL::Design *design, std::string script_file, std::string exe_file,
 		vector<int> lut_costs, bool dff_mode, std::string delay_target, std::string /*lutin_shared*/, bool fast_mode,
 		bool show_tempdir, std::string box_file, std::string lut_file,
-		std::string wire_delay, std::string tempdir_name
+		std::string wire_delay, std::string tempdir_name, bool defer
 )
 {
 	std::string abc9_script;
@@ -250,12 +344,8 @@ void abc9_module(RTLIL::Design *design, std::string script_file, std::string exe
 	fprintf(f, "%s\n", abc9_script.c_str());
 	fclose(f);
 
-	std::string buffer;
-
-	log_header(design, "Executing ABC9.\n");
-
 	if (!lut_costs.empty()) {
-		buffer = stringf("%s/lutdefs.txt", tempdir_name.c_str());
+		std::string buffer = stringf("%s/lutdefs.txt", tempdir_name.c_str());
 		f = fopen(buffer.c_str(), "wt");
 		if (f == NULL)
 			log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
@@ -264,33 +354,17 @@ void abc9_module(RTLIL::Design *design, std::string script_file, std::string exe
 		fclose(f);
 	}
 
-	buffer = stringf("\"%s\" -s -f %s/abc.script 2>&1", exe_file.c_str(), tempdir_name.c_str());
-	log("Running ABC command: %s\n", replace_tempdir(buffer, tempdir_name, show_tempdir).c_str());
-
-#ifndef YOSYS_LINK_ABC
-	abc9_output_filter filt(tempdir_name, show_tempdir);
-	int ret = run_command(buffer, std::bind(&abc9_output_filter::next_line, filt, std::placeholders::_1));
-#else
-	// These needs to be mutable, supposedly due to getopt
-	char *abc9_argv[5];
-	string tmp_script_name = stringf("%s/abc.script", tempdir_name.c_str());
-	abc9_argv[0] = strdup(exe_file.c_str());
-	abc9_argv[1] = strdup("-s");
-	abc9_argv[2] = strdup("-f");
-	abc9_argv[3] = strdup(tmp_script_name.c_str());
-	abc9_argv[4] = 0;
-	int ret = abc::Abc_RealMain(4, abc9_argv);
-	free(abc9_argv[0]);
-	free(abc9_argv[1]);
-	free(abc9_argv[2]);
-	free(abc9_argv[3]);
-#endif
-	if (ret != 0) {
-		if (check_file_exists(stringf("%s/output.aig", tempdir_name.c_str())))
-			log_warning("ABC: execution of command \"%s\" failed: return code %d.\n", buffer.c_str(), ret);
-		else
-			log_error("ABC: execution of command \"%s\" failed: return code %d.\n", buffer.c_str(), ret);
+	if (defer) {
+		deferred_jobs.emplace_back();
+		deferred_jobs.back().exe_file = exe_file;
+		deferred_jobs.back().tempdir_name = tempdir_name;
+		deferred_jobs.back().show_tempdir = show_tempdir;
+		log("Deferred ABC9 run as job %d.\n", GetSize(deferred_jobs));
+		return;
 	}
+
+	log_header(design, "Executing ABC9.\n");
+	abc9_run(exe_file, tempdir_name, show_tempdir);
 }
 
 struct Abc9ExePass : public Pass {
@@ -367,6 +441,18 @@ struct Abc9ExePass : public Pass {
 		log("        file is expected. temporary files will be created in this directory, and\n");
 		log("        the mapped result will be written to 'output.aig'.\n");
 		log("\n");
+		log("    -defer\n");
+		log("        only write the ABC script to the directory given with -cwd. ABC is run\n");
+		log("        later, together with all other deferred jobs, by '-run_deferred'.\n");
+		log("\n");
+		log("    -run_deferred <N>\n");
+		log("        run all deferred jobs, up to <N> ABC processes at a time, and report\n");
+		log("        the wall time of each job. all other options are ignored.\n");
+		log("\n");
+		log("    -clear_deferred\n");
+		log("        drop all deferred jobs without running them, e.g. those left over by\n");
+		log("        an aborted run. all other options are ignored.\n");
+		log("\n");
 		log("Note that this is a logic optimization pass within Yosys that is calling ABC\n");
 		log("internally. This is not going to \"run ABC on your design\". It will instead run\n");
 		log("ABC on logic snippets extracted from your design. You will not get any useful\n");
@@ -386,7 +472,8 @@ struct Abc9ExePass : public Pass {
 		std::string delay_target, lutin_shared = "-S 1", wire_delay;
 		std::string tempdir_name;
 		bool fast_mode = false, dff_mode = false;
-		bool show_tempdir = false;
+		bool show_tempdir = false, defer = false, clear_deferred = false;
+		int run_deferred = 0;
 		vector<int> lut_costs;
 
 #if 0
@@ -470,10 +557,34 @@ struct Abc9ExePass : public Pass {
 				tempdir_name = args[++argidx];
 				continue;
 			}
+			if (arg == "-defer") {
+				defer = true;
+				continue;
+			}
+			if (arg == "-run_deferred" && argidx+1 < args.size()) {
+				run_deferred = std::max(1, atoi(args[++argidx].c_str()));
+				continue;
+			}
+			if (arg == "-clear_deferred") {
+				clear_deferred = true;
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
 
+		if (clear_deferred) {
+			if (!deferred_jobs.empty())
+				log("Dropping %d deferred ABC9 jobs.\n", GetSize(deferred_jobs));
+			deferred_jobs.clear();
+			return;
+		}
+
+		if (run_deferred) {
+			abc9_run_deferred(design, run_deferred);
+			return;
+		}
+
 		rewrite_filename(script_file);
 		if (!script_file.empty() && !is_absolute_path(script_file) && script_file[0] != '+')
 			script_file = std::string(pwd) + "/" + script_file;
@@ -533,7 +644,7 @@ struct Abc9ExePass : public Pass {
 
 		abc9_module(design, script_file, exe_file, lut_costs, dff_mode,
 				delay_target, lutin_shared, fast_mode, show_tempdir,
-				box_file, lut_file, wire_delay, tempdir_name);
+				box_file, lut_file, wire_delay, tempdir_name, defer);
 	}
 } Abc9ExePass;
 
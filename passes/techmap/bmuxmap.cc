@@ -44,7 +44,9 @@ struct BmuxmapPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
-		for (auto module : design->selected_modules())
+		// Only the Module methods change the module, and they unshare it
+		// (see Design::add_shared()).
+		for (auto module : design->selected_modules_readonly())
 		for (auto cell : module->selected_cells())
 		{
 			if (cell->type != ID($bmux))
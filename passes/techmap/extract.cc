@@ -594,9 +594,9 @@ struct ExtractPass : public Pass {
 						delete map;
 						log_cmd_error("Can't saved design `%s'.\n", filename.c_str()+1);
 					}
-					for (auto mod : saved_designs.at(filename.substr(1))->modules())
-						if (!map->has(mod->name))
-							map->add(mod->clone());
+					for (auto &it : saved_designs.at(filename.substr(1))->modules_)
+						if (!map->has(it.first))
+							map->add(it.second->clone());
 				}
 				else
 				{
@@ -21,7 +21,9 @@
 #include "kernel/utils.h"
 #include "kernel/sigtools.h"
 #include "kernel/ffinit.h"
+#include "kernel/threading.h"
 #include "libs/sha1/sha1.h"
+#include "frontends/verilog/verilog_frontend.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -47,26 +49,12 @@ void apply_prefix(IdString prefix, IdString &id)
 		id = stringf("$techmap%s.%s", prefix.c_str(), id.c_str());
 }
 
-void apply_prefix(IdString prefix, RTLIL::SigSpec &sig, RTLIL::Module *module)
-{
-	vector<SigChunk> chunks = sig;
-	for (auto &chunk : chunks)
-		if (chunk.wire != nullptr) {
-			IdString wire_name = chunk.wire->name;
-			apply_prefix(prefix, wire_name);
-			log_assert(module->wire(wire_name) != nullptr);
-			chunk.wire = module->wire(wire_name);
-		}
-	sig = chunks;
-}
-
 struct TechmapWorker
 {
 	dict<IdString, void(*)(RTLIL::Module*, RTLIL::Cell*)> simplemap_mappers;
 	dict<std::pair<IdString, dict<IdString, RTLIL::Const>>, RTLIL::Module*> techmap_cache;
 	dict<RTLIL::Module*, bool> techmap_do_cache;
 	pool<RTLIL::Module*> module_queue;
-	dict<Module*, SigMap> sigmaps;
 
 	pool<string> log_msg_cache;
 
@@ -141,7 +129,75 @@ struct TechmapWorker
 		return result;
 	}
 
-	void techmap_module_worker(RTLIL::Design *design, RTLIL::Module *module, RTLIL::Cell *cell, RTLIL::Module *tpl)
+	// A template module in a form that techmap_prepare() can read from worker
+	// threads. Everything that needs a lookup in the template (port names,
+	// attributes, _TECHMAP_ wires) is done once here, on the main thread.
+	struct TechmapTemplate
+	{
+		struct TplWire {
+			RTLIL::Wire *wire;
+			IdString posportname;
+			bool special = false, autopurge = false, connect_attr = false;
+			// ".<suffix>" of a _TECHMAP_REPLACE_.<suffix> wire
+			std::string replace_suffix;
+			std::vector<RTLIL::SigBit> autopurge_bits;
+		};
+
+		struct TplCell {
+			RTLIL::Cell *cell;
+			bool replace = false, has_memid = false, is_mem_cell = false;
+			// ".<suffix>" of a _TECHMAP_REPLACE_.<suffix> cell
+			std::string replace_suffix;
+			std::vector<std::pair<IdString, RTLIL::SigSpec>> connections;
+			// connections after sigmap, only for templates with autopurge ports
+			std::vector<std::vector<RTLIL::SigBit>> autopurge_conns;
+		};
+
+		RTLIL::Module *tpl;
+		bool replace_cell = false;
+		std::vector<TplWire> wires;
+		std::vector<int> ports;
+		std::vector<TplCell> cells;
+		std::vector<std::pair<IdString, RTLIL::Memory*>> memories;
+		std::vector<RTLIL::SigSig> connections;
+		std::vector<RTLIL::SigBit> written_bits;
+		dict<RTLIL::Wire*, int> wire_index;
+
+		int find_port(IdString portname) const
+		{
+			for (int i : ports)
+				if (wires[i].wire->name == portname || wires[i].posportname == portname)
+					return i;
+			return -1;
+		}
+	};
+
+	// The replacement of one cell, computed by techmap_prepare() from the
+	// template (in terms of the template wires) and added to the module by
+	// techmap_commit().
+	struct TechmapJob
+	{
+		struct NewWire : RTLIL::AttrObject {
+			IdString name, replace_name;
+		};
+
+		struct NewCell : RTLIL::AttrObject {
+			IdString name, type;
+			dict<IdString, RTLIL::Const> parameters;
+			std::vector<std::pair<IdString, RTLIL::SigSpec>> connections;
+		};
+
+		RTLIL::Cell *cell;
+		int tpl;
+		std::string orig_cell_name, error;
+		pool<string> extra_src_attrs;
+		std::vector<IdString> memory_names;
+		std::vector<NewWire> wires;
+		std::vector<NewCell> cells;
+		std::vector<RTLIL::SigSig> port_connections, tpl_connections;
+	};
+
+	void techmap_template(RTLIL::Module *tpl, TechmapTemplate &tt)
 	{
 		if (tpl->processes.size() != 0) {
 			log("Technology map yielded processes:");
@@ -155,133 +211,154 @@ struct TechmapWorker
 				log_error("Technology map yielded processes -> this is not supported (use -autoproc to run 'proc' automatically).\n");
 		}
 
-		std::string orig_cell_name;
-		pool<string> extra_src_attrs = cell->get_strpool_attribute(ID::src);
+		tt.tpl = tpl;
+		bool has_autopurge = false;
 
-		orig_cell_name = cell->name.str();
+		for (auto tpl_w : tpl->wires())
+		{
+			TechmapTemplate::TplWire tw;
+			tw.wire = tpl_w;
+			tw.special = tpl_w->get_bool_attribute(ID::_techmap_special_);
+			for (auto &attr : tpl_w->attributes)
+				if (attr.first != ID::src)
+					tw.connect_attr = true;
+			if (const char *p = strstr(tpl_w->name.c_str(), "_TECHMAP_REPLACE_."))
+				tw.replace_suffix = p + strlen("_TECHMAP_REPLACE_");
+			if (tpl_w->port_id > 0) {
+				tw.posportname = stringf("$%d", tpl_w->port_id);
+				tw.autopurge = tpl_w->get_bool_attribute(ID::techmap_autopurge);
+				has_autopurge |= tw.autopurge;
+				tt.ports.push_back(GetSize(tt.wires));
+			}
+			tt.wire_index[tpl_w] = GetSize(tt.wires);
+			tt.wires.push_back(tw);
+		}
+
+		SigMap sigmap;
+		if (has_autopurge) {
+			sigmap.set(tpl);
+			for (auto &tw : tt.wires)
+				if (tw.autopurge)
+					for (auto bit : sigmap(tw.wire))
+						if (bit.wire != nullptr)
+							tw.autopurge_bits.push_back(bit);
+		}
+
+		pool<SigBit> written_bits;
 		for (auto tpl_cell : tpl->cells())
-			if (tpl_cell->name.ends_with("_TECHMAP_REPLACE_")) {
-				module->rename(cell, stringf("$techmap%d", autoidx++) + cell->name.str());
-				break;
+		{
+			TechmapTemplate::TplCell tc;
+			tc.cell = tpl_cell;
+			tc.replace = tpl_cell->name.ends_with("_TECHMAP_REPLACE_");
+			tt.replace_cell |= tc.replace;
+			if (const char *p = strstr(tpl_cell->name.c_str(), "_TECHMAP_REPLACE_."))
+				tc.replace_suffix = p + strlen("_TECHMAP_REPLACE_");
+			tc.has_memid = tpl_cell->has_memid();
+			tc.is_mem_cell = tpl_cell->is_mem_cell();
+			for (auto &conn : tpl_cell->connections()) {
+				if (tpl_cell->output(conn.first))
+					for (auto bit : conn.second)
+						written_bits.insert(bit);
+				if (has_autopurge)
+					tc.autopurge_conns.push_back(sigmap(conn.second));
+				// an unpacked copy, reading it does not modify it
+				tc.connections.push_back(conn);
+				tc.connections.back().second.bits();
 			}
+			tt.cells.push_back(tc);
+		}
+		for (auto &conn : tpl->connections()) {
+			for (auto bit : conn.first)
+				written_bits.insert(bit);
+			tt.connections.push_back(conn);
+			tt.connections.back().first.bits();
+			tt.connections.back().second.bits();
+		}
+		tt.written_bits.assign(written_bits.begin(), written_bits.end());
+		std::sort(tt.written_bits.begin(), tt.written_bits.end());
 
-		dict<IdString, IdString> memory_renames;
+		for (auto &it : tpl->memories)
+			tt.memories.push_back(it);
+	}
+
+	// Runs on worker threads: only reads the cell and the template and does
+	// not touch the module.
+	void techmap_prepare(TechmapJob &job, const TechmapTemplate &tt)
+	{
+		RTLIL::Cell *cell = job.cell;
+		job.extra_src_attrs = cell->get_strpool_attribute(ID::src);
 
-		for (auto &it : tpl->memories) {
+		for (auto &it : tt.memories) {
 			IdString m_name = it.first;
 			apply_prefix(cell->name, m_name);
-			RTLIL::Memory *m = module->addMemory(m_name, it.second);
-			if (m->attributes.count(ID::src))
-				m->add_strpool_attribute(ID::src, extra_src_attrs);
-			memory_renames[it.first] = m->name;
-			design->select(module, m);
+			job.memory_names.push_back(m_name);
 		}
 
-		dict<IdString, IdString> positional_ports;
-		dict<Wire*, IdString> temp_renamed_wires;
 		pool<SigBit> autopurge_tpl_bits;
 
-		for (auto tpl_w : tpl->wires())
+		job.wires.resize(GetSize(tt.wires));
+		for (int i = 0; i < GetSize(tt.wires); i++)
 		{
-			if (tpl_w->port_id > 0)
-			{
-				IdString posportname = stringf("$%d", tpl_w->port_id);
-				positional_ports.emplace(posportname, tpl_w->name);
-
-				if (tpl_w->get_bool_attribute(ID::techmap_autopurge) &&
-						(!cell->hasPort(tpl_w->name) || !GetSize(cell->getPort(tpl_w->name))) &&
-						(!cell->hasPort(posportname) || !GetSize(cell->getPort(posportname))))
-				{
-					if (sigmaps.count(tpl) == 0)
-						sigmaps[tpl].set(tpl);
-
-					for (auto bit : sigmaps.at(tpl)(tpl_w))
-						if (bit.wire != nullptr)
-							autopurge_tpl_bits.insert(bit);
-				}
-			}
-			IdString w_name = tpl_w->name;
-			apply_prefix(cell->name, w_name);
-			RTLIL::Wire *w = module->wire(w_name);
-			if (w != nullptr) {
-				temp_renamed_wires[w] = w->name;
-				module->rename(w, NEW_ID);
-				w = nullptr;
-			}
-			if (w == nullptr) {
-				w = module->addWire(w_name, tpl_w);
-				w->port_input = false;
-				w->port_output = false;
-				w->port_id = 0;
-				w->attributes.erase(ID::techmap_autopurge);
-				if (tpl_w->get_bool_attribute(ID::_techmap_special_))
-					w->attributes.clear();
-				if (w->attributes.count(ID::src))
-					w->add_strpool_attribute(ID::src, extra_src_attrs);
-			}
-			design->select(module, w);
-
-			if (const char *p = strstr(tpl_w->name.c_str(), "_TECHMAP_REPLACE_.")) {
-				IdString replace_name = stringf("%s%s", orig_cell_name.c_str(), p + strlen("_TECHMAP_REPLACE_"));
-				Wire *replace_w = module->addWire(replace_name, tpl_w);
-				module->connect(replace_w, w);
+			const TechmapTemplate::TplWire &tw = tt.wires[i];
+			TechmapJob::NewWire &w = job.wires[i];
+
+			if (tw.autopurge && (!cell->hasPort(tw.wire->name) || !GetSize(cell->getPort(tw.wire->name))) &&
+					(!cell->hasPort(tw.posportname) || !GetSize(cell->getPort(tw.posportname))))
+				autopurge_tpl_bits.insert(tw.autopurge_bits.begin(), tw.autopurge_bits.end());
+
+			w.name = tw.wire->name;
+			apply_prefix(cell->name, w.name);
+			if (!tw.special) {
+				w.attributes = tw.wire->attributes;
+				w.attributes.erase(ID::techmap_autopurge);
+				if (w.attributes.count(ID::src))
+					w.add_strpool_attribute(ID::src, job.extra_src_attrs);
 			}
+			if (!tw.replace_suffix.empty())
+				w.replace_name = job.orig_cell_name + tw.replace_suffix;
 		}
 
-		pool<SigBit> tpl_written_bits;
-		for (auto tpl_cell : tpl->cells())
-		for (auto &conn : tpl_cell->connections())
-			if (tpl_cell->output(conn.first))
-				for (auto bit : conn.second)
-					tpl_written_bits.insert(bit);
-		for (auto &conn : tpl->connections())
-			for (auto bit : conn.first)
-				tpl_written_bits.insert(bit);
-
 		SigMap port_signal_map;
 
 		for (auto &it : cell->connections())
 		{
-			IdString portname = it.first;
-			if (positional_ports.count(portname) > 0)
-				portname = positional_ports.at(portname);
-			if (tpl->wire(portname) == nullptr || tpl->wire(portname)->port_id == 0) {
-				if (portname.begins_with("$"))
-					log_error("Can't map port `%s' of cell `%s' to template `%s'!\n", portname.c_str(), cell->name.c_str(), tpl->name.c_str());
+			int idx = tt.find_port(it.first);
+			if (idx < 0) {
+				if (it.first.begins_with("$")) {
+					job.error = stringf("Can't map port `%s' of cell `%s' to template `%s'!\n", it.first.c_str(), cell->name.c_str(), tt.tpl->name.c_str());
+					return;
+				}
 				continue;
 			}
 
 			if (GetSize(it.second) == 0)
 				continue;
 
-			RTLIL::Wire *w = tpl->wire(portname);
+			RTLIL::Wire *w = tt.wires[idx].wire;
 			RTLIL::SigSig c, extra_connect;
 
 			if (w->port_output && !w->port_input) {
 				c.first = it.second;
 				c.second = RTLIL::SigSpec(w);
-				apply_prefix(cell->name, c.second, module);
 				extra_connect.first = c.second;
 				extra_connect.second = c.first;
 			} else if (!w->port_output && w->port_input) {
 				c.first = RTLIL::SigSpec(w);
 				c.second = it.second;
-				apply_prefix(cell->name, c.first, module);
 				extra_connect.first = c.first;
 				extra_connect.second = c.second;
 			} else {
-				SigSpec sig_tpl = w, sig_tpl_pf = w, sig_mod = it.second;
-				apply_prefix(cell->name, sig_tpl_pf, module);
+				SigSpec sig_tpl = w, sig_mod = it.second;
 				for (int i = 0; i < GetSize(sig_tpl) && i < GetSize(sig_mod); i++) {
-					if (tpl_written_bits.count(sig_tpl[i])) {
+					if (std::binary_search(tt.written_bits.begin(), tt.written_bits.end(), sig_tpl[i])) {
 						c.first.append(sig_mod[i]);
-						c.second.append(sig_tpl_pf[i]);
+						c.second.append(sig_tpl[i]);
 					} else {
-						c.first.append(sig_tpl_pf[i]);
+						c.first.append(sig_tpl[i]);
 						c.second.append(sig_mod[i]);
 					}
 				}
-				extra_connect.first = sig_tpl_pf;
+				extra_connect.first = sig_tpl;
 				extra_connect.second = sig_mod;
 			}
 
@@ -301,100 +378,159 @@ struct TechmapWorker
 			if (!w->port_output && w->port_input) {
 				port_signal_map.add(c.first, c.second);
 			} else {
-				module->connect(c);
+				job.port_connections.push_back(c);
 				extra_connect = SigSig();
 			}
 
-			for (auto &attr : w->attributes) {
-				if (attr.first == ID::src)
-					continue;
+			if (tt.wires[idx].connect_attr) {
 				auto lhs = GetSize(extra_connect.first);
 				auto rhs = GetSize(extra_connect.second);
 				if (lhs > rhs)
 					extra_connect.first.remove(rhs, lhs-rhs);
 				else if (rhs > lhs)
 					extra_connect.second.remove(lhs, rhs-lhs);
-				module->connect(extra_connect);
-				break;
+				job.port_connections.push_back(extra_connect);
 			}
 		}
 
-		for (auto tpl_cell : tpl->cells())
+		job.cells.resize(GetSize(tt.cells));
+		for (int i = 0; i < GetSize(tt.cells); i++)
 		{
-			IdString c_name = tpl_cell->name;
-			bool techmap_replace_cell = c_name.ends_with("_TECHMAP_REPLACE_");
-
-			if (techmap_replace_cell)
-				c_name = orig_cell_name;
-			else if (const char *p = strstr(tpl_cell->name.c_str(), "_TECHMAP_REPLACE_."))
-				c_name = stringf("%s%s", orig_cell_name.c_str(), p + strlen("_TECHMAP_REPLACE_"));
-			else
-				apply_prefix(cell->name, c_name);
-
-			RTLIL::Cell *c = module->addCell(c_name, tpl_cell);
-			design->select(module, c);
-
-			if (c->type.begins_with("\\$"))
-				c->type = c->type.substr(1);
+			const TechmapTemplate::TplCell &tc = tt.cells[i];
+			TechmapJob::NewCell &c = job.cells[i];
+
+			if (tc.replace)
+				c.name = job.orig_cell_name;
+			else if (!tc.replace_suffix.empty())
+				c.name = job.orig_cell_name + tc.replace_suffix;
+			else {
+				c.name = tc.cell->name;
+				apply_prefix(cell->name, c.name);
+			}
 
-			vector<IdString> autopurge_ports;
+			c.type = tc.cell->type;
+			if (c.type.begins_with("\\$"))
+				c.type = c.type.substr(1);
+			c.parameters = tc.cell->parameters;
+			c.attributes = tc.cell->attributes;
 
-			for (auto &conn : c->connections())
+			int k = 0;
+			for (auto &conn : tc.connections)
 			{
 				bool autopurge = false;
 				if (!autopurge_tpl_bits.empty()) {
 					autopurge = GetSize(conn.second) != 0;
-					for (auto &bit : sigmaps.at(tpl)(conn.second))
+					for (auto &bit : tc.autopurge_conns[k])
 						if (!autopurge_tpl_bits.count(bit)) {
 							autopurge = false;
 							break;
 						}
 				}
+				k++;
 
-				if (autopurge) {
-					autopurge_ports.push_back(conn.first);
-				} else {
+				if (!autopurge) {
 					RTLIL::SigSpec new_conn = conn.second;
-					apply_prefix(cell->name, new_conn, module);
 					port_signal_map.apply(new_conn);
-					c->setPort(conn.first, std::move(new_conn));
+					c.connections.emplace_back(conn.first, std::move(new_conn));
 				}
 			}
 
-			for (auto &it2 : autopurge_ports)
-				c->unsetPort(it2);
-
-			if (c->has_memid()) {
-				IdString memid = c->getParam(ID::MEMID).decode_string();
-				log_assert(memory_renames.count(memid) != 0);
-				c->setParam(ID::MEMID, Const(memory_renames[memid].str()));
-			} else if (c->is_mem_cell()) {
-				IdString memid = c->getParam(ID::MEMID).decode_string();
+			if (tc.has_memid) {
+				IdString memid = c.parameters.at(ID::MEMID).decode_string();
+				int m = 0;
+				while (m < GetSize(tt.memories) && tt.memories[m].first != memid)
+					m++;
+				log_assert(m < GetSize(tt.memories));
+				c.parameters[ID::MEMID] = Const(job.memory_names[m].str());
+			} else if (tc.is_mem_cell) {
+				IdString memid = c.parameters.at(ID::MEMID).decode_string();
 				apply_prefix(cell->name, memid);
-				c->setParam(ID::MEMID, Const(memid.c_str()));
+				c.parameters[ID::MEMID] = Const(memid.c_str());
 			}
 
-			if (c->attributes.count(ID::src))
-				c->add_strpool_attribute(ID::src, extra_src_attrs);
+			if (c.attributes.count(ID::src))
+				c.add_strpool_attribute(ID::src, job.extra_src_attrs);
 
-			if (techmap_replace_cell) {
+			if (tc.replace) {
 				for (auto attr : cell->attributes)
-					if (!c->attributes.count(attr.first))
-						c->attributes[attr.first] = attr.second;
-				c->attributes.erase(ID::reprocess_after);
+					if (!c.attributes.count(attr.first))
+						c.attributes[attr.first] = attr.second;
+				c.attributes.erase(ID::reprocess_after);
 			}
 		}
 
-		for (auto &it : tpl->connections()) {
+		for (auto &it : tt.connections) {
 			RTLIL::SigSig c = it;
-			apply_prefix(cell->name.str(), c.first, module);
-			apply_prefix(cell->name.str(), c.second, module);
 			port_signal_map.apply(c.first);
 			port_signal_map.apply(c.second);
-			module->connect(c);
+			job.tpl_connections.push_back(c);
+		}
+	}
+
+	void techmap_commit(RTLIL::Design *design, RTLIL::Module *module, const TechmapTemplate &tt, TechmapJob &job)
+	{
+		if (!job.error.empty())
+			log_error("%s", job.error.c_str());
+
+		for (int i = 0; i < GetSize(tt.memories); i++) {
+			RTLIL::Memory *m = module->addMemory(job.memory_names[i], tt.memories[i].second);
+			if (m->attributes.count(ID::src))
+				m->add_strpool_attribute(ID::src, job.extra_src_attrs);
+			design->select(module, m);
+		}
+
+		std::vector<RTLIL::Wire*> new_wires;
+		dict<Wire*, IdString> temp_renamed_wires;
+
+		for (int i = 0; i < GetSize(tt.wires); i++)
+		{
+			RTLIL::Wire *tpl_w = tt.wires[i].wire;
+			TechmapJob::NewWire &nw = job.wires[i];
+			RTLIL::Wire *w = module->wire(nw.name);
+			if (w != nullptr) {
+				temp_renamed_wires[w] = w->name;
+				module->rename(w, NEW_ID);
+			}
+			w = module->addWire(nw.name, tpl_w);
+			w->port_input = false;
+			w->port_output = false;
+			w->port_id = 0;
+			w->attributes.swap(nw.attributes);
+			design->select(module, w);
+			new_wires.push_back(w);
+
+			if (!nw.replace_name.empty()) {
+				Wire *replace_w = module->addWire(nw.replace_name, tpl_w);
+				module->connect(replace_w, w);
+			}
 		}
 
-		module->remove(cell);
+		// map the template wires to the new wires of the module
+		auto map_sig = [&](const RTLIL::SigSpec &sig) {
+			vector<SigChunk> chunks = sig;
+			for (auto &chunk : chunks)
+				if (chunk.wire != nullptr && chunk.wire->module == tt.tpl)
+					chunk.wire = new_wires[tt.wire_index.at(chunk.wire)];
+			return RTLIL::SigSpec(chunks);
+		};
+
+		for (auto &it : job.port_connections)
+			module->connect(map_sig(it.first), map_sig(it.second));
+
+		for (auto &nc : job.cells)
+		{
+			RTLIL::Cell *c = module->addCell(nc.name, nc.type);
+			c->parameters.swap(nc.parameters);
+			c->attributes.swap(nc.attributes);
+			for (auto &conn : nc.connections)
+				c->setPort(conn.first, map_sig(conn.second));
+			design->select(module, c);
+		}
+
+		for (auto &it : job.tpl_connections)
+			module->connect(map_sig(it.first), map_sig(it.second));
+
+		module->remove(job.cell);
 
 		for (auto &it : temp_renamed_wires)
 		{
@@ -407,6 +543,44 @@ struct TechmapWorker
 		}
 	}
 
+	// Prepare the queued cell replacements in parallel, then add them to the
+	// module in the order they were queued.
+	void techmap_flush(RTLIL::Design *design, RTLIL::Module *module, const std::vector<TechmapTemplate> &templates, std::vector<TechmapJob> &jobs)
+	{
+		int num_chunks = std::min(GetSize(jobs), yosys_threads > 1 ? 4 * yosys_threads : 1);
+		parallel_for(num_chunks, [&](int chunk) {
+			int begin = int64_t(GetSize(jobs)) * chunk / num_chunks;
+			int end = int64_t(GetSize(jobs)) * (chunk + 1) / num_chunks;
+			for (int i = begin; i < end; i++)
+				techmap_prepare(jobs[i], templates[jobs[i].tpl]);
+		});
+
+		for (auto &job : jobs)
+			techmap_commit(design, module, templates[job.tpl], job);
+		jobs.clear();
+	}
+
+	// The modules of the map design are shared with the cached map library
+	// (see TechmapPass::MapLibrary). Templates are looked up through the const
+	// accessor, which does not copy them, and unshared only before they are
+	// changed.
+	static RTLIL::Module *map_module(const RTLIL::Design *map, RTLIL::IdString name)
+	{
+		return const_cast<RTLIL::Module*>(map->module(name));
+	}
+
+	// Whether mapping with a template changes it: _TECHMAP_DO_ scripts
+	// (including CONSTMAP), -recursive and -autoproc run on the template.
+	bool template_changes(RTLIL::Module *tpl)
+	{
+		if (recursive_mode || !tpl->processes.empty())
+			return true;
+		for (auto wire : tpl->wires())
+			if (wire->name.contains("_TECHMAP_DO_"))
+				return true;
+		return false;
+	}
+
 	bool techmap_module(RTLIL::Design *design, RTLIL::Module *module, RTLIL::Design *map, pool<RTLIL::Cell*> &handled_cells,
 			const dict<IdString, pool<IdString>> &celltypeMap, bool in_recursion)
 	{
@@ -426,6 +600,11 @@ struct TechmapWorker
 		dict<RTLIL::Cell*, pool<RTLIL::SigBit>> cell_to_inbit;
 		dict<RTLIL::SigBit, pool<RTLIL::Cell*>> outbit_to_cell;
 
+		// cells are replaced by templates in batches, see techmap_flush()
+		std::vector<TechmapTemplate> templates;
+		dict<RTLIL::Module*, int> template_index;
+		std::vector<TechmapJob> jobs;
+
 		for (auto cell : module->selected_cells())
 		{
 			if (handled_cells.count(cell) > 0)
@@ -450,7 +629,7 @@ struct TechmapWorker
 					continue;
 
 				for (auto &tpl_name : celltypeMap.at(cell_type)) {
-					RTLIL::Module *tpl = map->module(tpl_name);
+					RTLIL::Module *tpl = map_module(map, tpl_name);
 					RTLIL::Wire *port = tpl->wire(conn.first);
 					if (port && port->port_input)
 						cell_to_inbit[cell].insert(sig.begin(), sig.end());
@@ -484,7 +663,7 @@ struct TechmapWorker
 			for (auto &tpl_name : celltypeMap.at(cell_type))
 			{
 				IdString derived_name = tpl_name;
-				RTLIL::Module *tpl = map->module(tpl_name);
+				RTLIL::Module *tpl = map_module(map, tpl_name);
 				dict<IdString, RTLIL::Const> parameters(cell->parameters);
 
 				if (tpl->get_blackbox_attribute(ignore_wb))
@@ -515,7 +694,7 @@ struct TechmapWorker
 						if (extmapper_name == "wrap")
 							m_name += ":" + sha1(tpl->attributes.at(ID::techmap_wrap).decode_string());
 
-						RTLIL::Design *extmapper_design = extern_mode && !in_recursion ? design : tpl->design;
+						RTLIL::Design *extmapper_design = extern_mode && !in_recursion ? design : map;
 						RTLIL::Module *extmapper_module = extmapper_design->module(m_name);
 
 						if (extmapper_module == nullptr)
@@ -679,7 +858,7 @@ struct TechmapWorker
 							for (auto &bit : sigmap(conn.second)) {
 								int val = unique_bit_id.at(bit);
 								for (int i = 0; i < bits; i++) {
-									value.bits.push_back((val & 1) != 0 ? State::S1 : State::S0);
+									value.bits().push_back((val & 1) != 0 ? State::S1 : State::S0);
 									val = val >> 1;
 								}
 							}
@@ -699,17 +878,25 @@ struct TechmapWorker
 						if (parameters.size() != 0) {
 							mkdebug.on();
 							derived_name = tpl->derive(map, parameters);
-							tpl = map->module(derived_name);
+							tpl = map_module(map, derived_name);
 							log_continue = true;
 						}
 						techmap_cache.emplace(std::move(key), tpl);
 					}
 				}
 
-				RTLIL::Module *constmapped_tpl = map->module(constmap_tpl_name(sigmap, tpl, cell, false));
+				RTLIL::Module *constmapped_tpl = map_module(map, constmap_tpl_name(sigmap, tpl, cell, false));
 				if (constmapped_tpl != nullptr)
 					tpl = constmapped_tpl;
 
+				if (techmap_do_cache.count(tpl) == 0 && template_changes(tpl)) {
+					RTLIL::Module *own_tpl = map->unshare(tpl);
+					for (auto &it : techmap_cache)
+						if (it.second == tpl)
+							it.second = own_tpl;
+					tpl = own_tpl;
+				}
+
 				if (techmap_do_cache.count(tpl) == 0)
 				{
 					bool keep_running = true;
@@ -767,7 +954,7 @@ struct TechmapWorker
 								log("Analyzing pattern of constant bits for this cell:\n");
 								IdString new_tpl_name = constmap_tpl_name(sigmap, tpl, cell, true);
 								log("Creating constmapped module `%s'.\n", log_id(new_tpl_name));
-								log_assert(map->module(new_tpl_name) == nullptr);
+								log_assert(map_module(map, new_tpl_name) == nullptr);
 
 								RTLIL::Module *new_tpl = map->addModule(new_tpl_name);
 								tpl->cloneInto(new_tpl);
@@ -949,7 +1136,22 @@ struct TechmapWorker
 						log("%s\n", msg.c_str());
 					}
 					log_debug("%s %s.%s (%s) using %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(cell->type), log_id(tpl));
-					techmap_module_worker(design, module, cell, tpl);
+
+					if (!template_index.count(tpl)) {
+						template_index[tpl] = GetSize(templates);
+						templates.emplace_back();
+						techmap_template(tpl, templates.back());
+					}
+
+					jobs.emplace_back();
+					TechmapJob &job = jobs.back();
+					job.cell = cell;
+					job.tpl = template_index.at(tpl);
+					job.orig_cell_name = cell->name.str();
+					if (templates[job.tpl].replace_cell)
+						module->rename(cell, stringf("$techmap%d", autoidx++) + cell->name.str());
+					if (GetSize(jobs) >= 4096)
+						techmap_flush(design, module, templates, jobs);
 					cell = nullptr;
 				}
 				did_something = true;
@@ -963,6 +1165,8 @@ struct TechmapWorker
 			handled_cells.insert(cell);
 		}
 
+		techmap_flush(design, module, templates, jobs);
+
 		if (log_continue) {
 			log_header(design, "Continuing TECHMAP pass.\n");
 			log_continue = false;
@@ -975,6 +1179,87 @@ struct TechmapWorker
 
 struct TechmapPass : public Pass {
 	TechmapPass() : Pass("techmap", "generic technology mapper") { }
+
+	// Parsed map libraries, kept across calls. The key is the frontend
+	// command and the list of map files, the stamp holds a hash of the
+	// contents of each file that was read while parsing the library, which
+	// includes `include files and $readmem data files (an mtime can miss
+	// quick rewrites). Each call gets its own design that shares the modules
+	// of the cached design, so that a module is only copied when it is
+	// modified by the call (see Design::add_shared() and
+	// TechmapWorker::map_module()).
+	struct MapLibrary {
+		std::vector<std::string> files;
+		std::string stamp;
+		RTLIL::Design *design = nullptr;
+		dict<IdString, pool<IdString>> celltypeMap;
+	};
+	dict<std::string, MapLibrary> map_cache;
+
+	void on_shutdown() override
+	{
+		for (auto &it : map_cache)
+			delete it.second.design;
+		map_cache.clear();
+	}
+
+	static bool map_file_stamp(std::string filename, std::string &stamp)
+	{
+		rewrite_filename(filename);
+		std::ifstream f(filename, std::ios::binary);
+		if (f.fail())
+			return false;
+		SHA1 checksum;
+		checksum.update(f);
+		stamp += filename + " " + checksum.final() + "\n";
+		return true;
+	}
+
+	static bool map_files_stamp(const std::vector<std::string> &files, std::string &stamp)
+	{
+		for (auto &fn : files)
+			if (!map_file_stamp(fn, stamp))
+				return false;
+		return true;
+	}
+
+	static void build_celltype_map(RTLIL::Design *map, dict<IdString, pool<IdString>> &celltypeMap)
+	{
+		for (auto module : map->modules()) {
+			if (module->attributes.count(ID::techmap_celltype) && !module->attributes.at(ID::techmap_celltype).empty()) {
+				char *p = strdup(module->attributes.at(ID::techmap_celltype).decode_string().c_str());
+				for (char *q = strtok(p, " \t\r\n"); q; q = strtok(nullptr, " \t\r\n")) {
+					std::vector<std::string> queue;
+					queue.push_back(q);
+					while (!queue.empty()) {
+						std::string name = queue.back();
+						queue.pop_back();
+						auto pos = name.find('[');
+						if (pos == std::string::npos) {
+							// No further expansion.
+							celltypeMap[RTLIL::escape_id(name)].insert(module->name);
+						} else {
+							// Expand [] in this name.
+							auto epos = name.find(']', pos);
+							if (epos == std::string::npos)
+								log_error("Malformed techmap_celltype pattern %s\n", q);
+							for (size_t i = pos + 1; i < epos; i++) {
+								queue.push_back(name.substr(0, pos) + name[i] + name.substr(epos + 1, std::string::npos));
+							}
+						}
+					}
+				}
+				free(p);
+			} else {
+				IdString module_name = module->name.begins_with("\\$") ?
+						module->name.substr(1) : module->name.str();
+				celltypeMap[module_name].insert(module->name);
+			}
+		}
+		for (auto &i : celltypeMap)
+			i.second.sort(RTLIL::sort_by_id_str());
+	}
+
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -1023,6 +1308,14 @@ struct TechmapPass : public Pass {
 		log("        map file. Note that the Verilog frontend is also called with the\n");
 		log("        '-nooverwrite' option set.\n");
 		log("\n");
+		log("    -nocache\n");
+		log("        always read the map files. By default the parsed map library is kept\n");
+		log("        for later techmap calls with the same map files and frontend options,\n");
+		log("        and only read again when the contents of one of the files read while\n");
+		log("        loading it have changed. These are the map files and all files they\n");
+		log("        include or read data from. Map libraries with in-memory designs are\n");
+		log("        never cached.\n");
+		log("\n");
 		log("When a module in the map file has the 'techmap_celltype' attribute set, it will\n");
 		log("match cells with a type that match the text value of this attribute. Otherwise\n");
 		log("the module name will be used to match the cell.  Multiple space-separated cell\n");
@@ -1152,6 +1445,7 @@ struct TechmapPass : public Pass {
 		std::vector<std::string> map_files;
 		std::string verilog_frontend = "verilog -nooverwrite -noblackbox";
 		int max_iter = -1;
+		bool nocache = false;
 
 		size_t argidx;
 		for (argidx = 1; argidx < args.size(); argidx++) {
@@ -1191,65 +1485,98 @@ struct TechmapPass : public Pass {
 				worker.ignore_wb = true;
 				continue;
 			}
+			if (args[argidx] == "-nocache") {
+				nocache = true;
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
 
-		RTLIL::Design *map = new RTLIL::Design;
-		if (map_files.empty()) {
-			Frontend::frontend_call(map, nullptr, "+/techmap.v", verilog_frontend);
-		} else {
-			for (auto &fn : map_files)
-				if (fn.compare(0, 1, "%") == 0) {
-					if (!saved_designs.count(fn.substr(1))) {
-						delete map;
-						log_cmd_error("Can't open saved design `%s'.\n", fn.c_str()+1);
-					}
-					for (auto mod : saved_designs.at(fn.substr(1))->modules())
-						if (!map->module(mod->name))
-							map->add(mod->clone());
-				} else {
-					Frontend::frontend_call(map, nullptr, fn, (fn.size() > 3 && fn.compare(fn.size()-3, std::string::npos, ".il") == 0 ? "rtlil" : verilog_frontend));
-				}
+		// The map library is cached unless it includes in-memory designs.
+		std::string cache_key;
+		bool use_cache = !nocache;
+		if (use_cache) {
+			cache_key = verilog_frontend;
+			for (auto &opt : VERILOG_FRONTEND::default_options())
+				cache_key += " " + opt;
+			if (map_files.empty())
+				cache_key += "\n+/techmap.v";
+			for (auto &fn : map_files) {
+				cache_key += "\n" + fn;
+				if (fn.compare(0, 1, "%") == 0)
+					use_cache = false;
+			}
 		}
 
-		log_header(design, "Continuing TECHMAP pass.\n");
+		MapLibrary uncached, *library = nullptr;
+		if (use_cache && map_cache.count(cache_key)) {
+			library = &map_cache.at(cache_key);
+			std::string cache_stamp;
+			if (map_files_stamp(library->files, cache_stamp) && library->stamp == cache_stamp) {
+				log("Using cached map library (%d modules).\n", GetSize(library->design->modules_));
+			} else {
+				delete library->design;
+				map_cache.erase(cache_key);
+				library = nullptr;
+			}
+		}
 
-		dict<IdString, pool<IdString>> celltypeMap;
-		for (auto module : map->modules()) {
-			if (module->attributes.count(ID::techmap_celltype) && !module->attributes.at(ID::techmap_celltype).bits.empty()) {
-				char *p = strdup(module->attributes.at(ID::techmap_celltype).decode_string().c_str());
-				for (char *q = strtok(p, " \t\r\n"); q; q = strtok(nullptr, " \t\r\n")) {
-					std::vector<std::string> queue;
-					queue.push_back(q);
-					while (!queue.empty()) {
-						std::string name = queue.back();
-						queue.pop_back();
-						auto pos = name.find('[');
-						if (pos == std::string::npos) {
-							// No further expansion.
-							celltypeMap[RTLIL::escape_id(name)].insert(module->name);
+		if (library == nullptr)
+		{
+			// collect the names of all files opened by the frontends
+			std::set<std::string> read_files;
+			std::swap(read_files, yosys_input_files);
+
+			RTLIL::Design *lib = new RTLIL::Design;
+			try {
+				if (map_files.empty()) {
+					Frontend::frontend_call(lib, nullptr, "+/techmap.v", verilog_frontend);
+				} else {
+					for (auto &fn : map_files)
+						if (fn.compare(0, 1, "%") == 0) {
+							if (!saved_designs.count(fn.substr(1)))
+								log_cmd_error("Can't open saved design `%s'.\n", fn.c_str()+1);
+							for (auto &it : saved_designs.at(fn.substr(1))->modules_)
+								if (!lib->has(it.first))
+									lib->add(it.second->clone());
 						} else {
-							// Expand [] in this name.
-							auto epos = name.find(']', pos);
-							if (epos == std::string::npos)
-								log_error("Malformed techmap_celltype pattern %s\n", q);
-							for (size_t i = pos + 1; i < epos; i++) {
-								queue.push_back(name.substr(0, pos) + name[i] + name.substr(epos + 1, std::string::npos));
-							}
+							Frontend::frontend_call(lib, nullptr, fn, (fn.size() > 3 && fn.compare(fn.size()-3, std::string::npos, ".il") == 0 ? "rtlil" : verilog_frontend));
 						}
-					}
 				}
-				free(p);
-			} else {
-				IdString module_name = module->name.begins_with("\\$") ?
-						module->name.substr(1) : module->name.str();
-				celltypeMap[module_name].insert(module->name);
+			} catch (...) {
+				yosys_input_files.insert(read_files.begin(), read_files.end());
+				delete lib;
+				throw;
 			}
+
+			std::swap(read_files, yosys_input_files);
+			yosys_input_files.insert(read_files.begin(), read_files.end());
+
+			library = use_cache ? &map_cache[cache_key] : &uncached;
+			library->files.assign(read_files.begin(), read_files.end());
+			library->stamp.clear();
+			// a file that can't be read again never matches (stamps end in "\n")
+			if (use_cache && !map_files_stamp(library->files, library->stamp))
+				library->stamp = "?";
+			library->design = lib;
+			library->celltypeMap.clear();
+			build_celltype_map(lib, library->celltypeMap);
 		}
+
+		RTLIL::Design *map = new RTLIL::Design;
+		for (auto &it : library->design->modules_)
+			map->add_shared(it.second);
+		dict<IdString, pool<IdString>> celltypeMap = library->celltypeMap;
+
+		// the modules now belong to the map design only
+		if (library == &uncached)
+			delete uncached.design;
+
+		log_header(design, "Continuing TECHMAP pass.\n");
+
 		log_debug("Cell type mappings to use:\n");
 		for (auto &i : celltypeMap) {
-			i.second.sort(RTLIL::sort_by_id_str());
 			std::string maps = "";
 			for (auto &map : i.second)
 				maps += stringf(" %s", log_id(map));
@@ -0,0 +1,1055 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+#include "kernel/threading.h"
+#include "kernel/celltypes.h"
+#include "kernel/sigtools.h"
+#include "kernel/modtools.h"
+#include "frontends/verilog/verilog_frontend.h"
+#include "frontends/ast/ast.h"
+#include <chrono>
+#include <fstream>
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+static double wall_time(const std::function<void()> &f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(stop - start).count();
+}
+
+static void report(const char *name, const char *impl, int threads, int64_t ops, double seconds)
+{
+	log("  %-10s %-14s %3d thread%s %10.3f ms %10.2f Mops/s\n", name, impl, threads, threads == 1 ? " " : "s",
+			seconds * 1e3, seconds > 0 ? ops / seconds * 1e-6 : 0.0);
+}
+
+// Split [0, n) into chunks and run them with the given number of threads.
+static void run_chunks(int threads, int n, const std::function<void(int, int)> &f)
+{
+	int old_threads = yosys_threads;
+	int num_chunks = threads > 1 ? 4 * threads : 1;
+	yosys_threads = threads;
+	parallel_for(num_chunks, [&](int chunk) {
+		f(int64_t(n) * chunk / num_chunks, int64_t(n) * (chunk + 1) / num_chunks);
+	});
+	yosys_threads = old_threads;
+}
+
+// -------------------------------------------------------------------------
+// bench -idstring
+// -------------------------------------------------------------------------
+
+// The single-table IdString storage used up to Yosys 0.22, for comparison.
+// It is not thread-safe, so multi-threaded runs go through a global mutex.
+struct LegacyIdStorage
+{
+	std::vector<char*> storage;
+	dict<char*, int, hash_cstr_ops> index;
+	std::vector<int> refcount;
+	std::vector<int> free_idx_list;
+	ys_mutex mutex;
+
+	~LegacyIdStorage()
+	{
+		for (int idx = 1; idx < GetSize(storage); idx++)
+			free(storage[idx]);
+	}
+
+	int get_reference(const char *p)
+	{
+		if (!p[0])
+			return 0;
+
+		auto it = index.find((char*)p);
+		if (it != index.end()) {
+			refcount.at(it->second)++;
+			return it->second;
+		}
+
+		log_assert(p[0] == '$' || p[0] == '\\');
+		log_assert(p[1] != 0);
+		for (const char *c = p; *c; c++)
+			if ((unsigned)*c <= (unsigned)' ')
+				log_error("Found control character or space (0x%02x) in string '%s'.\n", *c, p);
+
+		if (free_idx_list.empty()) {
+			if (storage.empty()) {
+				refcount.push_back(0);
+				storage.push_back((char*)"");
+				index[storage.back()] = 0;
+			}
+			free_idx_list.push_back(storage.size());
+			storage.push_back(nullptr);
+			refcount.push_back(0);
+		}
+
+		int idx = free_idx_list.back();
+		free_idx_list.pop_back();
+		storage.at(idx) = strdup(p);
+		index[storage.at(idx)] = idx;
+		refcount.at(idx)++;
+		return idx;
+	}
+
+	void put_reference(int idx)
+	{
+		if (!idx || --refcount[idx] > 0)
+			return;
+
+		index.erase(storage.at(idx));
+		free(storage.at(idx));
+		storage.at(idx) = nullptr;
+		free_idx_list.push_back(idx);
+	}
+
+	int locked_get_reference(const char *p)
+	{
+		ys_lock_guard lock(mutex);
+		return get_reference(p);
+	}
+
+	void locked_put_reference(int idx)
+	{
+		ys_lock_guard lock(mutex);
+		put_reference(idx);
+	}
+};
+
+static void bench_idstring(int n, int threads)
+{
+	static int run_counter = 0;
+
+	std::vector<std::string> names;
+	names.reserve(n);
+	for (int i = 0; i < n; i++)
+		names.push_back(stringf("\\bench_%d_%d_%s", run_counter, i, i % 3 ? "n" : "some_longer_name_suffix"));
+	run_counter++;
+
+	// "intern" creates all names, "lookup" creates and drops a temporary
+	// reference to each existing name, and "release" drops the last reference
+	// to each name so that it is freed.
+
+	log("Interning %d names:\n", n);
+
+	for (int t : {1, threads})
+	{
+		LegacyIdStorage legacy;
+		std::vector<int> legacy_ids(n);
+
+		report("intern", "legacy", t, n, wall_time([&]() {
+			run_chunks(t, n, [&](int begin, int end) {
+				for (int i = begin; i < end; i++)
+					legacy_ids[i] = t == 1 ? legacy.get_reference(names[i].c_str()) : legacy.locked_get_reference(names[i].c_str());
+			});
+		}));
+
+		report("lookup", "legacy", t, n, wall_time([&]() {
+			run_chunks(t, n, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					if (t == 1)
+						legacy.put_reference(legacy.get_reference(names[i].c_str()));
+					else
+						legacy.locked_put_reference(legacy.locked_get_reference(names[i].c_str()));
+				}
+			});
+		}));
+
+		report("release", "legacy", t, n, wall_time([&]() {
+			run_chunks(t, n, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					if (t == 1)
+						legacy.put_reference(legacy_ids[i]);
+					else
+						legacy.locked_put_reference(legacy_ids[i]);
+				}
+			});
+		}));
+
+		std::vector<RTLIL::IdString> ids(n);
+
+		report("intern", "IdString", t, n, wall_time([&]() {
+			run_chunks(t, n, [&](int begin, int end) {
+				for (int i = begin; i < end; i++)
+					ids[i] = RTLIL::IdString(names[i]);
+			});
+		}));
+
+		report("lookup", "IdString", t, n, wall_time([&]() {
+			run_chunks(t, n, [&](int begin, int end) {
+				for (int i = begin; i < end; i++)
+					RTLIL::IdString id(names[i]);
+			});
+		}));
+
+		report("release", "IdString", t, n, wall_time([&]() {
+			run_chunks(t, n, [&](int begin, int end) {
+				for (int i = begin; i < end; i++)
+					ids[i] = RTLIL::IdString();
+			});
+		}));
+
+		for (int i = 0; i < n; i++)
+			log_assert(ids[i].empty());
+
+		if (threads == 1)
+			break;
+	}
+}
+
+// -------------------------------------------------------------------------
+// bench -calc
+// -------------------------------------------------------------------------
+
+static void bench_calc(int n, int width)
+{
+	static const char *cell_types[] = {
+		"$not", "$pos", "$neg", "$and", "$or", "$xor", "$xnor",
+		"$reduce_and", "$reduce_or", "$reduce_xor", "$reduce_xnor", "$reduce_bool",
+		"$logic_not", "$logic_and", "$logic_or", "$shl", "$shr", "$sshl", "$sshr",
+		"$lt", "$le", "$eq", "$ne", "$eqx", "$nex", "$ge", "$gt",
+		"$add", "$sub", "$mul", "$div", "$mod", "$divfloor", "$modfloor",
+	};
+
+	// Operands are random, fully defined and alternate between unsigned and
+	// signed. Shift amounts only have enough bits to cover the width.
+	uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+	auto rng = [&]() {
+		rng_state ^= rng_state << 13;
+		rng_state ^= rng_state >> 7;
+		rng_state ^= rng_state << 17;
+		return rng_state;
+	};
+	auto random_const = [&](int w) {
+		std::vector<uint64_t> words((w + 63) / 64);
+		for (auto &word : words)
+			word = rng();
+		return RTLIL::Const::from_words(words, w);
+	};
+
+	int shift_width = ceil_log2(width) + 1;
+	std::vector<RTLIL::Const> args_a, args_b, args_shift;
+	for (int i = 0; i < n; i++) {
+		args_a.push_back(random_const(width));
+		args_b.push_back(random_const(width));
+		args_shift.push_back(random_const(shift_width));
+	}
+
+	log("Evaluating %d random %d-bit operands per cell type:\n", n, width);
+
+	bool old_word_ops = RTLIL::const_word_ops;
+	std::vector<RTLIL::Const> results_big(n), results_words(n);
+
+	for (auto type_str : cell_types)
+	{
+		RTLIL::IdString type = type_str;
+		bool is_shift = type.in(ID($shl), ID($shr), ID($sshl), ID($sshr));
+		const std::vector<RTLIL::Const> &args_2 = is_shift ? args_shift : args_b;
+
+		auto run = [&](std::vector<RTLIL::Const> &results) {
+			return wall_time([&]() {
+				for (int i = 0; i < n; i++)
+					results[i] = CellTypes::eval(type, args_a[i], args_2[i], i & 1, i & 1, width);
+			});
+		};
+
+		RTLIL::const_word_ops = false;
+		double seconds_big = run(results_big);
+		RTLIL::const_word_ops = true;
+		double seconds_words = run(results_words);
+
+		for (int i = 0; i < n; i++)
+			if (results_big[i] != results_words[i])
+				log_error("Result mismatch for %s with A=%s and B=%s: %s (BigInteger) vs %s (words).\n", log_id(type),
+						args_a[i].as_string().c_str(), args_2[i].as_string().c_str(),
+						results_big[i].as_string().c_str(), results_words[i].as_string().c_str());
+
+		log("  %-14s BigInteger %10.3f ms, words %10.3f ms, speedup %6.2fx\n", type_str,
+				seconds_big * 1e3, seconds_words * 1e3, seconds_words > 0 ? seconds_big / seconds_words : 0.0);
+	}
+
+	RTLIL::const_word_ops = old_word_ops;
+}
+
+// -------------------------------------------------------------------------
+// bench -hashlib
+// -------------------------------------------------------------------------
+
+// keeps the compiler from optimizing the lookups away
+static volatile int64_t hashlib_sink;
+
+template<typename DICT, typename K>
+static void bench_dict(const char *impl, const std::vector<K> &keys, const std::vector<K> &misses)
+{
+	DICT d;
+	int n = GetSize(keys);
+	int64_t sum = 0;
+
+	report("insert", impl, 1, n, wall_time([&]() {
+		for (int i = 0; i < n; i++)
+			d[keys[i]] = i;
+	}));
+	report("lookup", impl, 1, n, wall_time([&]() {
+		for (auto &key : keys)
+			sum += d.at(key);
+	}));
+	report("miss", impl, 1, n, wall_time([&]() {
+		for (auto &key : misses)
+			sum += d.count(key);
+	}));
+	report("iterate", impl, 1, n, wall_time([&]() {
+		for (auto &it : d)
+			sum += it.second;
+	}));
+	report("copy", impl, 1, n, wall_time([&]() {
+		DICT copy = d;
+		sum += copy.size();
+	}));
+	report("erase", impl, 1, n / 2, wall_time([&]() {
+		for (int i = 0; i < n; i += 2)
+			sum += d.erase(keys[i]);
+	}));
+
+	hashlib_sink = sum;
+}
+
+template<typename POOL, typename K>
+static void bench_pool(const char *impl, const std::vector<K> &keys, const std::vector<K> &misses)
+{
+	POOL p;
+	int n = GetSize(keys);
+	int64_t sum = 0;
+
+	report("insert", impl, 1, n, wall_time([&]() {
+		for (auto &key : keys)
+			p.insert(key);
+	}));
+	report("lookup", impl, 1, n, wall_time([&]() {
+		for (auto &key : keys)
+			sum += p.count(key);
+	}));
+	report("miss", impl, 1, n, wall_time([&]() {
+		for (auto &key : misses)
+			sum += p.count(key);
+	}));
+	report("erase", impl, 1, n / 2, wall_time([&]() {
+		for (int i = 0; i < n; i += 2)
+			sum += p.erase(keys[i]);
+	}));
+
+	hashlib_sink = sum;
+}
+
+// union-find over SigBits, as used by SigMap. Key i is merged with the
+// earlier key partners[i].
+template<typename MFP>
+static void bench_mfp(const char *impl, const std::vector<RTLIL::SigBit> &keys, const std::vector<int> &partners)
+{
+	MFP m;
+	int n = GetSize(keys);
+	int64_t sum = 0;
+
+	report("merge", impl, 1, n, wall_time([&]() {
+		for (int i = 1; i < n; i++)
+			m.merge(keys[i], keys[partners[i]]);
+	}));
+	report("find", impl, 1, n, wall_time([&]() {
+		for (auto &key : keys)
+			sum += m.find(key).offset;
+	}));
+
+	hashlib_sink = sum;
+}
+
+static void bench_hashlib(int n)
+{
+	uint32_t rng_state = 123456789;
+	auto rng = [&]() {
+		rng_state = mkhash_xorshift(rng_state);
+		return rng_state;
+	};
+
+	std::vector<int> int_keys, int_misses;
+	pool<int> used;
+	while (GetSize(int_keys) < n) {
+		int key = rng() & 0x7fffffff;
+		if (used.insert(key).second)
+			int_keys.push_back(key);
+	}
+	while (GetSize(int_misses) < n) {
+		int key = rng() & 0x7fffffff;
+		if (!used.count(key))
+			int_misses.push_back(key);
+	}
+
+	RTLIL::Design *scratch = new RTLIL::Design;
+	RTLIL::Module *module = scratch->addModule(ID(bench));
+	std::vector<RTLIL::SigBit> bit_keys, bit_misses;
+	for (int i = 0; i < (n + 31) / 32; i++) {
+		RTLIL::Wire *wire = module->addWire(NEW_ID, 32);
+		RTLIL::Wire *other = module->addWire(NEW_ID, 32);
+		for (int j = 0; j < 32; j++) {
+			bit_keys.push_back(RTLIL::SigBit(wire, j));
+			bit_misses.push_back(RTLIL::SigBit(other, j));
+		}
+	}
+	bit_keys.resize(n);
+	bit_misses.resize(n);
+
+	std::vector<int> mfp_partners(n);
+	for (int i = 1; i < n; i++)
+		mfp_partners[i] = rng() % i;
+
+	log("Running hashlib operations on %d int keys:\n", n);
+	bench_dict<dict<int, int>>("dict", int_keys, int_misses);
+	bench_dict<flat_dict<int, int>>("flat_dict", int_keys, int_misses);
+	bench_pool<pool<int>>("pool", int_keys, int_misses);
+	bench_pool<flat_pool<int>>("flat_pool", int_keys, int_misses);
+
+	log("Running hashlib operations on %d SigBit keys:\n", n);
+	bench_dict<dict<RTLIL::SigBit, int>>("dict", bit_keys, bit_misses);
+	bench_dict<flat_dict<RTLIL::SigBit, int>>("flat_dict", bit_keys, bit_misses);
+	bench_pool<pool<RTLIL::SigBit>>("pool", bit_keys, bit_misses);
+	bench_pool<flat_pool<RTLIL::SigBit>>("flat_pool", bit_keys, bit_misses);
+	bench_mfp<mfp<RTLIL::SigBit>>("mfp", bit_keys, mfp_partners);
+	bench_mfp<mfp<RTLIL::SigBit, hash_ops<RTLIL::SigBit>, flat_pool<RTLIL::SigBit>>>("mfp/flat_pool", bit_keys, mfp_partners);
+
+	delete scratch;
+}
+
+// -------------------------------------------------------------------------
+// bench -sigspec
+// -------------------------------------------------------------------------
+
+static void bench_sigspec(RTLIL::Design *design)
+{
+	std::vector<std::pair<RTLIL::Module*, const RTLIL::SigSpec*>> sigs;
+	int num_cells = 0, num_conns = 0;
+	int64_t num_bits = 0;
+
+	for (auto module : design->selected_modules()) {
+		for (auto cell : module->selected_cells()) {
+			for (auto &conn : cell->connections())
+				sigs.push_back(std::make_pair(module, &conn.second));
+			num_cells++;
+		}
+		for (auto &conn : module->connections()) {
+			sigs.push_back(std::make_pair(module, &conn.first));
+			sigs.push_back(std::make_pair(module, &conn.second));
+			num_conns++;
+		}
+	}
+
+	if (sigs.empty())
+		log_cmd_error("No selected cells or connections.\n");
+
+	int num_inline = 0;
+	std::pair<int, size_t> vector_heap, inline_heap;
+	for (auto &it : sigs) {
+		auto v = it.second->heap_usage(true);
+		auto i = it.second->heap_usage();
+		vector_heap.first += v.first, vector_heap.second += v.second;
+		inline_heap.first += i.first, inline_heap.second += i.second;
+		if (i.first == 0)
+			num_inline++;
+		num_bits += it.second->size();
+	}
+
+	// the inline storage makes the SigSpec objects themselves larger
+	size_t inline_object = sizeof(RTLIL::SigSpec);
+	size_t vector_object = inline_object - sizeof(RTLIL::SigSpec::chunk_vector) - sizeof(RTLIL::SigSpec::bit_vector) +
+			sizeof(std::vector<RTLIL::SigChunk>) + sizeof(std::vector<RTLIL::SigBit>);
+
+	log("Memory used by %d SigSpecs (%lld bits) on %d cells and %d connections:\n",
+			GetSize(sigs), (long long)num_bits, num_cells, num_conns);
+	log("  %-14s %12s %14s %14s\n", "storage", "allocations", "heap bytes", "total bytes");
+	log("  %-14s %12d %14zu %14zu\n", "std::vector", vector_heap.first, vector_heap.second,
+			vector_heap.second + sigs.size() * vector_object);
+	log("  %-14s %12d %14zu %14zu\n", "small_vector", inline_heap.first, inline_heap.second,
+			inline_heap.second + sigs.size() * inline_object);
+	log("  %d of %d SigSpecs (%.1f%%) need no heap allocation.\n", num_inline, GetSize(sigs),
+			100.0 * num_inline / GetSize(sigs));
+
+	dict<RTLIL::Module*, SigMap> sigmaps;
+	for (auto &it : sigs)
+		if (!sigmaps.count(it.first))
+			sigmaps[it.first].set(it.first);
+
+	int64_t sum = 0;
+	log("Running SigSpec operations on the selected signals:\n");
+	report("copy", "SigSpec", 1, sigs.size(), wall_time([&]() {
+		for (auto &it : sigs) {
+			RTLIL::SigSpec sig = *it.second;
+			sum += sig.size();
+		}
+	}));
+	report("sigmap", "SigSpec", 1, sigs.size(), wall_time([&]() {
+		for (auto &it : sigs)
+			sum += sigmaps.at(it.first)(*it.second).size();
+	}));
+	report("extract", "SigSpec", 1, num_bits, wall_time([&]() {
+		for (auto &it : sigs)
+			for (int i = 0; i < it.second->size(); i++)
+				sum += it.second->extract(i).size();
+	}));
+	hashlib_sink = sum;
+}
+
+// -------------------------------------------------------------------------
+// bench -opt_merge
+// -------------------------------------------------------------------------
+
+// A random gate-level netlist with n cells in a scratch design. Every fourth
+// gate duplicates an earlier one (with A and B swapped where commutative), so
+// that merging ripples through the fan-out of the duplicates. The gates are
+// returned in topological order in gates_out.
+static RTLIL::Module *bench_netlist(RTLIL::Design *scratch, int n, std::vector<RTLIL::Cell*> *gates_out = nullptr)
+{
+	static const char *gate_types[] = { "$_AND_", "$_OR_", "$_XOR_", "$_MUX_", "$_NOT_" };
+
+	uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+	auto rng = [&]() {
+		rng_state ^= rng_state << 13;
+		rng_state ^= rng_state >> 7;
+		rng_state ^= rng_state << 17;
+		return rng_state;
+	};
+
+	RTLIL::Module *module = scratch->addModule(ID(bench));
+
+	std::vector<RTLIL::SigBit> bits;
+	for (int i = 0; i < std::max(16, n / 16); i++) {
+		RTLIL::Wire *wire = module->addWire(stringf("\\in%d", i));
+		wire->port_input = true;
+		bits.push_back(wire);
+	}
+
+	std::vector<RTLIL::Cell*> gates;
+	for (int i = 0; i < n; i++) {
+		RTLIL::Cell *cell;
+		if (i % 4 == 3) {
+			RTLIL::Cell *orig = gates[rng() % gates.size()];
+			cell = module->addCell(NEW_ID, orig->type);
+			for (auto &it : orig->connections())
+				if (it.first != ID::Y)
+					cell->setPort(it.first, it.second);
+			if (cell->type.in(ID($_AND_), ID($_OR_), ID($_XOR_))) {
+				cell->setPort(ID::A, orig->getPort(ID::B));
+				cell->setPort(ID::B, orig->getPort(ID::A));
+			}
+		} else {
+			cell = module->addCell(NEW_ID, gate_types[rng() % 5]);
+			cell->setPort(ID::A, bits[rng() % bits.size()]);
+			if (cell->type != ID($_NOT_))
+				cell->setPort(ID::B, bits[rng() % bits.size()]);
+			if (cell->type == ID($_MUX_))
+				cell->setPort(ID::S, bits[rng() % bits.size()]);
+		}
+		RTLIL::Wire *y = module->addWire(NEW_ID);
+		cell->setPort(ID::Y, y);
+		bits.push_back(y);
+		gates.push_back(cell);
+	}
+	for (int i = 0; i < 64 && i < n; i++)
+		bits[bits.size() - 1 - i].wire->port_output = true;
+	module->fixup_ports();
+
+	if (gates_out)
+		*gates_out = gates;
+	return module;
+}
+
+// The number of cells that opt_merge should remove from a bench_netlist(),
+// found without any of its machinery: with the gates in topological order, a
+// single pass that maps the output of each gate to the output of the first
+// identical gate finds all merges.
+static int bench_netlist_merges(const std::vector<RTLIL::Cell*> &gates)
+{
+	dict<RTLIL::SigBit, RTLIL::SigBit> merged;
+	dict<std::pair<RTLIL::IdString, std::vector<RTLIL::SigBit>>, RTLIL::SigBit> first_gate;
+	int merges = 0;
+
+	for (auto cell : gates) {
+		std::vector<RTLIL::SigBit> inputs;
+		for (auto port : {ID::A, ID::B, ID::S})
+			if (cell->hasPort(port)) {
+				RTLIL::SigBit bit = cell->getPort(port);
+				inputs.push_back(merged.count(bit) ? merged.at(bit) : bit);
+			}
+		if (cell->type.in(ID($_AND_), ID($_OR_), ID($_XOR_)) && inputs[1] < inputs[0])
+			std::swap(inputs[0], inputs[1]);
+
+		RTLIL::SigBit y = cell->getPort(ID::Y);
+		auto key = std::make_pair(cell->type, inputs);
+		if (first_gate.count(key)) {
+			merged[y] = first_gate.at(key);
+			merges++;
+		} else
+			first_gate[key] = y;
+	}
+
+	return merges;
+}
+
+static void bench_opt_merge(int n)
+{
+	RTLIL::Design *scratch = new RTLIL::Design;
+	std::vector<RTLIL::Cell*> gates;
+	RTLIL::Module *module = bench_netlist(scratch, n, &gates);
+
+	int cells_before = GetSize(module->cells());
+	int expected_merges = bench_netlist_merges(gates);
+	log("Merging identical cells in a %d cell gate-level netlist:\n", cells_before);
+
+	double seconds = wall_time([&]() {
+		log_push();
+		Pass::call_on_module(scratch, module, "opt_merge");
+		log_pop();
+	});
+
+	report("opt_merge", "cells", 1, cells_before, seconds);
+	int merges = cells_before - GetSize(module->cells());
+	log("  removed %d cells.\n", merges);
+	if (merges != expected_merges)
+		log_error("opt_merge removed %d cells, but %d cells are duplicates.\n", merges, expected_merges);
+
+	delete scratch;
+}
+
+// -------------------------------------------------------------------------
+// bench -modgraph
+// -------------------------------------------------------------------------
+
+static void bench_modgraph(int n)
+{
+	RTLIL::Design *scratch = new RTLIL::Design;
+	RTLIL::Module *module = bench_netlist(scratch, n);
+
+	log("Traversing the fan-out cone of the inputs of a %d cell gate-level netlist:\n", n);
+
+	int hashed_count = 0, graph_count = 0;
+	{
+		SigMap sigmap;
+		dict<SigBit, std::vector<Cell*>> consumers;
+		dict<Cell*, std::vector<SigBit>> outputs;
+
+		report("build", "dict/pool", 1, n, wall_time([&]() {
+			sigmap.set(module);
+			for (auto cell : module->cells())
+			for (auto &conn : cell->connections())
+			for (auto bit : sigmap(conn.second)) {
+				if (bit.wire == nullptr)
+					continue;
+				if (cell->input(conn.first))
+					consumers[bit].push_back(cell);
+				if (cell->output(conn.first))
+					outputs[cell].push_back(bit);
+			}
+		}));
+
+		report("traverse", "dict/pool", 1, n, wall_time([&]() {
+			pool<SigBit> visited;
+			std::vector<SigBit> queue;
+			for (auto wire : module->wires())
+				if (wire->port_input)
+					for (auto bit : sigmap(wire))
+						if (visited.insert(bit).second)
+							queue.push_back(bit);
+			while (!queue.empty()) {
+				SigBit bit = queue.back();
+				queue.pop_back();
+				auto it = consumers.find(bit);
+				if (it == consumers.end())
+					continue;
+				for (auto cell : it->second)
+					for (auto out : outputs.at(cell))
+						if (visited.insert(out).second)
+							queue.push_back(out);
+			}
+			hashed_count = GetSize(visited);
+		}));
+	}
+
+	{
+		ModGraph *graph = nullptr;
+
+		report("build", "ModGraph", 1, n, wall_time([&]() {
+			graph = new ModGraph(module);
+		}));
+
+		report("traverse", "ModGraph", 1, n, wall_time([&]() {
+			std::vector<bool> visited(graph->num_bits());
+			std::vector<int> queue;
+			for (int bit = 0; bit < graph->num_bits(); bit++)
+				if (graph->port_input[bit]) {
+					visited[bit] = true;
+					queue.push_back(bit);
+				}
+			graph_count = GetSize(queue);
+			while (!queue.empty()) {
+				int bit = queue.back();
+				queue.pop_back();
+				for (auto &pb : graph->consumers(bit))
+					for (auto out : graph->outputs(pb.cell))
+						if (!visited[out]) {
+							visited[out] = true;
+							queue.push_back(out);
+							graph_count++;
+						}
+			}
+		}));
+
+		delete graph;
+	}
+
+	if (hashed_count != graph_count)
+		log_error("Fan-out cone size mismatch: %d bits with dict/pool, %d bits with ModGraph.\n", hashed_count, graph_count);
+	log("  visited %d bits.\n", graph_count);
+
+	delete scratch;
+}
+
+// -------------------------------------------------------------------------
+// bench -verilog_lexer
+// -------------------------------------------------------------------------
+
+static void bench_verilog_lexer(int n)
+{
+	RTLIL::Design *scratch = new RTLIL::Design;
+	bench_netlist(scratch, n);
+
+	std::string filename = make_temp_file(get_base_tmpdir() + "/yosys_bench_XXXXXX.v");
+	{
+		std::ofstream f(filename);
+		log_push();
+		Backend::backend_call(scratch, &f, filename, "write_verilog -noattr");
+		log_pop();
+		if (f.fail())
+			log_error("Can't write temporary file `%s'.\n", filename.c_str());
+	}
+	delete scratch;
+
+	std::ifstream f(filename, std::ifstream::ate);
+	double megabytes = f.tellg() * 1e-6;
+	f.close();
+
+	log("Lexing the Verilog code of a %d cell gate-level netlist (%.1f MB):\n", n, megabytes);
+
+	int preproc_tokens = 0, mapped_tokens = 0;
+	double preproc_seconds = wall_time([&]() {
+		preproc_tokens = VERILOG_FRONTEND::lex_file(filename, true);
+	});
+	double mapped_seconds = wall_time([&]() {
+		mapped_tokens = VERILOG_FRONTEND::lex_file(filename, false);
+	});
+	remove(filename.c_str());
+
+	report("lex", "preprocessed", 1, preproc_tokens, preproc_seconds);
+	report("lex", "mmap", 1, mapped_tokens, mapped_seconds);
+
+	if (preproc_tokens != mapped_tokens)
+		log_error("Token count mismatch: %d tokens after pre-processing, %d tokens from the mapped file.\n",
+				preproc_tokens, mapped_tokens);
+	log("  %d tokens, %.1f MB/s pre-processed, %.1f MB/s from the mapped file.\n", mapped_tokens,
+			preproc_seconds > 0 ? megabytes / preproc_seconds : 0.0, mapped_seconds > 0 ? megabytes / mapped_seconds : 0.0);
+}
+
+// -------------------------------------------------------------------------
+// bench -ast
+// -------------------------------------------------------------------------
+
+// The AstNode layout used up to Yosys 0.22, for comparison: every node held
+// its own copy of the file name and the multirange fields.
+struct LegacyAstNodeLayout
+{
+	unsigned int hashidx_;
+	AST::AstNodeType type;
+	std::vector<AST::AstNode*> children;
+	std::map<RTLIL::IdString, AST::AstNode*> attributes;
+	std::string str;
+	std::vector<RTLIL::State> bits;
+	bool is_input, is_output, is_reg, is_logic, is_signed, is_string, is_wand, is_wor, range_valid, range_swapped, was_checked, is_unsized, is_custom_type;
+	int port_id, range_left, range_right;
+	uint32_t integer;
+	double realvalue;
+	bool is_enum;
+	std::vector<int> multirange_dimensions;
+	std::vector<bool> multirange_swapped;
+	AST::AstNode *id2ast;
+	bool basic_prep;
+	bool lookahead;
+	std::string filename;
+	AST::AstSrcLocType location;
+};
+
+// Size of a heap block for n bytes with a glibc style allocator: an 8 byte
+// header, 16 byte alignment and a 32 byte minimum.
+static size_t heap_block_size(size_t n)
+{
+	return std::max<size_t>(32, (n + 8 + 15) & ~size_t(15));
+}
+
+static void bench_ast(const std::vector<std::string> &patterns)
+{
+	std::vector<std::string> files;
+	for (auto &pattern : patterns)
+		for (auto &file : glob_filename(pattern))
+			files.push_back(file);
+	if (files.empty())
+		log_cmd_error("No Verilog files found.\n");
+
+	log("Reading and elaborating %d Verilog files:\n", GetSize(files));
+
+	int num_failed = 0, max_peak = 0;
+	int64_t allocated = 0;
+	double seconds = 0, legacy_bytes = 0, arena_bytes = 0;
+	std::string max_peak_file;
+
+	for (auto &file : files)
+	{
+		RTLIL::Design *scratch = new RTLIL::Design;
+		AST::AstNode::arena_stats_t before = AST::AstNode::arena_stats(true);
+
+		LogCapture capture;
+		bool failed = false;
+		double file_seconds = wall_time([&]() {
+			LogCaptureGuard guard(&capture);
+			try {
+				Pass::call(scratch, std::vector<std::string>{"read_verilog", "-sv", file});
+				Pass::call(scratch, "hierarchy");
+			} catch (log_capture_error_exception &) {
+				failed = true;
+			}
+		});
+		delete scratch;
+
+		if (failed) {
+			num_failed++;
+			continue;
+		}
+
+		// deleting the design must release all nodes of the file
+		AST::AstNode::arena_stats_t after = AST::AstNode::arena_stats();
+		if (after.live != before.live)
+			log_error("%d AST nodes of %s are still live after deleting its design.\n", after.live - before.live, file.c_str());
+		if (after.extra_live != before.extra_live)
+			log_error("%d AST node extras of %s are still live after deleting its design.\n", after.extra_live - before.extra_live, file.c_str());
+
+		int peak = after.peak_live - before.live;
+		allocated += after.allocated - before.allocated;
+		seconds += file_seconds;
+
+		// all nodes of a file carry its name, which the previous layout only
+		// stored inline up to the 15 characters of the std::string SSO buffer
+		size_t legacy_node = heap_block_size(sizeof(LegacyAstNodeLayout));
+		if (file.size() > 15)
+			legacy_node += heap_block_size(file.size() + 1);
+		legacy_bytes += double(peak) * legacy_node;
+
+		// the slabs of the arena, with their unused slots, and the separate
+		// heap blocks of the rarely used node content
+		int peak_extra = after.peak_extra_live - before.extra_live;
+		arena_bytes += double(after.peak_slab_bytes - before.slab_bytes);
+		arena_bytes += double(peak_extra) * heap_block_size(sizeof(AST::AstNodeExtra));
+
+		if (peak > max_peak) {
+			max_peak = peak;
+			max_peak_file = file;
+		}
+	}
+
+	if (num_failed == GetSize(files))
+		log_cmd_error("None of the Verilog files could be elaborated.\n");
+
+	report("ast", "arena", 1, allocated, seconds);
+	log("  %d files elaborated, %d skipped after errors, all AST nodes released.\n", GetSize(files) - num_failed, num_failed);
+	log("  %lld AST nodes allocated, at most %d live at once (%s).\n", (long long)allocated, max_peak, max_peak_file.c_str());
+	log("  node size %zu bytes in the arena, was %zu bytes on the heap plus the file name.\n",
+			sizeof(AST::AstNode), sizeof(LegacyAstNodeLayout));
+	log("  sum of the per-file peak node memory: %.2f MB of arena slabs and extra blocks, estimated %.2f MB with the previous layout.\n",
+			arena_bytes * 1e-6, legacy_bytes * 1e-6);
+}
+
+struct BenchPass : public Pass {
+	BenchPass() : Pass("bench", "run micro benchmarks for kernel data structures") { }
+	void help() override
+	{
+		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
+		log("\n");
+		log("    bench [options] [selection]\n");
+		log("\n");
+		log("Run micro benchmarks for performance critical parts of the Yosys kernel and\n");
+		log("print the wall clock time and throughput for each of them.\n");
+		log("\n");
+		log("    -idstring\n");
+		log("        intern, look up and release IdStrings, comparing the current\n");
+		log("        implementation with the single-table implementation used up to\n");
+		log("        Yosys 0.22 (which needs a global lock for multi-threaded use).\n");
+		log("\n");
+		log("    -calc\n");
+		log("        evaluate every word-level arithmetic and logic cell type on random\n");
+		log("        fully defined operands, once with the BigInteger implementation and\n");
+		log("        once with the word-parallel fast paths in kernel/calc.cc, and check\n");
+		log("        that both produce the same results.\n");
+		log("\n");
+		log("    -hashlib\n");
+		log("        insert, look up, iterate, copy and erase -n int and SigBit keys with\n");
+		log("        dict/pool and the open addressing flat_dict/flat_pool, and build a\n");
+		log("        SigMap-style union-find (mfp) on top of either pool.\n");
+		log("\n");
+		log("    -sigspec\n");
+		log("        report the heap memory used by the signals on the selected cells and\n");
+		log("        the connections of the selected modules, compared to plain std::vector\n");
+		log("        storage, and time copying, SigMap lookup and extract() on them.\n");
+		log("        Run this e.g. after \"techmap\" to measure a gate-level netlist.\n");
+		log("\n");
+		log("    -opt_merge\n");
+		log("        run \"opt_merge\" on a random gate-level netlist with -n cells, a\n");
+		log("        quarter of which are duplicates of other cells, and check that it\n");
+		log("        removes all duplicates.\n");
+		log("\n");
+		log("    -modgraph\n");
+		log("        build a ModGraph and a dict/pool based index for a random gate-level\n");
+		log("        netlist with -n cells and traverse the fan-out cone of its inputs.\n");
+		log("\n");
+		log("    -verilog_lexer\n");
+		log("        write a random gate-level netlist with -n cells as Verilog code and\n");
+		log("        lex it, once after running the pre-processor and once directly from\n");
+		log("        the memory-mapped file, and check that both yield the same number of\n");
+		log("        tokens.\n");
+		log("\n");
+		log("    -ast {pattern}\n");
+		log("        read and elaborate each Verilog file matching the pattern (can be\n");
+		log("        given multiple times) in a scratch design and report the number of\n");
+		log("        AST nodes and the peak AST node memory, compared to an estimate for\n");
+		log("        the node layout and heap allocation used up to Yosys 0.22. Files\n");
+		log("        that do not elaborate on their own are skipped.\n");
+		log("\n");
+		log("    -n {integer}\n");
+		log("        number of items (default = 1000000).\n");
+		log("\n");
+		log("    -width {integer}\n");
+		log("        operand and result width for -calc (default = 32).\n");
+		log("\n");
+		log("    -j {integer}\n");
+		log("        also run the multi-threaded benchmarks with this number of threads\n");
+		log("        (default = number of hardware threads).\n");
+		log("\n");
+	}
+	void execute(std::vector<std::string> args, RTLIL::Design *design) override
+	{
+		bool run_idstring = false;
+		bool run_calc = false;
+		bool run_hashlib = false;
+		bool run_sigspec = false;
+		bool run_opt_merge = false;
+		bool run_modgraph = false;
+		bool run_verilog_lexer = false;
+		std::vector<std::string> ast_patterns;
+		int n = 1000000;
+		int width = 32;
+		int threads = hardware_threads();
+
+		log_header(design, "Executing BENCH pass.\n");
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++)
+		{
+			if (args[argidx] == "-idstring") {
+				run_idstring = true;
+				continue;
+			}
+			if (args[argidx] == "-calc") {
+				run_calc = true;
+				continue;
+			}
+			if (args[argidx] == "-hashlib") {
+				run_hashlib = true;
+				continue;
+			}
+			if (args[argidx] == "-sigspec") {
+				run_sigspec = true;
+				continue;
+			}
+			if (args[argidx] == "-opt_merge") {
+				run_opt_merge = true;
+				continue;
+			}
+			if (args[argidx] == "-modgraph") {
+				run_modgraph = true;
+				continue;
+			}
+			if (args[argidx] == "-verilog_lexer") {
+				run_verilog_lexer = true;
+				continue;
+			}
+			if (args[argidx] == "-ast" && argidx+1 < args.size()) {
+				ast_patterns.push_back(args[++argidx]);
+				continue;
+			}
+			if (args[argidx] == "-n" && argidx+1 < args.size()) {
+				n = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-width" && argidx+1 < args.size()) {
+				width = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-j" && argidx+1 < args.size()) {
+				threads = atoi(args[++argidx].c_str());
+				continue;
+			}
+			break;
+		}
+		extra_args(args, argidx, design);
+
+		if (n < 1)
+			log_cmd_error("Invalid number of items: %d\n", n);
+		if (width < 1)
+			log_cmd_error("Invalid width: %d\n", width);
+		if (threads < 1)
+			threads = 1;
+
+		if (!run_idstring && !run_calc && !run_hashlib && !run_sigspec && !run_opt_merge && !run_modgraph && !run_verilog_lexer && ast_patterns.empty())
+			log_cmd_error("No benchmark selected.\n");
+
+		if (run_idstring)
+			bench_idstring(n, threads);
+		if (run_calc)
+			bench_calc(n, width);
+		if (run_hashlib)
+			bench_hashlib(n);
+		if (run_sigspec)
+			bench_sigspec(design);
+		if (run_opt_merge)
+			bench_opt_merge(n);
+		if (run_modgraph)
+			bench_modgraph(n);
+		if (run_verilog_lexer)
+			bench_verilog_lexer(n);
+		if (!ast_patterns.empty())
+			bench_ast(ast_patterns);
+	}
+} BenchPass;
+
+PRIVATE_NAMESPACE_END
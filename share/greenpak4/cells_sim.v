@@ -0,0 +1,5 @@
+`timescale 1ns/1ps
+
+`include "cells_sim_ams.v"
+`include "cells_sim_digital.v"
+`include "cells_sim_wip.v"
@@ -0,0 +1,278 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+YOSYS_NAMESPACE_BEGIN
+
+// A vector that stores up to N elements inline and only allocates heap
+// memory when it grows beyond that. It implements the subset of the
+// std::vector interface used with RTLIL::SigSpec chunks and bits, and
+// converts to a std::vector where one is needed.
+template<typename T, int N>
+class small_vector
+{
+	T *data_;
+	int size_, capacity_;
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type inline_[N];
+
+	T *inline_data() { return reinterpret_cast<T*>(inline_); }
+
+	static T *allocate(int capacity) {
+		return static_cast<T*>(::operator new(sizeof(T) * capacity));
+	}
+
+	void release() {
+		if (!is_inline())
+			::operator delete(data_);
+		data_ = inline_data();
+		capacity_ = N;
+	}
+
+	void reallocate(int new_capacity) {
+		T *new_data = allocate(new_capacity);
+		for (int i = 0; i < size_; i++) {
+			new (new_data + i) T(std::move(data_[i]));
+			data_[i].~T();
+		}
+		release();
+		data_ = new_data;
+		capacity_ = new_capacity;
+	}
+
+	void grow() {
+		reallocate(2 * capacity_);
+	}
+
+	// take the contents of other, leaving it empty
+	void take(small_vector &other) {
+		if (other.is_inline()) {
+			for (int i = 0; i < other.size_; i++) {
+				new (data_ + i) T(std::move(other.data_[i]));
+				other.data_[i].~T();
+			}
+		} else {
+			data_ = other.data_;
+			capacity_ = other.capacity_;
+			other.data_ = other.inline_data();
+			other.capacity_ = N;
+		}
+		size_ = other.size_;
+		other.size_ = 0;
+	}
+
+public:
+	typedef T value_type;
+	typedef T &reference;
+	typedef const T &const_reference;
+	typedef T *iterator;
+	typedef const T *const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	small_vector() : data_(inline_data()), size_(0), capacity_(N) { }
+
+	small_vector(const small_vector &other) : small_vector() {
+		insert(end(), other.begin(), other.end());
+	}
+
+	small_vector(small_vector &&other) : small_vector() {
+		take(other);
+	}
+
+	small_vector(std::initializer_list<T> list) : small_vector() {
+		insert(end(), list.begin(), list.end());
+	}
+
+	template<typename It>
+	small_vector(It first, It last) : small_vector() {
+		insert(end(), first, last);
+	}
+
+	~small_vector() {
+		clear();
+		release();
+	}
+
+	small_vector &operator=(const small_vector &other) {
+		if (this != &other) {
+			clear();
+			insert(end(), other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	small_vector &operator=(small_vector &&other) {
+		if (this != &other) {
+			clear();
+			release();
+			take(other);
+		}
+		return *this;
+	}
+
+	operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
+
+	bool is_inline() const { return data_ == reinterpret_cast<const T*>(inline_); }
+	size_t heap_size() const { return is_inline() ? 0 : sizeof(T) * capacity_; }
+
+	size_t size() const { return size_; }
+	size_t capacity() const { return capacity_; }
+	bool empty() const { return size_ == 0; }
+
+	T *data() { return data_; }
+	const T *data() const { return data_; }
+
+	iterator begin() { return data_; }
+	iterator end() { return data_ + size_; }
+	const_iterator begin() const { return data_; }
+	const_iterator end() const { return data_ + size_; }
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+	T &operator[](size_t index) { return data_[index]; }
+	const T &operator[](size_t index) const { return data_[index]; }
+
+	T &at(size_t index) {
+		if (index >= size_t(size_))
+			throw std::out_of_range("small_vector::at()");
+		return data_[index];
+	}
+
+	const T &at(size_t index) const {
+		if (index >= size_t(size_))
+			throw std::out_of_range("small_vector::at()");
+		return data_[index];
+	}
+
+	T &front() { return data_[0]; }
+	T &back() { return data_[size_ - 1]; }
+	const T &front() const { return data_[0]; }
+	const T &back() const { return data_[size_ - 1]; }
+
+	void reserve(size_t n) {
+		if (int(n) > capacity_)
+			reallocate(n);
+	}
+
+	void clear() {
+		for (int i = 0; i < size_; i++)
+			data_[i].~T();
+		size_ = 0;
+	}
+
+	void resize(size_t n) {
+		while (size_ > int(n))
+			data_[--size_].~T();
+		reserve(n);
+		while (size_ < int(n))
+			new (data_ + size_++) T();
+	}
+
+	template<typename... Args>
+	void emplace_back(Args&&... args) {
+		if (size_ == capacity_) {
+			// args may refer to an element of this vector
+			T value(std::forward<Args>(args)...);
+			grow();
+			new (data_ + size_++) T(std::move(value));
+		} else
+			new (data_ + size_++) T(std::forward<Args>(args)...);
+	}
+
+	void push_back(const T &value) { emplace_back(value); }
+	void push_back(T &&value) { emplace_back(std::move(value)); }
+
+	void pop_back() {
+		data_[--size_].~T();
+	}
+
+	template<typename It>
+	iterator insert(const_iterator pos, It first, It last) {
+		int idx = pos - data_;
+		int n = std::distance(first, last);
+		if (size_ + n > capacity_) {
+			// copy the new elements first, [first, last) may be part of this vector
+			int new_capacity = std::max(size_ + n, 2 * capacity_);
+			T *new_data = allocate(new_capacity);
+			T *p = new_data + idx;
+			for (It it = first; it != last; ++it)
+				new (p++) T(*it);
+			for (int i = 0; i < size_; i++) {
+				new (new_data + (i < idx ? i : i + n)) T(std::move(data_[i]));
+				data_[i].~T();
+			}
+			release();
+			data_ = new_data;
+			capacity_ = new_capacity;
+			size_ += n;
+		} else {
+			for (It it = first; it != last; ++it)
+				new (data_ + size_++) T(*it);
+			std::rotate(data_ + idx, data_ + size_ - n, data_ + size_);
+		}
+		return data_ + idx;
+	}
+
+	iterator erase(const_iterator first, const_iterator last) {
+		T *p = data_ + (first - data_);
+		int n = last - first;
+		std::move(p + n, end(), p);
+		for (int i = 0; i < n; i++)
+			data_[--size_].~T();
+		return p;
+	}
+
+	iterator erase(const_iterator pos) {
+		return erase(pos, pos + 1);
+	}
+
+	void swap(small_vector &other) {
+		small_vector tmp(std::move(other));
+		other = std::move(*this);
+		*this = std::move(tmp);
+	}
+
+	bool operator==(const small_vector &other) const {
+		return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+	}
+
+	bool operator!=(const small_vector &other) const {
+		return !(*this == other);
+	}
+
+	bool operator<(const small_vector &other) const {
+		return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+	}
+};
+
+YOSYS_NAMESPACE_END
+
+#endif
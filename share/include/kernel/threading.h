@@ -0,0 +1,93 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+
+#ifndef THREADING_H
+#define THREADING_H
+
+#ifndef YOSYS_DISABLE_THREADS
+#  include <atomic>
+#  include <condition_variable>
+#  include <deque>
+#  include <exception>
+#  include <mutex>
+#  include <thread>
+#endif
+
+YOSYS_NAMESPACE_BEGIN
+
+// Number of worker threads used for parallel execution (set with "yosys -j").
+// A value of 1 (the default) disables all threading.
+extern int yosys_threads;
+
+// Number of hardware threads, or 1 if this can not be determined.
+int hardware_threads();
+
+#ifndef YOSYS_DISABLE_THREADS
+
+// A fixed-size pool of worker threads. run() spreads the tasks round-robin
+// over one queue per worker. Workers take tasks from the back of their own
+// queue and steal from the front of the other queues once theirs runs dry,
+// so a few expensive tasks do not leave the rest of the pool idle.
+//
+// Tasks must not call run() on the same pool. An exception thrown by a task
+// is rethrown by run() after all other tasks have completed.
+struct ThreadPool
+{
+	ThreadPool(int num_threads);
+	~ThreadPool();
+
+	int size() const { return GetSize(workers); }
+	void run(int num_tasks, const std::function<void(int)> &task);
+
+private:
+	struct worker_queue_t {
+		std::mutex mutex;
+		std::deque<int> tasks;
+	};
+
+	std::vector<std::thread> workers;
+	std::vector<worker_queue_t> queues;
+
+	std::mutex mutex;
+	std::condition_variable work_cv, done_cv;
+	const std::function<void(int)> *current_task;
+	unsigned int generation;
+	int pending_tasks, active_workers;
+	bool shutdown;
+	std::exception_ptr first_exception;
+
+	bool take_task(int worker_idx, int &task_idx);
+	void worker_main(int worker_idx);
+};
+
+#endif
+
+// Run task(0) .. task(num_tasks-1) on the global thread pool and wait for
+// them to finish. Runs everything on the calling thread if threading is
+// disabled, yosys_threads is 1 or there is only a single task.
+void parallel_for(int num_tasks, const std::function<void(int)> &task);
+
+// Shut down the global thread pool (called from yosys_shutdown()).
+void parallel_shutdown();
+
+YOSYS_NAMESPACE_END
+
+#endif
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include "kernel/yosys.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+TEST(KernelArenaTest, ObjectArena)
+{
+	object_arena<std::string> arena;
+	std::vector<std::string*> objects;
+
+	for (int i = 0; i < 1000; i++)
+		objects.push_back(new (arena.allocate()) std::string(std::to_string(i)));
+	EXPECT_EQ(arena.num_objects(), 1000);
+	// slabs of 16, 32, 64, ... objects
+	EXPECT_EQ(arena.num_slabs(), 6);
+	EXPECT_GE(arena.slab_bytes(), 1000 * sizeof(std::string));
+
+	for (int i = 0; i < 1000; i += 2) {
+		objects[i]->~basic_string();
+		arena.deallocate(objects[i]);
+	}
+	EXPECT_EQ(arena.num_objects(), 500);
+
+	// released memory is reused before new slabs are added
+	for (int i = 0; i < 1000; i += 2)
+		objects[i] = new (arena.allocate()) std::string("x");
+	EXPECT_EQ(arena.num_slabs(), 6);
+
+	for (int i = 0; i < 1000; i++)
+		EXPECT_EQ(*objects[i], i % 2 ? std::to_string(i) : "x");
+	for (auto obj : objects)
+		obj->~basic_string();
+}
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "kernel/yosys.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+// Random inserts and erases must leave flat_dict and dict with the same
+// contents in the same iteration order.
+TEST(KernelHashlibTest, FlatDictMatchesDict)
+{
+	dict<int, int> ref;
+	flat_dict<int, int> flat;
+
+	uint32_t rng = 123456789;
+	for (int i = 0; i < 200000; i++) {
+		rng = mkhash_xorshift(rng);
+		int key = rng % 5000;
+		switch (rng >> 29) {
+		case 0:
+		case 1:
+			EXPECT_EQ(ref.erase(key), flat.erase(key));
+			break;
+		case 2:
+			EXPECT_EQ(ref.count(key), flat.count(key));
+			break;
+		default:
+			ref[key] += i;
+			flat[key] += i;
+		}
+		if (i % 10000 == 0) {
+			ASSERT_EQ(ref.size(), flat.size());
+			auto it = flat.begin();
+			for (auto &entry : ref) {
+				ASSERT_EQ(entry, *it);
+				++it;
+			}
+		}
+	}
+
+	flat_dict<int, int> copy = flat;
+	for (auto &entry : ref)
+		EXPECT_EQ(copy.at(entry.first), entry.second);
+
+	flat.sort();
+	ref.sort();
+	auto it = flat.begin();
+	for (auto &entry : ref) {
+		EXPECT_EQ(entry, *it);
+		++it;
+	}
+}
+
+TEST(KernelHashlibTest, FlatPool)
+{
+	flat_pool<std::string> flat;
+	pool<std::string> ref;
+	for (int i = 0; i < 1000; i++) {
+		flat.insert(std::to_string(i * 7 % 300));
+		ref.insert(std::to_string(i * 7 % 300));
+	}
+	EXPECT_EQ(flat.size(), 300u);
+	EXPECT_EQ(flat.count("21"), 1);
+	EXPECT_EQ(flat.count("300"), 0);
+	while (!ref.empty())
+		EXPECT_EQ(flat.pop(), ref.pop());
+	EXPECT_TRUE(flat.empty());
+
+	// idict and mfp on top of flat_pool
+	mfp<int, hash_ops<int>, flat_pool<int>> m;
+	m.merge(1, 2);
+	m.merge(3, 4);
+	m.merge(2, 4);
+	m.promote(3);
+	EXPECT_EQ(m.find(1), 3);
+	EXPECT_EQ(m.find(5), 5);
+}
+
+YOSYS_NAMESPACE_END
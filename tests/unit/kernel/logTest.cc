@@ -11,4 +11,53 @@ TEST(KernelLogTest, logvValidValues)
 	EXPECT_EQ(7, 7);
 }
 
+// Headers logged under a capture (e.g. by a module-local pass running on a
+// worker thread) are numbered the same way as in a serial run.
+TEST(KernelLogTest, CaptureReplaysHeaders)
+{
+	auto run = [] {
+		log("Before.\n");
+		log_push();
+		log_header(nullptr, "Nested header.\n");
+		log("Message.\n");
+		log_pop();
+	};
+
+	std::ostringstream serial, replayed;
+	log_streams.push_back(&serial);
+	run();
+	log_streams.pop_back();
+
+	LogCapture capture;
+	log_capture_begin(&capture);
+	run();
+	log_capture_end();
+	EXPECT_EQ(std::get<0>(capture.messages[2]), LogCapture::HEADER);
+
+	log_streams.push_back(&replayed);
+	capture.replay();
+	log_streams.pop_back();
+
+	EXPECT_NE(serial.str().find("1. Nested header."), std::string::npos);
+	EXPECT_EQ(serial.str(), replayed.str());
+}
+
+TEST(KernelLogTest, CaptureGuardEndsOnException)
+{
+	LogCapture capture;
+	try {
+		LogCaptureGuard guard(&capture);
+		log("Captured.\n");
+		throw std::runtime_error("not a log error");
+	} catch (std::runtime_error &) {
+	}
+	EXPECT_EQ(GetSize(capture.messages), 1);
+
+	std::ostringstream out;
+	log_streams.push_back(&out);
+	log("Not captured.\n");
+	log_streams.pop_back();
+	EXPECT_EQ(out.str(), "Not captured.\n");
+}
+
 YOSYS_NAMESPACE_END
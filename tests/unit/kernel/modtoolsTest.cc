@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "kernel/yosys.h"
+#include "kernel/modtools.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+TEST(KernelModtoolsTest, ModGraph)
+{
+	RTLIL::Design *design = new RTLIL::Design;
+	RTLIL::Module *module = design->addModule("\\top");
+	RTLIL::Wire *a = module->addWire("\\a");
+	RTLIL::Wire *b = module->addWire("\\b");
+	RTLIL::Wire *c = module->addWire("\\c", 2);
+	RTLIL::Wire *d = module->addWire("\\d");
+	a->port_input = true;
+	c->port_output = true;
+	module->fixup_ports();
+	module->connect(d, b);
+
+	RTLIL::Cell *inv = module->addNotGate(NEW_ID, a, b);
+	RTLIL::Cell *gate = module->addAndGate(NEW_ID, d, a, RTLIL::SigBit(c, 0));
+	module->connect(RTLIL::SigBit(c, 1), State::S1);
+
+	ModGraph graph(module);
+	EXPECT_EQ(graph.num_cells(), 2);
+
+	int bit_a = graph.bit_id(a), bit_b = graph.bit_id(b), bit_c0 = graph.bit_id(RTLIL::SigBit(c, 0));
+	EXPECT_EQ(graph.bit_id(d), bit_b);
+	EXPECT_EQ(graph.bit_id(RTLIL::SigBit(c, 1)), -1);
+	EXPECT_TRUE(graph.port_input[bit_a]);
+	EXPECT_TRUE(graph.port_output[bit_c0]);
+	EXPECT_FALSE(graph.port_output[bit_b]);
+
+	ASSERT_EQ(graph.consumers(bit_a).size(), 2);
+	ASSERT_EQ(graph.drivers(bit_b).size(), 1);
+	EXPECT_EQ(graph.cell(graph.drivers(bit_b)[0]), inv);
+	EXPECT_EQ(graph.port(graph.drivers(bit_b)[0]), ID::Y);
+	ASSERT_EQ(graph.consumers(bit_b).size(), 1);
+	EXPECT_EQ(graph.cell(graph.consumers(bit_b)[0]), gate);
+	EXPECT_EQ(graph.port(graph.consumers(bit_b)[0]), ID::A);
+	EXPECT_TRUE(graph.drivers(bit_a).empty());
+
+	int gate_id = graph.cell_id(gate);
+	ASSERT_EQ(graph.inputs(gate_id).size(), 2);
+	EXPECT_EQ(std::set<int>(graph.inputs(gate_id).begin(), graph.inputs(gate_id).end()), std::set<int>({bit_a, bit_b}));
+	ASSERT_EQ(graph.outputs(gate_id).size(), 1);
+	EXPECT_EQ(graph.outputs(gate_id)[0], bit_c0);
+
+	delete design;
+}
+
+YOSYS_NAMESPACE_END
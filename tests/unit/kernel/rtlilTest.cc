@@ -11,4 +11,60 @@ TEST(KernelRtlilTest, getReferenceValid)
 	EXPECT_EQ(33, 33);
 }
 
+TEST(KernelRtlilTest, ConstWordOps)
+{
+	RTLIL::Const c = RTLIL::Const::from_string("1011001110001111000011111000001111110000001111111000000011111111010");
+	std::vector<uint64_t> words;
+	ASSERT_TRUE(c.as_words(words));
+	EXPECT_EQ(RTLIL::Const::from_words(words, c.size()), c);
+	EXPECT_EQ(c.extract(3, 20).as_int(), c.as_int() >> 3 & 0xfffff);
+	EXPECT_EQ(c.extract(60, 10, RTLIL::State::Sx).as_string(), "xxx1011001");
+
+	c.bits()[40] = RTLIL::State::Sx;
+	EXPECT_FALSE(c.as_words(words));
+	EXPECT_FALSE(c.is_fully_def());
+	EXPECT_EQ(c.hash(), RTLIL::Const(c.bits()).hash());
+
+	EXPECT_TRUE(RTLIL::Const(RTLIL::State::S0, 77).is_fully_zero());
+	EXPECT_TRUE(RTLIL::Const(RTLIL::State::S1, 77).is_fully_ones());
+	EXPECT_FALSE(RTLIL::Const(0x7fffffff, 77).is_fully_ones());
+	EXPECT_EQ(RTLIL::Const(-5, 12).as_int(true), -5);
+	EXPECT_TRUE(RTLIL::Const(1, 8) < RTLIL::Const(0, 12));
+	EXPECT_FALSE(c < c);
+}
+
+TEST(KernelRtlilTest, ConstPacked)
+{
+	RTLIL::Const c = RTLIL::Const::from_string("1011001110001111000011111000001111110000001111111000000011111111010");
+	RTLIL::Const p = c;
+	p.pack();
+	ASSERT_TRUE(p.is_packed());
+	EXPECT_EQ(p.size(), c.size());
+	EXPECT_EQ(p, c);
+	EXPECT_EQ(p.hash(), c.hash());
+	EXPECT_EQ(p.as_string(), c.as_string());
+	EXPECT_EQ(p.to_bits(), c.to_bits());
+	EXPECT_EQ(p.extract(5, 30), c.extract(5, 30));
+	EXPECT_EQ(p.extract(60, 10, RTLIL::State::Sx).as_string(), "xxx1011001");
+
+	std::vector<uint64_t> words, packed_words;
+	ASSERT_TRUE(c.as_words(words));
+	ASSERT_TRUE(p.as_words(packed_words));
+	EXPECT_EQ(packed_words, words);
+
+	int ones = 0;
+	for (auto bit : static_cast<const RTLIL::Const &>(p))
+		if (bit == RTLIL::State::S1)
+			ones++;
+	EXPECT_EQ(ones, std::count(c.begin(), c.end(), RTLIL::State::S1));
+
+	// Modifying a packed value unpacks it.
+	p.bits()[40] = RTLIL::State::Sx;
+	EXPECT_FALSE(p.is_packed());
+	EXPECT_FALSE(p.is_fully_def());
+	p.pack();
+	EXPECT_FALSE(p.is_packed());
+	EXPECT_EQ(p[40], RTLIL::State::Sx);
+}
+
 YOSYS_NAMESPACE_END
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include "kernel/yosys.h"
+#include "kernel/sigtools.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+static void expect_same_map(RTLIL::Module *module, const SigMap &sigmap)
+{
+	SigMap fresh(module);
+	for (auto wire : module->wires())
+		EXPECT_EQ(sigmap(wire), fresh(wire)) << log_id(wire);
+}
+
+TEST(KernelSigtoolsTest, CachedSigMap)
+{
+	RTLIL::Module *module = new RTLIL::Module;
+	RTLIL::Wire *a = module->addWire("\\a", 4);
+	RTLIL::Wire *b = module->addWire("\\b", 4);
+	RTLIL::Wire *c = module->addWire("\\c", 4);
+	module->connect(a, b);
+
+	const SigMap &sigmap = SigMap::cached(module);
+	EXPECT_EQ(&sigmap, &SigMap::cached(module));
+	expect_same_map(module, sigmap);
+
+	// followed incrementally
+	RTLIL::SigSpec sig = RTLIL::SigSpec(b).extract(0, 2);
+	sig.append(RTLIL::Const(1, 2));
+	module->connect(c, sig);
+	RTLIL::SigSpec lhs = RTLIL::SigBit(c, 3);
+	lhs.append(RTLIL::State::S0);
+	module->connect(lhs, RTLIL::SigSpec(a, 0, 2));
+	expect_same_map(module, sigmap);
+	EXPECT_EQ(sigmap(RTLIL::SigBit(c, 2)), RTLIL::SigBit(RTLIL::State::S1));
+	EXPECT_EQ(sigmap(RTLIL::SigBit(c, 3)), sigmap(RTLIL::SigBit(a, 0)));
+
+	// rebuilt on next use
+	module->new_connections({RTLIL::SigSig(b, c)});
+	expect_same_map(module, SigMap::cached(module));
+
+	module->remove(pool<RTLIL::Wire*>{c});
+	expect_same_map(module, SigMap::cached(module));
+
+	module->rename(a, "\\d");
+	expect_same_map(module, SigMap::cached(module));
+
+	delete module;
+}
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "kernel/yosys.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+template<typename T, int N>
+static void expect_same(const small_vector<T, N> &sv, const std::vector<T> &ref)
+{
+	ASSERT_EQ(sv.size(), ref.size());
+	EXPECT_TRUE(std::equal(sv.begin(), sv.end(), ref.begin()));
+	EXPECT_EQ(std::vector<T>(sv), ref);
+}
+
+// Random operations on a small_vector of non-trivial elements must match
+// std::vector, across the switch between inline and heap storage.
+TEST(KernelSmallVectorTest, MatchesVector)
+{
+	small_vector<std::string, 2> sv;
+	std::vector<std::string> ref;
+
+	uint32_t rng = 123456789;
+	for (int i = 0; i < 20000; i++) {
+		rng = mkhash_xorshift(rng);
+		std::string value = std::to_string(rng % 1000);
+		switch (rng % 8) {
+		case 0:
+			if (!ref.empty()) {
+				int k = (rng >> 8) % ref.size();
+				sv.erase(sv.begin() + k);
+				ref.erase(ref.begin() + k);
+			}
+			break;
+		case 1:
+			if (ref.size() > 6) {
+				sv.clear();
+				ref.clear();
+			}
+			break;
+		case 2: {
+			// insert a part of the vector itself
+			int k = ref.empty() ? 0 : (rng >> 8) % ref.size();
+			std::vector<std::string> part(ref.begin(), ref.begin() + k);
+			sv.insert(sv.begin() + k / 2, sv.begin(), sv.begin() + k);
+			ref.insert(ref.begin() + k / 2, part.begin(), part.end());
+			break;
+		}
+		case 3:
+			if (!ref.empty()) {
+				sv.push_back(sv.front());
+				ref.push_back(ref.front());
+			}
+			break;
+		case 4: {
+			small_vector<std::string, 2> copy = sv;
+			small_vector<std::string, 2> moved = std::move(copy);
+			EXPECT_TRUE(copy.empty());
+			sv.swap(moved);
+			expect_same(moved, ref);
+			break;
+		}
+		default:
+			sv.emplace_back(value);
+			ref.push_back(value);
+		}
+		if (ref.size() > 50) {
+			sv.resize(3);
+			ref.resize(3);
+		}
+		expect_same(sv, ref);
+	}
+
+	sv = small_vector<std::string, 2>();
+	EXPECT_TRUE(sv.is_inline());
+	sv.push_back("a");
+	sv.push_back("b");
+	EXPECT_TRUE(sv.is_inline());
+	EXPECT_EQ(sv.heap_size(), 0u);
+	sv.push_back("c");
+	EXPECT_FALSE(sv.is_inline());
+	EXPECT_THROW(sv.at(3), std::out_of_range);
+}
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include "kernel/yosys.h"
+#include "kernel/celltypes.h"
+#include "kernel/threading.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+// Module-local passes build a CellTypes on the main thread and query it from
+// all workers, so lookups in a hashlib table must not modify it.
+TEST(KernelThreadingTest, SharedCellTypes)
+{
+	CellTypes ct;
+	ct.setup_internals();
+	ct.setup_stdcells();
+
+	std::vector<RTLIL::IdString> types;
+	for (auto &it : ct.cell_types)
+		types.push_back(it.first);
+	types.push_back(RTLIL::IdString("\\unknown_cell"));
+
+	int expected = 0;
+	for (auto &type : types)
+		if (ct.cell_known(type) && ct.cell_output(type, ID::Y))
+			expected++;
+
+	int saved_threads = yosys_threads;
+	yosys_threads = 4;
+
+	std::vector<int> found(256);
+	parallel_for(GetSize(found), [&](int i) {
+		int count = 0;
+		for (auto &type : types)
+			if (ct.cell_known(type) && ct.cell_output(type, ID::Y))
+				count++;
+		found[i] = count;
+	});
+
+	yosys_threads = saved_threads;
+	parallel_shutdown();
+
+	for (int count : found)
+		EXPECT_EQ(count, expected);
+}
+
+YOSYS_NAMESPACE_END
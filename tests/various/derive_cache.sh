@@ -0,0 +1,83 @@
+#!/usr/bin/env bash
+# Modules loaded from the derive cache must be the same as freshly elaborated
+# ones, and the second run must not elaborate them again. Messages and warnings
+# of the elaboration must be repeated when a module is loaded from the cache.
+
+trap 'echo "ERROR in derive_cache.sh" >&2; exit 1' ERR
+
+rm -rf derive_cache.d
+
+cat > derive_cache.v << "EOT"
+module fifo #(parameter W = 4, D = 8) (input clk, we, re, input [W-1:0] din, output reg [W-1:0] dout);
+	reg [W-1:0] mem [0:D-1];
+	reg [$clog2(D)-1:0] wp, rp;
+	initial $display("fifo W=%0d D=%0d", W, D);
+	initial $dumpvars;
+	always @(posedge clk) begin
+		if (we) begin
+			mem[wp] <= din;
+			wp <= wp + 1;
+		end
+		if (re) begin
+			dout <= mem[rp];
+			rp <= rp + 1;
+		end
+	end
+endmodule
+
+module top(input clk, we, re, input [15:0] din, output [15:0] dout);
+	fifo #(.W(8)) u1 (.clk(clk), .we(we), .re(re), .din(din[7:0]), .dout(dout[7:0]));
+	fifo #(.W(4), .D(16)) u2 (.clk(clk), .we(we), .re(re), .din(din[11:8]), .dout(dout[11:8]));
+	fifo #(.W(4), .D(4)) u3 (.clk(clk), .we(we), .re(re), .din(din[15:12]), .dout(dout[15:12]));
+endmodule
+EOT
+
+../../yosys -Q -T -q -l derive_cache_gold.log -p "read_verilog derive_cache.v; hierarchy -top top; write_rtlil derive_cache_gold.il"
+../../yosys -Q -T -q -l derive_cache_1.log -p "read_verilog derive_cache.v; hierarchy -derive_cache derive_cache.d -top top; write_rtlil derive_cache_1.il"
+../../yosys -Q -T -q -l derive_cache_2.log -p "read_verilog derive_cache.v; hierarchy -derive_cache derive_cache.d -top top; write_rtlil derive_cache_2.il"
+
+test $(ls derive_cache.d/*.rtlilb | wc -l) -eq 3
+test $(ls derive_cache.d/*.log | wc -l) -eq 3
+! grep -q "from derive cache" derive_cache_1.log
+test $(grep -c "from derive cache" derive_cache_2.log) -eq 3
+
+# names generated with autoidx may differ, compare the netlists
+for f in derive_cache_gold derive_cache_1 derive_cache_2; do
+	../../yosys -Q -T -q -p "read_rtlil $f.il; proc; opt_clean; rename -enumerate; write_rtlil -noattr $f.norm.il"
+done
+cmp derive_cache_gold.norm.il derive_cache_1.norm.il
+cmp derive_cache_gold.norm.il derive_cache_2.norm.il
+
+messages() {
+	grep -E "fifo W=|Ignoring call|Warnings:" $1.log > $1.msg
+}
+messages derive_cache_gold
+for f in derive_cache_1 derive_cache_2; do
+	messages $f
+	cmp derive_cache_gold.msg $f.msg
+done
+
+# a truncated cache entry is discarded and the module is elaborated again
+f=$(ls derive_cache.d/*.rtlilb | head -n 1)
+head -c 20 $f > $f.tmp && mv $f.tmp $f
+../../yosys -Q -T -q -l derive_cache_3.log -p "read_verilog derive_cache.v; hierarchy -derive_cache derive_cache.d -top top; write_rtlil derive_cache_3.il"
+grep -q "Discarding truncated or corrupt" derive_cache_3.log
+test $(grep -c "from derive cache" derive_cache_3.log) -eq 2
+../../yosys -Q -T -q -p "read_rtlil derive_cache_3.il; proc; opt_clean; rename -enumerate; write_rtlil -noattr derive_cache_3.norm.il"
+cmp derive_cache_gold.norm.il derive_cache_3.norm.il
+test $(ls derive_cache.d/*.rtlilb | wc -l) -eq 3
+
+# "hierarchy -j" derives in worker processes and must not depend on their number,
+# with a single job it does not start any
+for j in 1 4; do
+	../../yosys -Q -T -q -l derive_cache_j$j.log -p "read_verilog derive_cache.v; hierarchy -j $j -top top; write_rtlil derive_cache_j$j.il"
+	../../yosys -Q -T -q -p "read_rtlil derive_cache_j$j.il; proc; opt_clean; rename -enumerate; write_rtlil -noattr derive_cache_j$j.norm.il"
+	cmp derive_cache_gold.norm.il derive_cache_j$j.norm.il
+	messages derive_cache_j$j
+	cmp derive_cache_gold.msg derive_cache_j$j.msg
+done
+cmp derive_cache_j1.il derive_cache_j4.il
+test $(grep -c "worker processes" derive_cache_j1.log) -eq 0
+grep -q "worker processes" derive_cache_j4.log
+# the temporary cache of the worker processes does not show up in the log
+test $(grep -c -e "from derive cache" -e "yosys-derive-" derive_cache_j4.log) -eq 0
@@ -0,0 +1,26 @@
+#!/usr/bin/env bash
+# ltp and torder on a small known netlist, both are built on ModGraph
+
+trap 'echo "ERROR in modgraph.sh" >&2; exit 1' ERR
+
+cat > modgraph.v << "EOT"
+module top(input clk, i0, i1, i2, output y, q);
+	wire t1, t2;
+	\$_AND_ g3 (.A(i0), .B(i1), .Y(t1));
+	\$_OR_ g2 (.A(t1), .B(i2), .Y(t2));
+	\$_NOT_ g1 (.A(t2), .Y(y));
+	\$_DFF_P_ ff (.C(clk), .D(y), .Q(q));
+endmodule
+EOT
+
+../../yosys -Q -T -q -l modgraph.out -p "read_verilog modgraph.v; ltp; ltp -noff; torder"
+
+# the path through the FF, and the combinational path ending at it
+grep -q "Longest topological path in top (length=4):" modgraph.out
+grep -q "Longest topological path in top (length=3):" modgraph.out
+grep -q "    4: \\\\q (via ff)" modgraph.out
+grep -q "   ff: \\\\q (via ff)" modgraph.out
+
+# cells are named against their topological order
+grep "^  cell " modgraph.out > modgraph.torder
+printf "  cell g3\n  cell g2\n  cell g1\n  cell ff\n" | diff - modgraph.torder
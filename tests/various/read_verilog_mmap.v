@@ -0,0 +1,7 @@
+// no compiler directives: lexed directly from the mapped file
+module read_verilog_mmap(input a, b, output y, z);
+	// a line comment with a "string" and a /* block comment */
+	assign y = a & b; // trailing comment
+	/* a block comment
+	   spanning two lines */ assign z = a | b;
+endmodule
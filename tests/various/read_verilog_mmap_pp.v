@@ -0,0 +1,5 @@
+// a compiler directive: read through the pre-processor
+`define OP |
+module read_verilog_mmap_pp(input a, b, output y);
+	assign y = a `OP b;
+endmodule
@@ -0,0 +1,21 @@
+// structural netlist features supported by "read_verilog -netlist"
+module leaf(a, b, y);
+	input [1:0] a;
+	input b;
+	output y;
+endmodule
+
+(* top *)
+module top (
+	input [3:0] \in[x] ,
+	input [0:3] up,
+	output [7:0] out,
+	output o1, o2
+);
+	wire [3:0] w;
+	(* keep *)
+	CELL #(.P(4'b1010), .S("str")) l1 (.A(\in[x] [3:2]), .B(up[1]), .Y(o1)), l4 (.A(2'b00), .B(1'b1), .Y());
+	leaf l2 (w[1:0], 1'b0, o2);
+	leaf l3 (.a({n1, n2}), .b(), .y());
+	assign w = {up[0:1], 2'bx1}, out = {2{w}};
+endmodule
@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+# Binary RTLIL must round-trip to the same text RTLIL, and "read_rtlil -lazy"
+# must only load the modules used below the top module.
+
+trap 'echo "ERROR in rtlil_binary.sh" >&2; exit 1' ERR
+
+cat > rtlil_binary.v << "EOT"
+module sub #(parameter W = 4) (input clk, input [W-1:0] a, output reg [W-1:0] q);
+	(* keep, src_note = "string attribute" *)
+	reg [W-1:0] mem [0:7];
+	always @(posedge clk) begin
+		case (a[1:0])
+			2'b00: q <= a;
+			2'b1x: q <= 'bz;
+			default: q <= mem[a[2:0]];
+		endcase
+		mem[a[2:0]] <= a;
+	end
+endmodule
+
+module unused(input a, output y);
+	assign y = ~a;
+endmodule
+
+(* blackbox *)
+module bb #(parameter P = 1) (input a, output y);
+endmodule
+
+module top(input clk, input [7:0] a, output [7:0] q, output [0:3] r, output signed [5:2] s, output y);
+	sub #(.W(8)) u1 (.clk(clk), .a(a), .q(q));
+	sub u2 (.clk(clk), .a(a[3:0]), .q(r));
+	bb #(.P(3)) u3 (.a(a[0]), .y(y));
+	assign s = {a[3], 3'bx10} - 2;
+endmodule
+EOT
+
+../../yosys -Q -T -q -p "read_verilog rtlil_binary.v; write_rtlil rtlil_binary_gold.il; write_rtlil -binary rtlil_binary.rtlil"
+../../yosys -Q -T -q -p "read_rtlil rtlil_binary.rtlil; write_rtlil rtlil_binary_gate.il"
+cmp rtlil_binary_gold.il rtlil_binary_gate.il
+
+# elaborated design with only cells and connections
+../../yosys -Q -T -q -p "read_verilog rtlil_binary.v; hierarchy -top top; proc; memory; opt; write_rtlil rtlil_binary_gold.il; write_rtlil -binary rtlil_binary.rtlil"
+../../yosys -Q -T -q -p "read_rtlil rtlil_binary.rtlil; write_rtlil rtlil_binary_gate.il"
+cmp rtlil_binary_gold.il rtlil_binary_gate.il
+
+# lazy loading
+../../yosys -Q -T -q -p "read_verilog rtlil_binary.v; hierarchy; write_rtlil -binary rtlil_binary.rtlil"
+../../yosys -Q -T -q -p "read_rtlil -lazy rtlil_binary.rtlil; select -assert-any bb; select -assert-none top sub; hierarchy -top top; select -assert-none unused \$abstract*; select -assert-any top sub; write_rtlil rtlil_binary_gate.il"
+../../yosys -Q -T -q -p "read_rtlil rtlil_binary.rtlil; hierarchy -top top; write_rtlil rtlil_binary_gold.il"
+cmp rtlil_binary_gold.il rtlil_binary_gate.il
+
+# the file can be changed before all modules are loaded
+../../yosys -Q -T -q -p "read_rtlil -lazy rtlil_binary.rtlil; !truncate -s 0 rtlil_binary.rtlil; hierarchy -top top; write_rtlil rtlil_binary_gate.il"
+cmp rtlil_binary_gold.il rtlil_binary_gate.il
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# Module-local passes must give the same log and netlist with and without
+# worker threads.
+
+trap 'echo "ERROR in threads.sh" >&2; exit 1' ERR
+
+# The logs differ only in the names of the output files.
+cmp_logs() {
+	cmp <(sed 's/_j[0-9]/_jN/g' $1) <(sed 's/_j[0-9]/_jN/g' $2)
+}
+
+cat > threads.v << "EOT"
+module sub1(input [7:0] a, b, output [7:0] x, y);
+	assign x = (a & b) + 8'd0;
+	assign y = (a & b) + 8'd0;
+endmodule
+
+module sub2(input [7:0] a, b, output [7:0] x, y, z);
+	assign x = a ^ b;
+	assign y = b ^ a;
+	assign z = a | 8'hff;
+endmodule
+
+module sub3(input a, b, c, output x, y);
+	assign x = a ? b : c;
+	assign y = a ? b : c;
+endmodule
+
+module top(input [7:0] a, b, output [7:0] x, y, z, output p, q);
+	sub1 u1 (.a(a), .b(b), .x(x), .y(y));
+	sub2 u2 (.a(a), .b(b), .x(), .y(), .z(z));
+	sub3 u3 (.a(a[0]), .b(b[0]), .c(a[1]), .x(p), .y(q));
+endmodule
+EOT
+
+for j in 1 4; do
+	../../yosys -Q -T -q -l threads_j$j.log -j $j -p "read_verilog threads.v; proc; opt_expr -undriven; opt_merge; opt_expr -fine; opt_merge -share_all; opt_clean; opt_expr -fine; opt_merge; opt_clean; write_rtlil threads_j$j.il; write_verilog threads_j$j.out.v"
+done
+
+cmp_logs threads_j1.log threads_j4.log
+cmp threads_j1.il threads_j4.il
+cmp threads_j1.out.v threads_j4.out.v
+
+for j in 1 4; do
+	../../yosys -Q -T -q -l threads_techmap_j$j.log -j $j -p "read_verilog threads.v; proc; flatten; techmap; opt_clean; write_rtlil threads_techmap_j$j.il"
+done
+
+cmp_logs threads_techmap_j1.log threads_techmap_j4.log
+cmp threads_techmap_j1.il threads_techmap_j4.il
+
+# opt_expr creates new wires and cells (named with NEW_ID) in every module
+cat > threads_newid.v << "EOT"
+module m1(input [7:0] a, input c, output x, y, z);
+	assign x = a < 8'd16;
+	assign y = c != 1'b1;
+	assign z = a >= 8'd64;
+endmodule
+
+module m2(input signed [7:0] a, input c, output signed [7:0] x, output y);
+	assign x = a / 8'sd4;
+	assign y = c == 1'b0;
+endmodule
+
+module m3(input [7:0] a, b, output x, y, z);
+	assign x = a < 8'd32;
+	assign y = b < 8'd2;
+	assign z = a[0] != 1'b1;
+endmodule
+EOT
+
+for j in 1 4; do
+	../../yosys -Q -T -l threads_newid_j$j.log -j $j -p "read_verilog threads_newid.v; proc; opt_expr -fine; opt_clean; write_rtlil threads_newid_j$j.il"
+done
+
+grep -q '\$auto\$opt_expr' threads_newid_j1.il
+cmp_logs threads_newid_j1.log threads_newid_j4.log
+cmp threads_newid_j1.il threads_newid_j4.il
+
+# IdStrings created and released from worker threads
+../../yosys -Q -T -q -p "bench -idstring -n 20000 -j 4"